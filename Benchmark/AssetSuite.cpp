@@ -0,0 +1,126 @@
+#include <Benchmark/Suites.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+#include <Engine/Core.hpp>
+#include <Engine/Asset.hpp>
+#include <Engine/Assets.hpp>
+#include <Engine/FileNode.hpp>
+
+#include <Benchmark/Benchmark.hpp>
+#include <Benchmark/Synthetic.hpp>
+
+static constexpr std::string_view PROJECT_NAME{ "NeoDoaBenchmark" };
+static constexpr int DIAMOND_FAN_OUT{ 4 };
+
+static std::filesystem::path SyntheticWorkspace() { return std::filesystem::temp_directory_path() / PROJECT_NAME; }
+
+static uint64_t TotalVersion(const Assets& assets) {
+    uint64_t rv{ 0 };
+    for (UUID id : assets.AllAssetsIDs()) {
+        rv += assets.FindAsset(id)->Version();
+    }
+    return rv;
+}
+
+static void RunImport(BenchmarkRunner& runner, Core& core, const SyntheticProject& project, const BenchmarkResult::Values& params) {
+    const std::string workspace{ project.Workspace().string() };
+    if (BenchmarkResult* result = runner.Run("assets.import", params, [&] {
+        core.CreateAndLoadProject(workspace, PROJECT_NAME);
+    })) {
+        result->Counters.emplace_back("assets", static_cast<int64_t>(project.AssetCount()));
+    }
+}
+
+/* Every program depends on the vertex shader, every material on its own program and on DIAMOND_FAN_OUT more,
+so a change to the shader reaches most materials along several paths. Each dependent must be deserialized once. */
+static void RunDiamondInvalidation(BenchmarkRunner& runner, Assets& assets, const SyntheticProject& project, const BenchmarkResult::Values& params) {
+    const std::vector<UUID>& programs = project.Programs();
+    const Assets::UUIDCollection materials = assets.MaterialAssetIDs();
+    for (size_t i = 0; i < materials.size(); i++) {
+        for (size_t j = 1; j <= DIAMOND_FAN_OUT; j++) {
+            assets.TryRegisterDependencyBetween(materials[i], programs[(i + j) % programs.size()]);
+        }
+    }
+
+    AssetHandle shader = assets.FindAsset(project.VertexShader());
+    const size_t dependents{ assets.DependentsOf(project.VertexShader()).size() };
+
+    const uint64_t before{ TotalVersion(assets) };
+    shader->ForceDeserialize();
+    const uint64_t deserializations{ TotalVersion(assets) - before };
+
+    if (BenchmarkResult* result = runner.Run("assets.diamond_invalidation", params, [&] {
+        shader->ForceDeserialize();
+    })) {
+        result->Counters.emplace_back("dependents", static_cast<int64_t>(dependents));
+        result->Counters.emplace_back("deserializations", static_cast<int64_t>(deserializations));
+    }
+}
+
+static void RunFileTree(BenchmarkRunner& runner, Assets& assets, const SyntheticProject& project, const BenchmarkResult::Values& params) {
+    FNode& root = assets.Root();
+    const std::filesystem::path& deepest = project.DeepestFolder();
+    FNode& folder = root.FindChild(deepest);
+
+    runner.Run("fnode.find_child", params, [&] {
+        DoNotOptimize(&root.FindChild(deepest));
+    });
+    runner.Run("fnode.path", params, [&] {
+        DoNotOptimize(folder.Path());
+    });
+}
+
+/* Resolving a held handle, what per frame code should do, against looking the id up every time. */
+static void RunLookups(BenchmarkRunner& runner, Assets& assets, const BenchmarkResult::Values& params) {
+    const Assets::UUIDCollection& ids = assets.AllAssetsIDs();
+    std::vector<AssetHandle> handles;
+    handles.reserve(ids.size());
+    for (UUID id : ids) {
+        handles.push_back(assets.FindAsset(id));
+    }
+
+    runner.Run("assets.find", params, [&] {
+        uint64_t sum{ 0 };
+        for (UUID id : ids) {
+            sum += assets.FindAsset(id)->Version();
+        }
+        DoNotOptimize(sum);
+    });
+    runner.Run("assets.handle_resolve", params, [&] {
+        uint64_t sum{ 0 };
+        for (const AssetHandle& handle : handles) {
+            if (handle.HasValue()) {
+                sum += handle->Version();
+            }
+        }
+        DoNotOptimize(sum);
+    });
+}
+
+void RunAssetSuite(BenchmarkRunner& runner) {
+    const SyntheticProject::Params projectParams{};
+    const BenchmarkResult::Values params{
+        { "scenes", projectParams.Scenes },
+        { "entities_per_scene", projectParams.EntitiesPerScene },
+        { "programs", projectParams.Programs },
+        { "materials_per_program", projectParams.MaterialsPerProgram },
+        { "folder_depth", projectParams.FolderDepth }
+    };
+    const SyntheticProject project{ SyntheticWorkspace(), projectParams };
+
+    const CorePtr& core = Core::GetCore();
+    RunImport(runner, *core, project, params);
+
+    // The benchmarks below work on a freshly loaded project, whatever the import benchmark left behind.
+    core->CreateAndLoadProject(project.Workspace().string(), PROJECT_NAME);
+    Assets& assets = *core->GetAssets();
+    RunFileTree(runner, assets, project, params);
+    RunLookups(runner, assets, params);
+    RunDiamondInvalidation(runner, assets, project, params);
+
+    core->UnloadProject();
+}
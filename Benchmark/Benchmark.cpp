@@ -0,0 +1,121 @@
+#include <Benchmark/Benchmark.hpp>
+
+#include <cmath>
+#include <ctime>
+#include <cassert>
+#include <numeric>
+#include <sstream>
+#include <algorithm>
+
+#include <Engine/Log.hpp>
+
+static std::string Escape(std::string_view string) {
+    std::string rv;
+    rv.reserve(string.size());
+    for (char c : string) {
+        switch (c) {
+        case '"':  rv += "\\\""; break;
+        case '\\': rv += "\\\\"; break;
+        case '\n': rv += "\\n";  break;
+        case '\t': rv += "\\t";  break;
+        default:   rv += c;      break;
+        }
+    }
+    return rv;
+}
+
+static void WriteValues(std::ostringstream& json, const BenchmarkResult::Values& values) {
+    json << "{";
+    for (size_t i = 0; i < values.size(); i++) {
+        json << (i == 0 ? " " : ", ") << "\"" << Escape(values[i].first) << "\": " << values[i].second;
+    }
+    json << (values.empty() ? "}" : " }");
+}
+
+BenchmarkRunner::BenchmarkRunner(BenchmarkSettings settings) noexcept :
+    settings(std::move(settings)) {
+    assert(this->settings.MaxIterations >= 1 && this->settings.MaxIterations >= this->settings.MinIterations);
+}
+
+bool BenchmarkRunner::IsEnabled(std::string_view name) const noexcept {
+    return settings.Filter.empty() || name.find(settings.Filter) != std::string_view::npos;
+}
+
+BenchmarkResult* BenchmarkRunner::Run(std::string_view name, BenchmarkResult::Values params, const std::function<void()>& setup, const std::function<void()>& body) {
+    if (!IsEnabled(name)) { return nullptr; }
+    using Clock = std::chrono::steady_clock;
+
+    setup();
+    body();
+
+    std::vector<std::chrono::nanoseconds> samples;
+    samples.reserve(settings.MinIterations);
+    Clock::duration total{};
+    while (samples.size() < settings.MaxIterations && (samples.size() < settings.MinIterations || total < settings.MinTime)) {
+        setup();
+        const auto start = Clock::now();
+        body();
+        const auto elapsed = Clock::now() - start;
+        samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed));
+        total += elapsed;
+    }
+    std::ranges::sort(samples);
+
+    BenchmarkResult& result = results.emplace_back();
+    result.Name = name;
+    result.Params = std::move(params);
+    result.Iterations = samples.size();
+    result.Min = samples.front();
+    result.Max = samples.back();
+    result.Median = samples[samples.size() / 2];
+    result.Mean = std::accumulate(samples.begin(), samples.end(), std::chrono::nanoseconds{}) / samples.size();
+    double variance{ 0.0 };
+    for (const auto& sample : samples) {
+        const double deviation{ static_cast<double>((sample - result.Mean).count()) };
+        variance += deviation * deviation;
+    }
+    result.StdDev = std::sqrt(variance / static_cast<double>(samples.size()));
+
+    DOA_LOG_INFO("%-40s %10.3f us (median of %zu)", result.Name.c_str(), static_cast<double>(result.Median.count()) / 1000.0, result.Iterations);
+    return &result;
+}
+BenchmarkResult* BenchmarkRunner::Run(std::string_view name, BenchmarkResult::Values params, const std::function<void()>& body) {
+    return Run(name, std::move(params), [] {}, body);
+}
+
+const std::vector<BenchmarkResult>& BenchmarkRunner::Results() const noexcept { return results; }
+
+std::string BenchmarkRunner::ToJSON(std::string_view label) const {
+    char timestamp[32]{};
+    const std::time_t now{ std::time(nullptr) };
+    std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+    std::ostringstream json;
+    json << "{\n";
+    json << "  \"label\": \"" << Escape(label) << "\",\n";
+    json << "  \"timestamp\": \"" << timestamp << "\",\n";
+#ifdef DEBUG
+    json << "  \"configuration\": \"Debug\",\n";
+#else
+    json << "  \"configuration\": \"Release\",\n";
+#endif
+    json << "  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchmarkResult& result = results[i];
+        json << (i == 0 ? "\n" : ",\n");
+        json << "    {\n";
+        json << "      \"name\": \"" << Escape(result.Name) << "\",\n";
+        json << "      \"params\": "; WriteValues(json, result.Params); json << ",\n";
+        json << "      \"counters\": "; WriteValues(json, result.Counters); json << ",\n";
+        json << "      \"iterations\": " << result.Iterations << ",\n";
+        json << "      \"min_ns\": " << result.Min.count() << ",\n";
+        json << "      \"median_ns\": " << result.Median.count() << ",\n";
+        json << "      \"mean_ns\": " << result.Mean.count() << ",\n";
+        json << "      \"max_ns\": " << result.Max.count() << ",\n";
+        json << "      \"stddev_ns\": " << static_cast<int64_t>(std::llround(result.StdDev)) << "\n";
+        json << "    }";
+    }
+    json << (results.empty() ? "]\n" : "\n  ]\n");
+    json << "}\n";
+    return json.str();
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include <functional>
+#include <string_view>
+
+struct BenchmarkSettings {
+    /* Only benchmarks whose name contains Filter run, empty runs everything. */
+    std::string Filter{};
+    /* A benchmark runs for at least MinIterations and MinTime, whichever is longer, but never more than MaxIterations.
+    MaxIterations must be at least 1 and at least MinIterations, every result needs a sample. */
+    size_t MinIterations{ 10 };
+    size_t MaxIterations{ 1000 };
+    std::chrono::milliseconds MinTime{ 500 };
+};
+
+struct BenchmarkResult {
+    using Values = std::vector<std::pair<std::string, int64_t>>;
+
+    std::string Name{};
+    Values Params{};
+    /* Reported by the benchmark itself, e.g. bytes produced or assets touched. */
+    Values Counters{};
+
+    size_t Iterations{};
+    std::chrono::nanoseconds Min{};
+    std::chrono::nanoseconds Median{};
+    std::chrono::nanoseconds Mean{};
+    std::chrono::nanoseconds Max{};
+    double StdDev{}; /* in nanoseconds */
+};
+
+struct BenchmarkRunner {
+
+    explicit BenchmarkRunner(BenchmarkSettings settings) noexcept;
+
+    bool IsEnabled(std::string_view name) const noexcept;
+
+    /* Times body once per iteration, after one untimed warm-up call. setup runs before every call, untimed.
+    Returns nullptr if the benchmark is filtered out, otherwise its result so counters can be attached. */
+    BenchmarkResult* Run(std::string_view name, BenchmarkResult::Values params, const std::function<void()>& setup, const std::function<void()>& body);
+    BenchmarkResult* Run(std::string_view name, BenchmarkResult::Values params, const std::function<void()>& body);
+
+    const std::vector<BenchmarkResult>& Results() const noexcept;
+
+    /* Results as a JSON document, label identifies the run (e.g. a commit hash) when comparing runs. */
+    std::string ToJSON(std::string_view label) const;
+
+private:
+    BenchmarkSettings settings;
+    std::vector<BenchmarkResult> results{};
+};
+
+/* Keeps the compiler from discarding a result that is otherwise unused. */
+template<typename T>
+void DoNotOptimize(const T& value) noexcept {
+    [[maybe_unused]] static const void* volatile sink{ nullptr };
+    sink = &value;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+}
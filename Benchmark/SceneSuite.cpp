@@ -0,0 +1,50 @@
+#include <Benchmark/Suites.hpp>
+
+#include <string>
+
+#include <glm/glm.hpp>
+
+#include <Engine/Scene.hpp>
+#include <Engine/TransformComponent.hpp>
+
+#include <Benchmark/Benchmark.hpp>
+#include <Benchmark/Synthetic.hpp>
+
+static constexpr int SCENE_SIZES[]{ 1'000, 10'000 };
+static constexpr int CHAIN_DEPTH{ 8 };
+static constexpr int DEEP_CHAIN_DEPTHS[]{ 64, 256 };
+
+void RunSceneSuite(BenchmarkRunner& runner) {
+    for (int entityCount : SCENE_SIZES) {
+        const BenchmarkResult::Values params{ { "entities", entityCount }, { "chain_depth", CHAIN_DEPTH } };
+        const Scene scene = MakeSyntheticScene(entityCount, CHAIN_DEPTH);
+        const std::string serialized = scene.Serialize();
+
+        if (BenchmarkResult* result = runner.Run("scene.serialize", params, [&] {
+            DoNotOptimize(scene.Serialize());
+        })) {
+            result->Counters.emplace_back("bytes", static_cast<int64_t>(serialized.size()));
+        }
+        runner.Run("scene.deserialize", params, [&] {
+            DoNotOptimize(Scene::Deserialize(serialized));
+        });
+        runner.Run("scene.copy", params, [&] {
+            DoNotOptimize(Scene::Copy(scene));
+        });
+        runner.Run("transform.world_matrix_all", params, [&] {
+            glm::mat4 sum{ 0.0f };
+            for (Entity entity : scene.GetAllEntites()) {
+                sum += TransformComponent::ComputeWorldMatrix(entity, scene);
+            }
+            DoNotOptimize(sum);
+        });
+    }
+
+    for (int depth : DEEP_CHAIN_DEPTHS) {
+        const Scene scene = MakeSyntheticScene(depth, depth);
+        const Entity leaf = scene.GetAllEntites().back();
+        runner.Run("transform.world_matrix_deep", { { "depth", depth } }, [&] {
+            DoNotOptimize(TransformComponent::ComputeWorldMatrix(leaf, scene));
+        });
+    }
+}
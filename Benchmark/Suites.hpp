@@ -0,0 +1,7 @@
+#pragma once
+
+struct BenchmarkRunner;
+
+void RunSceneSuite(BenchmarkRunner& runner);
+void RunAssetSuite(BenchmarkRunner& runner);
+void RunUtilitySuite(BenchmarkRunner& runner);
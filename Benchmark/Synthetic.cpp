@@ -0,0 +1,119 @@
+#include <Benchmark/Synthetic.hpp>
+
+#include <string>
+#include <fstream>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <Engine/Log.hpp>
+#include <Engine/Shader.hpp>
+#include <Engine/Material.hpp>
+#include <Engine/ChildComponent.hpp>
+#include <Engine/ParentComponent.hpp>
+#include <Engine/TransformComponent.hpp>
+#include <Engine/SceneSerializer.hpp>
+#include <Engine/MaterialSerializer.hpp>
+#include <Engine/ShaderProgramSerializer.hpp>
+
+static constexpr std::string_view VERTEX_SHADER_SOURCE{ R"(#version 460 core
+layout(location = 0) in vec3 vPos;
+void main() {
+    gl_Position = vec4(vPos, 1.0);
+}
+)" };
+static constexpr std::string_view FRAGMENT_SHADER_SOURCE{ R"(#version 460 core
+out vec4 FragColor;
+void main() {
+    FragColor = vec4(1.0);
+}
+)" };
+
+Scene MakeSyntheticScene(int entityCount, int chainDepth) {
+    Scene scene{ "Synthetic Scene" };
+    Entity parent{ NULL_ENTT };
+    for (int i = 0; i < entityCount; i++) {
+        const Entity entity = scene.CreateEntity();
+        const float t{ static_cast<float>(i) };
+
+        TransformComponent& transform = scene.GetComponent<TransformComponent>(entity);
+        transform.SetLocalTranslation({ std::sin(t), std::cos(t), t * 0.01f });
+        transform.SetLocalRotation(glm::angleAxis(t * 0.1f, glm::normalize(glm::vec3{ 1.0f, 2.0f, 3.0f })));
+        transform.SetLocalScale(glm::vec3{ 1.0f + 0.001f * static_cast<float>(i % 7) });
+
+        if (i % chainDepth != 0) {
+            scene.EmplaceComponent<ChildComponent>(entity);
+            scene.GetComponent<ChildComponent>(entity).SetParent(parent);
+            if (!scene.HasComponent<ParentComponent>(parent)) {
+                scene.EmplaceComponent<ParentComponent>(parent);
+            }
+            scene.GetComponent<ParentComponent>(parent).GetChildren().push_back(entity);
+        }
+        parent = entity;
+    }
+    return scene;
+}
+
+UUID SyntheticAssetID(uint64_t index) noexcept { return UUID(0x5EED'0000'0000'0000uLL + index + 1); }
+
+SyntheticProject::SyntheticProject(std::filesystem::path workspace, const Params& params) :
+    workspace(std::move(workspace)) {
+    std::filesystem::remove_all(this->workspace);
+    std::filesystem::create_directories(this->workspace);
+
+    vertexShader = WriteAsset("Shaders/Synthetic.vert", VERTEX_SHADER_SOURCE);
+    fragmentShader = WriteAsset("Shaders/Synthetic.frag", FRAGMENT_SHADER_SOURCE);
+
+    for (int i = 0; i < params.Programs; i++) {
+        ShaderProgram program;
+        program.Name = "Program" + std::to_string(i);
+        program.VertexShader = vertexShader;
+        program.FragmentShader = fragmentShader;
+        const UUID programID = WriteAsset("Programs/" + program.Name + ".prog", SerializeShaderProgram(program));
+        programs.push_back(programID);
+
+        for (int j = 0; j < params.MaterialsPerProgram; j++) {
+            Material material;
+            material.Name = program.Name + "Material" + std::to_string(j);
+            material.ShaderProgram = programID;
+            WriteAsset("Materials/" + material.Name + ".mat", SerializeMaterial(material));
+        }
+    }
+
+    for (int i = 0; i < params.FolderDepth; i++) {
+        deepestFolder /= "Level" + std::to_string(i);
+    }
+    for (int i = 0; i < params.Scenes; i++) {
+        // Half the scenes live at the bottom of the folder chain, so the import walks a deep tree too.
+        const std::filesystem::path folder{ i % 2 == 0 ? std::filesystem::path("Scenes") : deepestFolder };
+        Scene scene = MakeSyntheticScene(params.EntitiesPerScene, params.ChainDepth);
+        WriteAsset(folder / ("Scene" + std::to_string(i) + ".scn"), SerializeScene(scene));
+    }
+}
+SyntheticProject::~SyntheticProject() noexcept {
+    std::error_code error;
+    std::filesystem::remove_all(workspace, error);
+    if (error) {
+        DOA_LOG_WARNING("Could not remove synthetic project at %s", workspace.string().c_str());
+    }
+}
+
+const std::filesystem::path& SyntheticProject::Workspace() const noexcept { return workspace; }
+const std::filesystem::path& SyntheticProject::DeepestFolder() const noexcept { return deepestFolder; }
+size_t SyntheticProject::AssetCount() const noexcept { return assetCount; }
+
+UUID SyntheticProject::VertexShader() const noexcept { return vertexShader; }
+UUID SyntheticProject::FragmentShader() const noexcept { return fragmentShader; }
+const std::vector<UUID>& SyntheticProject::Programs() const noexcept { return programs; }
+
+UUID SyntheticProject::WriteAsset(const std::filesystem::path& relativePath, std::string_view content) {
+    const std::filesystem::path path{ workspace / relativePath };
+    std::filesystem::create_directories(path.parent_path());
+
+    const UUID id{ SyntheticAssetID(nextID++) };
+    std::ofstream(path, std::ofstream::trunc | std::ofstream::binary) << content;
+    std::ofstream(path.string() + ".id", std::ofstream::trunc | std::ofstream::binary)
+        << "<importData><uuid>" << static_cast<uint64_t>(id) << "</uuid></importData>";
+    assetCount++;
+    return id;
+}
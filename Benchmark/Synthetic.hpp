@@ -0,0 +1,57 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <filesystem>
+
+#include <Engine/UUID.hpp>
+#include <Engine/Scene.hpp>
+
+/* A scene of entityCount entities, split into parent-child chains of chainDepth entities each. Transforms are
+deterministic and non-trivial, so matrix math can't be folded away. */
+Scene MakeSyntheticScene(int entityCount, int chainDepth);
+
+/* Deterministic ids, so runs import the same project with the same asset ids. */
+UUID SyntheticAssetID(uint64_t index) noexcept;
+
+/* A throwaway project written to disk for the asset benchmarks, removed again on destruction. Every asset gets
+its .id file up front, so references between assets (program to shader, material to program) resolve. */
+struct SyntheticProject {
+
+    struct Params {
+        int Scenes{ 8 };
+        int EntitiesPerScene{ 256 };
+        int ChainDepth{ 8 };
+        int Programs{ 32 };
+        int MaterialsPerProgram{ 4 };
+        int FolderDepth{ 16 };
+    };
+
+    SyntheticProject(std::filesystem::path workspace, const Params& params);
+    ~SyntheticProject() noexcept;
+    SyntheticProject(const SyntheticProject&) = delete;
+    SyntheticProject(SyntheticProject&&) = delete;
+    SyntheticProject& operator=(const SyntheticProject&) = delete;
+    SyntheticProject& operator=(SyntheticProject&&) = delete;
+
+    const std::filesystem::path& Workspace() const noexcept;
+    /* Relative to the workspace, the innermost folder of the nested folder chain. */
+    const std::filesystem::path& DeepestFolder() const noexcept;
+    size_t AssetCount() const noexcept;
+
+    UUID VertexShader() const noexcept;
+    UUID FragmentShader() const noexcept;
+    const std::vector<UUID>& Programs() const noexcept;
+
+private:
+    std::filesystem::path workspace;
+    std::filesystem::path deepestFolder{};
+    size_t assetCount{ 0 };
+    uint64_t nextID{ 0 };
+
+    UUID vertexShader{ UUID::Empty() };
+    UUID fragmentShader{ UUID::Empty() };
+    std::vector<UUID> programs{};
+
+    UUID WriteAsset(const std::filesystem::path& relativePath, std::string_view content);
+};
@@ -0,0 +1,58 @@
+#include <Benchmark/Suites.hpp>
+
+#include <Utility/AdjacencyList.hpp>
+
+#include <Benchmark/Benchmark.hpp>
+
+static constexpr int GRAPH_SIZES[]{ 256, 2048 };
+
+using Graph = AdjacencyList<uint64_t>;
+
+/* Layers of two vertices each, both vertices of a layer point at both vertices of the layer below. Vertex 0
+sits at the bottom, every other vertex reaches it along exponentially many paths. */
+static Graph MakeDeepDiamond(int vertexCount) {
+    Graph graph;
+    for (int i = 0; i < vertexCount; i++) {
+        graph.AddVertex(static_cast<uint64_t>(i));
+    }
+    for (int i = 1; i < vertexCount; i++) {
+        const int layerBelow{ (i - 1) / 2 * 2 - 1 };
+        if (layerBelow < 0) {
+            graph.AddEdge(static_cast<uint64_t>(i), 0);
+            continue;
+        }
+        graph.AddEdge(static_cast<uint64_t>(i), static_cast<uint64_t>(layerBelow));
+        graph.AddEdge(static_cast<uint64_t>(i), static_cast<uint64_t>(layerBelow + 1));
+    }
+    return graph;
+}
+
+void RunUtilitySuite(BenchmarkRunner& runner) {
+    for (int vertexCount : GRAPH_SIZES) {
+        const BenchmarkResult::Values params{ { "vertices", vertexCount } };
+        const Graph diamond = MakeDeepDiamond(vertexCount);
+
+        runner.Run("adjacency_list.build", params, [&] {
+            DoNotOptimize(MakeDeepDiamond(vertexCount));
+        });
+        runner.Run("adjacency_list.incoming_edges", params, [&] {
+            size_t count{ 0 };
+            for (auto it = diamond.GetIncomingEdgesOf(0); it.HasNext(); it.Next()) {
+                count++;
+            }
+            DoNotOptimize(count);
+        });
+
+        Graph scratch;
+        runner.Run("adjacency_list.remove_vertex", params, [&] {
+            scratch = diamond;
+        }, [&] {
+            scratch.RemoveVertex(static_cast<uint64_t>(vertexCount / 2));
+        });
+        if (BenchmarkResult* result = runner.Run("adjacency_list.transitive_origins", params, [&] {
+            DoNotOptimize(diamond.GetTransitiveOriginsOf(0));
+        })) {
+            result->Counters.emplace_back("origins", static_cast<int64_t>(diamond.GetTransitiveOriginsOf(0).size()));
+        }
+    }
+}
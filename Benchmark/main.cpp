@@ -0,0 +1,67 @@
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include <argparse/argparse.hpp>
+
+#include <Engine/Log.hpp>
+#include <Engine/Core.hpp>
+
+#include <Benchmark/Suites.hpp>
+#include <Benchmark/Benchmark.hpp>
+
+int main(int argc, char* argv[]) {
+    //- Parse Command Line Arguments -//
+    argparse::ArgumentParser program(argv[0]);
+    program.add_description("Times the engine's hot paths headlessly and writes the results as JSON.");
+    program.add_argument("--filter").help("Only run benchmarks whose name contains this").default_value(std::string{});
+    program.add_argument("--output").help("Path of the JSON report").default_value(std::string{ "benchmarks.json" });
+    program.add_argument("--label").help("Identifies the run in the report, e.g. a commit hash").default_value(std::string{});
+    program.add_argument("--min-iterations").help("Minimum timed iterations per benchmark").default_value(size_t{ 10 }).scan<'u', size_t>();
+    program.add_argument("--max-iterations").help("Maximum timed iterations per benchmark").default_value(size_t{ 1000 }).scan<'u', size_t>();
+    program.add_argument("--min-time-ms").help("Minimum time spent per benchmark").default_value(size_t{ 500 }).scan<'u', size_t>();
+
+    BenchmarkSettings settings;
+    std::string output;
+    std::string label;
+    try {
+        program.parse_args(argc, argv);
+        settings.Filter = program.get("--filter");
+        settings.MinIterations = program.get<size_t>("--min-iterations");
+        settings.MaxIterations = program.get<size_t>("--max-iterations");
+        if (settings.MaxIterations == 0) {
+            throw std::invalid_argument("--max-iterations must be at least 1");
+        }
+        if (settings.MaxIterations < settings.MinIterations) {
+            throw std::invalid_argument("--max-iterations must not be less than --min-iterations");
+        }
+        settings.MinTime = std::chrono::milliseconds(program.get<size_t>("--min-time-ms"));
+        output = program.get("--output");
+        label = program.get("--label");
+    } catch (const std::exception& err) {
+        DOA_LOG_FATAL("FATAL ERROR: %s\n", err.what());
+        std::cerr << program << std::endl;
+        std::exit(1);
+    }
+    //- Parse Command Line Arguments -//
+
+    Core::CreateHeadlessCore();
+
+    BenchmarkRunner runner{ settings };
+    RunUtilitySuite(runner);
+    RunSceneSuite(runner);
+    RunAssetSuite(runner);
+
+    Core::DestroyCore();
+
+    // Written to a file, debug builds log to stdout.
+    std::ofstream report(output, std::ofstream::trunc);
+    if (!report) {
+        DOA_LOG_FATAL("Could not write benchmark report to %s", output.c_str());
+        return 1;
+    }
+    report << runner.ToJSON(label);
+    DOA_LOG_INFO("Wrote %zu benchmark results to %s", runner.Results().size(), output.c_str());
+    return 0;
+}
@@ -34,6 +34,7 @@ void AssetManager::Render() {
     GUI& gui = this->gui;
 
     RenderMenuBar();
+    thumbnails.Update();
 
     currentFolderContentSettings.minWidth = currentFolderContentSettings.thumbnailSize + 48 + currentFolderContentSettings.itemPadding;
     currentFolderContentSettings.currentWidth = ImGui::GetContentRegionAvail().x - treeViewSettings.currentWidth;
@@ -238,11 +239,11 @@ void AssetManager::RenderSelectedFolderContent() {
             if (searchQueryStartIndex >= 0) {
                 // Draw Icon
                 float iconSize = ImGui::GetTextLineHeight();
-                void* icon = gui.GetMetaInfoOf(file).GetSVGIcon();
+                SVGIcon icon = gui.GetMetaInfoOf(file).GetSVGIcon();
                 ImVec2 start = ImGui::GetWindowPos() + ImGui::GetCursorPos();
                 ImVec2 end = { start.x + iconSize, start.y + iconSize };
 
-                ImGui::GetWindowDrawList()->AddImage(icon, start, end);
+                ImGui::GetWindowDrawList()->AddImage(icon.TextureID, start, end, icon.UV0, icon.UV1);
                 // Draw Icon
                 ImGui::SetCursorPosX(ImGui::GetCursorPosX() + iconSize + ImGui::GetStyle().ItemSpacing.x);
                 // Draw Selectable Text
@@ -302,10 +303,16 @@ void AssetManager::RenderSelectedFolderContent() {
                 }
                 ImGui::TableSetColumnIndex(i++ % columns);
 
-                void* icon = gui.GetMetaInfoOf(child).GetSVGIcon();
+                SVGIcon icon = gui.GetMetaInfoOf(child).GetSVGIcon();
+                if (!child.IsDirectory() && ImGui::IsRectVisible({ currentFolderContentSettings.thumbnailSize, currentFolderContentSettings.thumbnailSize })) {
+                    AssetHandle handle = assets->FindAssetAt(child);
+                    if (handle.HasValue()) {
+                        icon = thumbnails.Get(*assets, handle.Value(), AssetThumbnails::BucketOf(currentFolderContentSettings.thumbnailSize)).value_or(icon);
+                    }
+                }
 
                 ImGui::PushStyleColor(ImGuiCol_Button, { 0.0f, 0.0f, 0.0f, 0.0f });
-                ImGui::ImageButton(icon, { currentFolderContentSettings.thumbnailSize, currentFolderContentSettings.thumbnailSize });
+                ImGui::ImageButton(icon.TextureID, { currentFolderContentSettings.thumbnailSize, currentFolderContentSettings.thumbnailSize }, icon.UV0, icon.UV1);
                 if (ImGui::BeginDragDropSource(ImGuiDragDropFlags_None)) {
                     assert(assets->IsAssetExistsAt(child));
                     dragDropAssetID = assets->FindAssetAt(child)->ID();
@@ -376,7 +383,7 @@ void AssetManager::RenderSelectedFolderContent() {
                 bool visible = fileFilter.CheckVisibility(child);
                 if (!visible) { continue; }
 
-                void* icon = gui.GetMetaInfoOf(child).GetSVGIcon();
+                SVGIcon icon = gui.GetMetaInfoOf(child).GetSVGIcon();
 
                 if (ImGui::TreeNodeEx(child.Name().data(), ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_Leaf)) {
                     if (ImGui::IsItemHovered()) {
@@ -393,7 +400,7 @@ void AssetManager::RenderSelectedFolderContent() {
                 float textHeight = ImGui::GetTextLineHeight();
                 ImVec2 min = ImGui::GetItemRectMin();
                 ImVec2 max = { min.x + textHeight, min.y + textHeight };
-                ImGui::GetWindowDrawList()->AddImage(icon, min, max);
+                ImGui::GetWindowDrawList()->AddImage(icon.TextureID, min, max, icon.UV0, icon.UV1);
             }
         }
     }
@@ -564,6 +571,7 @@ void AssetManager::OnProjectLoaded([[maybe_unused]] Project& project) {
     SetCurrentFolder(root);
 }
 void AssetManager::OnProjectUnloaded() {
+    thumbnails.Clear();
     hasContent = false;
     assets = nullptr;
     root = nullptr;
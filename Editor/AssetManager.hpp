@@ -8,6 +8,8 @@
 
 #include <Engine/Shader.hpp>
 
+#include <Editor/AssetThumbnails.hpp>
+
 struct GUI;
 struct Assets;
 struct FNode;
@@ -36,6 +38,7 @@ private:
     FNode* currentFolder{ nullptr };
     FNode* deletedNode{ nullptr };
     UUID dragDropAssetID{};
+    AssetThumbnails thumbnails{};
 
     struct TreeViewSettings {
         float currentWidth = 120.0f;
@@ -0,0 +1,379 @@
+#include <Editor/AssetThumbnails.hpp>
+
+#include <cmath>
+#include <format>
+#include <thread>
+#include <algorithm>
+
+#include <stb_image.h>
+
+#include <Engine/Log.hpp>
+#include <Engine/Core.hpp>
+#include <Engine/Asset.hpp>
+#include <Engine/Assets.hpp>
+#include <Engine/TransformComponent.hpp>
+
+namespace {
+    constexpr std::byte ToByte(float value) noexcept {
+        return static_cast<std::byte>(static_cast<int>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f));
+    }
+    constexpr float ToFloat(std::byte value) noexcept {
+        return static_cast<float>(value) / 255.0f;
+    }
+
+    /* Box filters an RGBA image so that it fits into a size x size square, keeping the aspect ratio. */
+    std::vector<std::byte> Downsample(const unsigned char* pixels, int width, int height, int size, int& outWidth, int& outHeight) {
+        float scale = std::min(1.0f, static_cast<float>(size) / static_cast<float>(std::max(width, height)));
+        outWidth = std::max(1, static_cast<int>(width * scale));
+        outHeight = std::max(1, static_cast<int>(height * scale));
+
+        std::vector<std::byte> rv(static_cast<size_t>(outWidth) * outHeight * 4);
+        for (int y = 0; y < outHeight; y++) {
+            int y0 = y * height / outHeight;
+            int y1 = std::max(y0 + 1, (y + 1) * height / outHeight);
+            for (int x = 0; x < outWidth; x++) {
+                int x0 = x * width / outWidth;
+                int x1 = std::max(x0 + 1, (x + 1) * width / outWidth);
+                std::array<uint32_t, 4> sum{};
+                for (int sy = y0; sy < y1; sy++) {
+                    const unsigned char* row = pixels + (static_cast<size_t>(sy) * width + x0) * 4;
+                    for (int sx = x0; sx < x1; sx++, row += 4) {
+                        sum[0] += row[0]; sum[1] += row[1]; sum[2] += row[2]; sum[3] += row[3];
+                    }
+                }
+                uint32_t count = static_cast<uint32_t>((y1 - y0) * (x1 - x0));
+                std::byte* out = rv.data() + (static_cast<size_t>(y) * outWidth + x) * 4;
+                for (int c = 0; c < 4; c++) {
+                    out[c] = static_cast<std::byte>(sum[c] / count);
+                }
+            }
+        }
+        return rv;
+    }
+
+    /* Decodes the image at path top row first, regardless of the flip state the engine set for its own loads. */
+    std::vector<std::byte> LoadDownsampled(const std::filesystem::path& path, int size, int& width, int& height) {
+        stbi_set_flip_vertically_on_load_thread(false);
+        int w, h, channels;
+        unsigned char* pixels = stbi_load(path.string().c_str(), &w, &h, &channels, STBI_rgb_alpha);
+        if (pixels == nullptr) { return {}; }
+        std::vector<std::byte> rv = Downsample(pixels, w, h, size, width, height);
+        stbi_image_free(pixels);
+        return rv;
+    }
+
+    /* Centers a width x height image in a transparent size x size square. */
+    std::vector<std::byte> PadToSquare(const std::vector<std::byte>& pixels, int width, int height, int size) {
+        std::vector<std::byte> rv(static_cast<size_t>(size) * size * 4);
+        int offsetX = (size - width) / 2;
+        int offsetY = (size - height) / 2;
+        for (int y = 0; y < height; y++) {
+            std::copy_n(pixels.data() + static_cast<size_t>(y) * width * 4, static_cast<size_t>(width) * 4, rv.data() + (static_cast<size_t>(y + offsetY) * size + offsetX) * 4);
+        }
+        return rv;
+    }
+}
+
+AssetThumbnails::~AssetThumbnails() noexcept { Clear(); }
+
+int AssetThumbnails::BucketOf(float thumbnailSize) noexcept {
+    for (int bucket : SIZE_BUCKETS) {
+        if (thumbnailSize <= bucket) { return bucket; }
+    }
+    return SIZE_BUCKETS.back();
+}
+
+void AssetThumbnails::Update() {
+    if (job == nullptr) return;
+
+    std::vector<Image> finished;
+    {
+        std::lock_guard<std::mutex> lock(job->Mutex);
+        int count = std::min(static_cast<int>(job->Finished.size()), MAX_UPLOADS_PER_FRAME);
+        std::move(job->Finished.begin(), job->Finished.begin() + count, std::back_inserter(finished));
+        job->Finished.erase(job->Finished.begin(), job->Finished.begin() + count);
+    }
+    for (auto& image : finished) {
+        pending.erase(image.Target);
+        Upload(std::move(image));
+    }
+    Evict();
+
+    if (!pending.empty() || !finished.empty()) {
+        Core::GetCore()->RequestRedraw();
+    }
+}
+
+std::optional<SVGIcon> AssetThumbnails::Get(const Assets& assets, const Asset& asset, int bucket) {
+    if (!asset.IsTexture() && !asset.IsMaterial() && !asset.IsScene()) { return std::nullopt; }
+
+    Key key{ asset.ID(), asset.Version(), bucket };
+    if (asset.IsMaterial() && asset.HasDeserializedData()) {
+        /* a material thumbnail shows its texture, so a reimported texture must invalidate it too */
+        for (const auto& uniform : asset.DataAs<Material>().FragmentUniforms.GetAll()) {
+            if (const auto* sampler = std::get_if<UniformSampler2D>(&uniform.Value)) {
+                AssetHandle texture = assets.FindAsset(sampler->textureUUID);
+                if (texture.HasValue()) { key.Version = key.Version * 31 + texture->Version(); }
+                break;
+            }
+        }
+    }
+
+    if (auto it = entries.find(key); it != entries.end()) {
+        return Touch(it->second);
+    }
+    if (!pending.contains(key) && !failed.contains(key)) {
+        Request request;
+        if (MakeRequest(assets, asset, key, request)) {
+            pending.insert(key);
+            Enqueue(std::move(request));
+        }
+    }
+    for (int other : SIZE_BUCKETS) {
+        if (auto it = entries.find({ key.ID, key.Version, other }); it != entries.end()) {
+            return Touch(it->second);
+        }
+    }
+    return std::nullopt;
+}
+
+void AssetThumbnails::Clear() {
+    if (job != nullptr) {
+        {
+            std::lock_guard<std::mutex> lock(job->Mutex);
+            job->Canceled = true;
+        }
+        job->Wakeup.notify_all();
+
+        // the worker owns the job now and exits on its own
+        job = nullptr;
+    }
+    pending.clear();
+    failed.clear();
+    entries.clear();
+    uses.clear();
+    memoryUsage = 0;
+}
+
+size_t AssetThumbnails::MemoryUsage() const noexcept { return memoryUsage; }
+size_t AssetThumbnails::ResidentCount() const noexcept { return entries.size(); }
+
+size_t AssetThumbnails::KeyHasher::operator()(const Key& key) const noexcept {
+    size_t hash = std::hash<UUID>()(key.ID);
+    hash ^= std::hash<uint64_t>()(key.Version) + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<int>()(key.Bucket) + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+bool AssetThumbnails::MakeRequest(const Assets& assets, const Asset& asset, Key key, Request& request) const {
+    request.Target = key;
+    if (asset.IsTexture()) {
+        request.Type = Kind::Texture;
+        request.ImagePath = asset.File().AbsolutePath();
+        return true;
+    }
+    if (!asset.HasDeserializedData()) { return false; }
+
+    if (asset.IsMaterial()) {
+        request.Type = Kind::Material;
+        bool hasTint{ false };
+        bool hasTexture{ false };
+        for (const auto& uniform : asset.DataAs<Material>().FragmentUniforms.GetAll()) {
+            if (!hasTint) {
+                if (const auto* color = std::get_if<Uniform4f>(&uniform.Value)) {
+                    request.Tint = { color->r, color->g, color->b, color->a };
+                    hasTint = true;
+                } else if (const auto* color = std::get_if<Uniform3f>(&uniform.Value)) {
+                    request.Tint = { color->r, color->g, color->b, 1.0f };
+                    hasTint = true;
+                }
+            }
+            if (!hasTexture) {
+                if (const auto* sampler = std::get_if<UniformSampler2D>(&uniform.Value)) {
+                    AssetHandle texture = assets.FindAsset(sampler->textureUUID);
+                    if (texture.HasValue() && texture->IsTexture()) {
+                        request.ImagePath = texture->File().AbsolutePath();
+                    }
+                    hasTexture = true;
+                }
+            }
+        }
+        return true;
+    }
+    if (asset.IsScene()) {
+        /* a plan view of the scene: the clear color with every entity plotted on the XZ plane */
+        request.Type = Kind::Scene;
+        const Scene& scene = asset.DataAs<Scene>();
+        request.Tint = scene.ClearColor;
+        for (Entity entity : scene.GetAllEntites()) {
+            if (request.Points.size() >= MAX_SCENE_POINTS) { break; }
+            if (!scene.HasComponent<TransformComponent>(entity)) { continue; }
+            glm::vec3 translation = TransformComponent::ComputeWorldTranslation(entity, scene);
+            request.Points.emplace_back(translation.x, translation.z);
+        }
+        return true;
+    }
+    return false;
+}
+
+void AssetThumbnails::Enqueue(Request&& request) {
+    if (job == nullptr) {
+        job = std::make_shared<Job>();
+        std::thread(&AssetThumbnails::Run, job).detach();
+    }
+    {
+        std::lock_guard<std::mutex> lock(job->Mutex);
+        job->Requests.push_back(std::move(request));
+    }
+    job->Wakeup.notify_one();
+}
+
+void AssetThumbnails::Upload(Image&& image) {
+    if (image.Pixels.empty()) {
+        failed.insert(image.Target);
+        return;
+    }
+
+    GPUTextureBuilder builder;
+    builder.SetName(std::format("!!asset_thumbnail_{}_{}!!", static_cast<uint64_t>(image.Target.ID), image.Target.Bucket))
+        .SetWidth(image.Width)
+        .SetHeight(image.Height)
+        .SetData(DataFormat::RGBA8, image.Pixels);
+    auto [tex, _] = builder.Build();
+    if (!tex) {
+        DOA_LOG_WARNING("Could not upload thumbnail of asset %s", image.Target.ID.AsString().c_str());
+        failed.insert(image.Target);
+        return;
+    }
+
+    uses.push_front(image.Target);
+    entries.insert_or_assign(image.Target, Entry{ std::move(tex.value()), image.Width, image.Height, uses.begin() });
+    memoryUsage += image.Pixels.size();
+}
+
+void AssetThumbnails::Evict() {
+    while (memoryUsage > MEMORY_BUDGET && !uses.empty()) {
+        auto it = entries.find(uses.back());
+        assert(it != entries.end());
+        memoryUsage -= static_cast<size_t>(it->second.Width) * it->second.Height * 4;
+        entries.erase(it);
+        uses.pop_back();
+    }
+}
+
+SVGIcon AssetThumbnails::Touch(Entry& entry) {
+    uses.splice(uses.begin(), uses, entry.Use);
+    return { entry.Texture, { 0.0f, 0.0f }, { 1.0f, 1.0f } };
+}
+
+void AssetThumbnails::Run(std::shared_ptr<Job> job) {
+    while (true) {
+        Request request;
+        {
+            std::unique_lock<std::mutex> lock(job->Mutex);
+            job->Wakeup.wait(lock, [&job] { return job->Canceled || !job->Requests.empty(); });
+            if (job->Canceled) { return; }
+            request = std::move(job->Requests.front());
+            job->Requests.pop_front();
+        }
+
+        Image image = Generate(*job, request);
+        if (job->Canceled) { return; }
+
+        std::lock_guard<std::mutex> lock(job->Mutex);
+        job->Finished.push_back(std::move(image));
+    }
+}
+
+AssetThumbnails::Image AssetThumbnails::Generate(const Job& job, const Request& request) {
+    Image rv{ request.Target };
+    const int size = request.Target.Bucket;
+
+    if (request.Type == Kind::Texture) {
+        int width{}, height{};
+        std::vector<std::byte> pixels = LoadDownsampled(request.ImagePath, size, width, height);
+        if (pixels.empty() || job.Canceled) { return rv; }
+        rv.Width = size;
+        rv.Height = size;
+        rv.Pixels = PadToSquare(pixels, width, height, size);
+        return rv;
+    }
+
+    rv.Width = size;
+    rv.Height = size;
+    rv.Pixels.resize(static_cast<size_t>(size) * size * 4);
+
+    if (request.Type == Kind::Material) {
+        /* a lit sphere, tinted by the first color uniform and wrapped with the first sampler's texture */
+        int texWidth{}, texHeight{};
+        std::vector<std::byte> texture;
+        if (!request.ImagePath.empty()) {
+            texture = LoadDownsampled(request.ImagePath, size, texWidth, texHeight);
+            if (job.Canceled) { return rv; }
+        }
+        const glm::vec3 light = glm::normalize(glm::vec3{ -0.4f, -0.5f, 0.75f });
+        const glm::vec3 half = glm::normalize(light + glm::vec3{ 0.0f, 0.0f, 1.0f });
+        for (int y = 0; y < size; y++) {
+            for (int x = 0; x < size; x++) {
+                float nx = 2.0f * (x + 0.5f) / size - 1.0f;
+                float ny = 2.0f * (y + 0.5f) / size - 1.0f;
+                float r2 = nx * nx + ny * ny;
+                float coverage = std::clamp((1.0f - std::sqrt(r2)) * size * 0.5f, 0.0f, 1.0f);
+                if (coverage <= 0.0f) { continue; }
+
+                glm::vec3 normal{ nx, ny, std::sqrt(std::max(0.0f, 1.0f - r2)) };
+                glm::vec4 albedo{ request.Tint.r, request.Tint.g, request.Tint.b, request.Tint.a };
+                if (!texture.empty()) {
+                    int tx = std::min(texWidth - 1, static_cast<int>((nx * 0.5f + 0.5f) * texWidth));
+                    int ty = std::min(texHeight - 1, static_cast<int>((ny * 0.5f + 0.5f) * texHeight));
+                    const std::byte* texel = texture.data() + (static_cast<size_t>(ty) * texWidth + tx) * 4;
+                    albedo *= glm::vec4{ ToFloat(texel[0]), ToFloat(texel[1]), ToFloat(texel[2]), ToFloat(texel[3]) };
+                }
+                float diffuse = 0.2f + 0.8f * std::max(glm::dot(normal, light), 0.0f);
+                float specular = 0.3f * std::pow(std::max(glm::dot(normal, half), 0.0f), 32.0f);
+
+                std::byte* out = rv.Pixels.data() + (static_cast<size_t>(y) * size + x) * 4;
+                out[0] = ToByte(albedo.r * diffuse + specular);
+                out[1] = ToByte(albedo.g * diffuse + specular);
+                out[2] = ToByte(albedo.b * diffuse + specular);
+                out[3] = ToByte(std::max(albedo.a, 0.25f) * coverage);
+            }
+        }
+        return rv;
+    }
+
+    if (request.Type == Kind::Scene) {
+        const std::array<std::byte, 4> background{ ToByte(request.Tint.r), ToByte(request.Tint.g), ToByte(request.Tint.b), std::byte{ 255 } };
+        for (size_t i = 0; i < rv.Pixels.size(); i += 4) {
+            std::copy(background.begin(), background.end(), rv.Pixels.begin() + i);
+        }
+        if (request.Points.empty()) { return rv; }
+
+        glm::vec2 min = request.Points.front();
+        glm::vec2 max = request.Points.front();
+        for (const auto& point : request.Points) {
+            min = glm::min(min, point);
+            max = glm::max(max, point);
+        }
+        const float margin = size * 0.125f;
+        const glm::vec2 extent = glm::max(max - min, glm::vec2{ 1e-3f });
+        const float scale = (size - 2.0f * margin) / std::max(extent.x, extent.y);
+        const glm::vec2 offset = glm::vec2{ size * 0.5f } - (min + max) * 0.5f * scale;
+
+        float luminance = 0.2126f * request.Tint.r + 0.7152f * request.Tint.g + 0.0722f * request.Tint.b;
+        const std::byte dot = luminance > 0.5f ? std::byte{ 0 } : std::byte{ 255 };
+        for (const auto& point : request.Points) {
+            glm::ivec2 center = glm::ivec2(point * scale + offset);
+            for (int y = center.y - 1; y <= center.y + 1; y++) {
+                for (int x = center.x - 1; x <= center.x + 1; x++) {
+                    if (x < 0 || y < 0 || x >= size || y >= size) { continue; }
+                    std::byte* out = rv.Pixels.data() + (static_cast<size_t>(y) * size + x) * 4;
+                    out[0] = out[1] = out[2] = dot;
+                }
+            }
+        }
+        return rv;
+    }
+
+    return rv;
+}
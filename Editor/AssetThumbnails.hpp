@@ -0,0 +1,121 @@
+#pragma once
+
+#include <list>
+#include <array>
+#include <mutex>
+#include <deque>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <optional>
+#include <cstdint>
+#include <filesystem>
+#include <unordered_map>
+#include <unordered_set>
+#include <condition_variable>
+
+#include <glm/glm.hpp>
+
+#include <Engine/UUID.hpp>
+#include <Engine/Color.hpp>
+#include <Engine/GPUTexture.hpp>
+
+#include <Editor/SVGPathway.hpp>
+
+struct Asset;
+struct Assets;
+
+/* Thumbnails for texture, material and scene assets, shown in the asset manager's icon view.
+Images are generated on a worker thread from a snapshot taken on the main thread, uploaded a few per frame
+and kept in an LRU of GPU textures bounded by MEMORY_BUDGET. Entries are keyed by asset id, asset version
+and size bucket, so a reimported asset or a zoom change simply misses the cache and gets regenerated. */
+struct AssetThumbnails {
+
+    static constexpr size_t MEMORY_BUDGET{ 32 * 1024 * 1024 };
+    static constexpr int MAX_UPLOADS_PER_FRAME{ 4 };
+    static constexpr int MAX_SCENE_POINTS{ 4096 };
+    static constexpr std::array<int, 3> SIZE_BUCKETS{ 48, 64, 96 };
+
+    AssetThumbnails() noexcept = default;
+    ~AssetThumbnails() noexcept;
+    AssetThumbnails(const AssetThumbnails&) = delete;
+    AssetThumbnails(AssetThumbnails&&) = delete;
+    AssetThumbnails& operator=(const AssetThumbnails&) = delete;
+    AssetThumbnails& operator=(AssetThumbnails&&) = delete;
+
+    static int BucketOf(float thumbnailSize) noexcept;
+
+    /* Call once per frame, uploads finished thumbnails within the per frame budget. */
+    void Update();
+
+    /* Returns the thumbnail of asset if one is resident, queueing its generation otherwise. Only call this
+    for visible cells. While the requested bucket is generated, a resident thumbnail of another bucket is
+    returned instead. Assets without a thumbnail kind return std::nullopt, use their SVG icon. */
+    std::optional<SVGIcon> Get(const Assets& assets, const Asset& asset, int bucket);
+
+    void Clear();
+
+    size_t MemoryUsage() const noexcept;
+    size_t ResidentCount() const noexcept;
+
+private:
+    struct Key {
+        UUID ID{ UUID::Empty() };
+        uint64_t Version{};
+        int Bucket{};
+
+        bool operator==(const Key&) const noexcept = default;
+    };
+    struct KeyHasher {
+        size_t operator()(const Key& key) const noexcept;
+    };
+
+    enum class Kind {
+        Texture,
+        Material,
+        Scene
+    };
+    /* Everything the worker needs, copied out of the asset on the main thread. */
+    struct Request {
+        Key Target{};
+        Kind Type{};
+        std::filesystem::path ImagePath{};
+        Color Tint{ 1, 1, 1, 1 };
+        std::vector<glm::vec2> Points{};
+    };
+    struct Image {
+        Key Target{};
+        int Width{};
+        int Height{};
+        std::vector<std::byte> Pixels{};
+    };
+    struct Job {
+        std::atomic_bool Canceled{ false };
+        std::mutex Mutex;
+        std::condition_variable Wakeup;
+        std::deque<Request> Requests;
+        std::vector<Image> Finished;
+    };
+    struct Entry {
+        GPUTexture Texture;
+        int Width{};
+        int Height{};
+        std::list<Key>::iterator Use;
+    };
+
+    std::shared_ptr<Job> job{ nullptr };
+    std::unordered_set<Key, KeyHasher> pending{};
+    std::unordered_set<Key, KeyHasher> failed{};
+    std::unordered_map<Key, Entry, KeyHasher> entries{};
+    std::list<Key> uses{};
+    size_t memoryUsage{ 0 };
+
+    bool MakeRequest(const Assets& assets, const Asset& asset, Key key, Request& request) const;
+    void Enqueue(Request&& request);
+    void Upload(Image&& image);
+    void Evict();
+    SVGIcon Touch(Entry& entry);
+
+    static void Run(std::shared_ptr<Job> job);
+    static Image Generate(const Job& job, const Request& request);
+};
@@ -254,6 +254,9 @@ void CodeEditor::EditorTab::SaveChanges() {
 
 void CodeEditor::EditorTab::Render() {
     textEditor.Render(tabName.c_str(), false, { 0, -ImGui::GetTextLineHeight() });
+    if (textEditor.IsColorizing()) {
+        Core::GetCore()->RequestRedraw(); // colorizing is time sliced, keep frames coming until it is done
+    }
     auto cpos = textEditor.GetCursorPosition();
     ImGui::Text(
         "Ln:%d   Ch:%d   |   %d lines   |   %s   |   %s   |   %s",
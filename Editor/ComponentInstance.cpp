@@ -27,7 +27,7 @@ void ComponentInstance::Field::Reset() {
 
 ComponentInstance::ComponentInstance(AssetHandle componentAsset) noexcept :
     componentAsset(componentAsset) {
-    componentAsset->AddObserver(*this);
+    Subscribe();
     if (componentAsset->HasDeserializedData()) {
         FillData(componentAsset->DataAs<Component>().fields, memberValues);
     } else {
@@ -36,7 +36,7 @@ ComponentInstance::ComponentInstance(AssetHandle componentAsset) noexcept :
 }
 ComponentInstance::ComponentInstance(AssetHandle componentAsset, std::vector<Field>&& data) noexcept :
     componentAsset(componentAsset) {
-    componentAsset->AddObserver(*this);
+    Subscribe();
     memberValues = std::move(data);
     if (componentAsset->HasDeserializedData()) {
         ReConstructData(componentAsset->DataAs<Component>().fields, memberValues);
@@ -48,10 +48,27 @@ ComponentInstance::ComponentInstance(UUID supposedAssetID, InstantiationError er
     componentAsset(nullptr),
     error(error),
     supposedAssetID(supposedAssetID) {}
-ComponentInstance::~ComponentInstance() noexcept {
-    if (componentAsset.HasValue()) {
-        componentAsset->RemoveObserver(*this);
-    }
+ComponentInstance::~ComponentInstance() noexcept { Unsubscribe(); }
+ComponentInstance::ComponentInstance(ComponentInstance&& other) noexcept :
+    componentAsset(other.componentAsset),
+    memberValues(std::move(other.memberValues)),
+    error(other.error),
+    supposedAssetID(other.supposedAssetID) {
+    other.Unsubscribe();
+    other.componentAsset.Reset();
+    Subscribe();
+}
+ComponentInstance& ComponentInstance::operator=(ComponentInstance&& other) noexcept {
+    if (this == &other) { return *this; }
+    Unsubscribe();
+    componentAsset = other.componentAsset;
+    memberValues = std::move(other.memberValues);
+    error = other.error;
+    supposedAssetID = other.supposedAssetID;
+    other.Unsubscribe();
+    other.componentAsset.Reset();
+    Subscribe();
+    return *this;
 }
 
 UUID ComponentInstance::ComponentAssetID() const { return componentAsset ? componentAsset->ID() : supposedAssetID; }
@@ -76,26 +93,39 @@ std::string_view ComponentInstance::ErrorString() const {
     }
 }
 
-void ComponentInstance::OnNotify(const ObserverPattern::Observable* source, ObserverPattern::Notification message) {
-    if (message == "moved"_hs) {
-        /* casting-away const is safe here because Assets are never created const */
-        componentAsset = AssetHandle(const_cast<Asset*>(static_cast<const Asset*>(source)));
-    } else if (message == "deserialized"_hs) {
-        /* component has been deserialized, check for compiler errors, */
-        if (componentAsset->HasErrorMessages()) {
-            error = InstantiationError::DEFINITION_COMPILE_ERROR;
-        } else {
-            /* if there aren't any we potentially have new/reorganized fields so we must */
-            /* reorganize/reconstruct our instance data to reflect the changes on component */
-            ReConstructData(componentAsset->DataAs<Component>().fields, memberValues);
-            /* we also must clean-up the error */
-            error = InstantiationError::OK;
-        }
-    } else if (message == "destructed"_hs) {
-        componentAsset = nullptr;
-        error = InstantiationError::DEFINITION_MISSING;
+void ComponentInstance::Subscribe() {
+    if (!componentAsset.HasValue()) { return; }
+    AssetNotificationBus& notifications = componentAsset->Notifications();
+    reloadedListener = notifications.Subscribe<AssetEvent::Reloaded>([this](const AssetEvent::Reloaded&) { OnDefinitionReloaded(); });
+    destructedListener = notifications.Subscribe<AssetEvent::Destructed>([this](const AssetEvent::Destructed&) { OnDefinitionDestructed(); });
+}
+void ComponentInstance::Unsubscribe() {
+    if (!componentAsset.HasValue()) { return; }
+    AssetNotificationBus& notifications = componentAsset->Notifications();
+    notifications.Unsubscribe<AssetEvent::Reloaded>(reloadedListener);
+    notifications.Unsubscribe<AssetEvent::Destructed>(destructedListener);
+}
+
+void ComponentInstance::OnDefinitionReloaded() {
+    /* component has been deserialized during the last frame, its data may have been deleted again since */
+    if (!componentAsset->HasDeserializedData()) {
+        error = InstantiationError::DEFINITION_NOT_DESERIALIZED;
+    } else if (componentAsset->HasErrorMessages()) {
+        /* it has, check for compiler errors, */
+        error = InstantiationError::DEFINITION_COMPILE_ERROR;
+    } else {
+        /* if there aren't any we potentially have new/reorganized fields so we must */
+        /* reorganize/reconstruct our instance data to reflect the changes on component */
+        ReConstructData(componentAsset->DataAs<Component>().fields, memberValues);
+        /* we also must clean-up the error */
+        error = InstantiationError::OK;
     }
 }
+void ComponentInstance::OnDefinitionDestructed() {
+    /* the bus is destroyed along with the asset, nothing left to unsubscribe from */
+    componentAsset = nullptr;
+    error = InstantiationError::DEFINITION_MISSING;
+}
 
 void ComponentInstance::FillData(const std::vector<Component::Field>& fields, std::vector<ComponentInstance::Field>& data) {
     data.clear();
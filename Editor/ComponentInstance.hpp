@@ -5,9 +5,8 @@
 #include <vector>
 #include <string_view>
 
-#include <Utility/ObserverPattern.hpp>
-
 #include <Engine/UUID.hpp>
+#include <Engine/Asset.hpp>
 #include <Engine/Assets.hpp>
 #include <Engine/Component.hpp>
 
@@ -20,7 +19,7 @@ enum class InstantiationError {
     _COUNT
 };
 
-struct ComponentInstance : public ObserverPattern::Observer {
+struct ComponentInstance {
 
     struct Field {
 
@@ -49,11 +48,11 @@ struct ComponentInstance : public ObserverPattern::Observer {
     explicit ComponentInstance(AssetHandle componentAsset) noexcept;
     ComponentInstance(AssetHandle componentAsset, std::vector<Field>&& data) noexcept;
     explicit ComponentInstance(UUID supposedAssetID, InstantiationError error) noexcept;
-    ~ComponentInstance() noexcept override;
+    ~ComponentInstance() noexcept;
     ComponentInstance(const ComponentInstance& other) = delete;
-    ComponentInstance(ComponentInstance&& other) noexcept = default;
+    ComponentInstance(ComponentInstance&& other) noexcept;
     ComponentInstance& operator=(const ComponentInstance& other) = delete;
-    ComponentInstance& operator=(ComponentInstance&& other) noexcept = default;
+    ComponentInstance& operator=(ComponentInstance&& other) noexcept;
 
     UUID ComponentAssetID() const;
     std::vector<Field>& MemberValues();
@@ -63,15 +62,22 @@ struct ComponentInstance : public ObserverPattern::Observer {
     InstantiationError GetError() const;
     std::string_view ErrorString() const;
 
-protected:
-    void OnNotify(const ObserverPattern::Observable* source, ObserverPattern::Notification message) override;
-
 private:
     AssetHandle componentAsset{};
     std::vector<Field> memberValues{};
     InstantiationError error{ InstantiationError::OK };
     UUID supposedAssetID{ UUID::Empty() }; /* only applicable when error != OK */
 
+    /* listeners capture this, so they are re-subscribed whenever the instance moves */
+    AssetNotificationBus::Handle<AssetEvent::Reloaded> reloadedListener{};
+    AssetNotificationBus::Handle<AssetEvent::Destructed> destructedListener{};
+
+    void Subscribe();
+    void Unsubscribe();
+
+    void OnDefinitionReloaded();
+    void OnDefinitionDestructed();
+
     static void FillData(const std::vector<Component::Field>& fields, std::vector<Field>& data);
     static void ReConstructData(const std::vector<Component::Field>& fields, std::vector<Field>& data);
     static void CreateNewEntry(const std::string& type, const std::string& name, std::vector<Field>& data);
@@ -131,7 +131,8 @@ void DisplayTargetRenderer::HandleTargetWhenFile(FNode& file) {
     ImGui::PushStyleColor(ImGuiCol_Button, {});
     auto prePos = ImGui::GetCursorPos();
     auto& meta{ gui.GetMetaInfoOf(file) };
-    if (ImGui::ImageButton(meta.GetSVGIcon(), iconSize)) {
+    SVGIcon icon = meta.GetSVGIcon();
+    if (ImGui::ImageButton(icon.TextureID, iconSize, icon.UV0, icon.UV1)) {
         ImGui::OpenPopup("assetIconCombo");
     }
     auto afterPos = ImGui::GetCursorPos();
@@ -255,7 +256,8 @@ void DisplayTargetRenderer::RenderFolderView(FNode& folder) {
 
             ImGui::TableNextRow();
             ImGui::TableSetColumnIndex(0);
-            ImGui::Image(gui.GetMetaInfoOf(child).GetSVGIcon(TextureSize::SMALL), { 16.0f, 16.0f });
+            SVGIcon icon = gui.GetMetaInfoOf(child).GetSVGIcon(TextureSize::SMALL);
+            ImGui::Image(icon.TextureID, { 16.0f, 16.0f }, icon.UV0, icon.UV1);
             ImGui::TableSetColumnIndex(1);
             ImGui::TextUnformatted(child.FullName().data());
             ImGui::TableSetColumnIndex(2);
@@ -0,0 +1,156 @@
+#include <Editor/EntitySnapshot.hpp>
+
+#include <string>
+#include <cassert>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+
+#include <tinyxml2.h>
+
+#include <Engine/Scene.hpp>
+#include <Engine/SceneSerializer.hpp>
+#include <Engine/SceneDeserializer.hpp>
+
+namespace {
+
+    constexpr std::byte FORMAT_VERSION{ 1 };
+
+    struct Writer {
+        std::vector<std::byte> Nodes{};
+        std::vector<std::string_view> Strings{};
+        std::unordered_map<std::string_view, uint32_t> Indices{};
+
+        void Varint(uint64_t value) {
+            while (value >= 0x80) {
+                Nodes.push_back(static_cast<std::byte>(value | 0x80));
+                value >>= 7;
+            }
+            Nodes.push_back(static_cast<std::byte>(value));
+        }
+        void String(std::string_view string) {
+            auto [itr, inserted] = Indices.try_emplace(string, static_cast<uint32_t>(Strings.size()));
+            if (inserted) {
+                Strings.push_back(string);
+            }
+            Varint(itr->second);
+        }
+        void Element(const tinyxml2::XMLElement& element) {
+            String(element.Name());
+
+            size_t attributeCount{ 0 };
+            for (auto* attribute = element.FirstAttribute(); attribute != nullptr; attribute = attribute->Next()) { attributeCount++; }
+            Varint(attributeCount);
+            for (auto* attribute = element.FirstAttribute(); attribute != nullptr; attribute = attribute->Next()) {
+                String(attribute->Name());
+                String(attribute->Value());
+            }
+
+            // A flag byte, 1 if a string (interned as any other) follows.
+            const char* text = element.GetText();
+            if (text != nullptr) {
+                Nodes.push_back(std::byte{ 1 });
+                String(text);
+            } else {
+                Nodes.push_back(std::byte{ 0 });
+            }
+
+            size_t childCount{ 0 };
+            for (auto* child = element.FirstChildElement(); child != nullptr; child = child->NextSiblingElement()) { childCount++; }
+            Varint(childCount);
+            for (auto* child = element.FirstChildElement(); child != nullptr; child = child->NextSiblingElement()) {
+                Element(*child);
+            }
+        }
+    };
+
+    struct Reader {
+        const std::vector<std::byte>& Blob;
+        size_t Position{ 0 };
+        std::vector<std::string> Strings{};
+
+        uint64_t Varint() {
+            uint64_t value{ 0 };
+            int shift{ 0 };
+            std::byte byte;
+            do {
+                assert(Position < Blob.size());
+                byte = Blob[Position++];
+                value |= static_cast<uint64_t>(byte & std::byte{ 0x7F }) << shift;
+                shift += 7;
+            } while ((byte & std::byte{ 0x80 }) != std::byte{ 0 });
+            return value;
+        }
+        const std::string& String() {
+            const uint64_t index = Varint();
+            assert(index < Strings.size());
+            return Strings[index];
+        }
+        tinyxml2::XMLElement* Element(tinyxml2::XMLDocument& document) {
+            tinyxml2::XMLElement* element = document.NewElement(String().c_str());
+
+            const uint64_t attributeCount = Varint();
+            for (uint64_t i = 0; i < attributeCount; i++) {
+                const std::string& name = String();
+                element->SetAttribute(name.c_str(), String().c_str());
+            }
+
+            if (Blob[Position++] != std::byte{ 0 }) {
+                element->SetText(String().c_str());
+            }
+
+            const uint64_t childCount = Varint();
+            for (uint64_t i = 0; i < childCount; i++) {
+                element->InsertEndChild(Element(document));
+            }
+            return element;
+        }
+    };
+}
+
+EntitySnapshot EntitySnapshot::Capture(const Scene& scene, Entity entity) {
+    assert(scene.ContainsEntity(entity));
+    tinyxml2::XMLPrinter printer;
+    SceneSerializer::Entities::SerializeEntity(printer, scene, entity);
+    tinyxml2::XMLDocument document;
+    document.Parse(printer.CStr());
+
+    Writer writer;
+    writer.Element(*document.RootElement());
+
+    // Layout: version, string table (count, then length + bytes per string), element tree.
+    EntitySnapshot rv;
+    Writer header;
+    header.Nodes.push_back(FORMAT_VERSION);
+    header.Varint(writer.Strings.size());
+    for (std::string_view string : writer.Strings) {
+        header.Varint(string.size());
+        const std::byte* bytes = reinterpret_cast<const std::byte*>(string.data());
+        header.Nodes.insert(header.Nodes.end(), bytes, bytes + string.size());
+    }
+    rv.blob.reserve(header.Nodes.size() + writer.Nodes.size());
+    rv.blob.insert(rv.blob.end(), header.Nodes.begin(), header.Nodes.end());
+    rv.blob.insert(rv.blob.end(), writer.Nodes.begin(), writer.Nodes.end());
+    return rv;
+}
+void EntitySnapshot::Restore(Scene& scene) const {
+    assert(!IsEmpty());
+    Reader reader{ blob };
+    [[maybe_unused]] const std::byte version = blob[reader.Position++];
+    assert(version == FORMAT_VERSION);
+
+    const uint64_t stringCount = reader.Varint();
+    reader.Strings.reserve(stringCount);
+    for (uint64_t i = 0; i < stringCount; i++) {
+        const uint64_t length = reader.Varint();
+        reader.Strings.emplace_back(reinterpret_cast<const char*>(blob.data() + reader.Position), length);
+        reader.Position += length;
+    }
+
+    tinyxml2::XMLDocument document;
+    document.InsertEndChild(reader.Element(document));
+    SceneDeserializer::Entities::DeserializeEntity(*document.RootElement(), scene);
+}
+
+bool EntitySnapshot::IsEmpty() const noexcept { return blob.empty(); }
+size_t EntitySnapshot::Size() const noexcept { return blob.capacity(); }
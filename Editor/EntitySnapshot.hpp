@@ -0,0 +1,27 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+#include <Engine/Entity.hpp>
+
+struct Scene;
+
+/* An entity and all of its components, captured as a compact binary blob for undo. The blob holds the same tree
+the scene serializer writes, but every element name, attribute name and value is stored once in a string table
+and referenced by varint index, so the markup repeated across components (cpp-component, type, value, float...)
+costs a byte or two per use instead of being spelled out. Restoring goes through the scene deserializer, so
+user defined components round-trip exactly like they do on save and load. */
+struct EntitySnapshot {
+
+    EntitySnapshot() noexcept = default;
+
+    static EntitySnapshot Capture(const Scene& scene, Entity entity);
+    void Restore(Scene& scene) const;
+
+    bool IsEmpty() const noexcept;
+    size_t Size() const noexcept;
+
+private:
+    std::vector<std::byte> blob{};
+};
@@ -32,6 +32,11 @@ GUI::GUI(const CorePtr& core) noexcept :
     shortcutHandler.RegisterShortcut(Shortcuts::SaveSceneShortcut,  [this]() { SaveScene();  }, ImGuiInputFlags_RouteGlobal);
     shortcutHandler.RegisterShortcut(Shortcuts::CloseSceneShortcut, [this]() { CloseScene(); }, ImGuiInputFlags_RouteGlobal);
 }
+GUI::~GUI() noexcept {
+    if (!projectPath.empty()) {
+        PublishProjectPresence(ProjectPresence::ClosedTopic);
+    }
+}
 
 void GUI::Prepare() {
     window_flags = ImGuiWindowFlags_MenuBar | ImGuiWindowFlags_NoDocking;
@@ -178,9 +183,12 @@ void GUI::End() {
         meta.SaveImGuiIniSettingsToDisk();
     }
 
-    std::string_view message = request.Receive(ReceiveFlag::DontWait);
-    if (message == "request_project_path") {
-        reply.Send(projectPath);
+    if (IsAnyInputHeld()) {
+        CORE->RequestRedraw(); // held keys and buttons (viewport fly camera, drags) produce no further events
+    }
+
+    if (!projectPath.empty() && std::chrono::steady_clock::now() - lastProjectHeartbeat >= ProjectPresence::HeartbeatInterval) {
+        PublishProjectPresence(ProjectPresence::HeartbeatTopic);
     }
 }
 
@@ -229,11 +237,16 @@ void GUI::OpenProjectFromDisk(const std::string& path) {
     }
 
     projectPath = path;
+    PublishProjectPresence(ProjectPresence::OpenedTopic);
 
     Events.OnProjectLoaded(project);
 }
 
 void GUI::CloseProject() {
+    if (!projectPath.empty()) {
+        PublishProjectPresence(ProjectPresence::ClosedTopic);
+        projectPath.clear();
+    }
     Events.OnProjectUnloaded();
 
     CloseScene();
@@ -319,24 +332,24 @@ ImGuiIO* GUI::IO() const { return io; }
 ImFont* GUI::GetFont() const { return font; }
 ImFont* GUI::GetFontBold() const { return fontBold; }
 
-void* GUI::GetFolderIcon(TextureSize size) const                       { return SVGPathway::Get(FOLDER_ICON_KEY,           TextureStyle::PADDED, size); }
-void* GUI::GetProjectIcon(TextureSize size) const                      { return SVGPathway::Get(PROJECT_ICON_KEY,          TextureStyle::PADDED, size); }
-void* GUI::GetSceneIcon(TextureSize size) const                        { return SVGPathway::Get(SCENE_ICON_KEY,            TextureStyle::PADDED, size); }
-void* GUI::GetComponentIcon(TextureSize size) const                    { return SVGPathway::Get(COMPONENT_ICON_KEY,        TextureStyle::PADDED, size); }
-void* GUI::GetSamplerIcon(TextureSize size) const                      { return SVGPathway::Get(SAMPLER_ICON_KEY,          TextureStyle::PADDED, size); }
-void* GUI::GetTextureIcon(TextureSize size) const                      { return SVGPathway::Get(TEXTURE_ICON_KEY,          TextureStyle::PADDED, size); }
-void* GUI::GetVertexShaderIcon(TextureSize size) const                 { return SVGPathway::Get(VERTEX_SHADER_ICON_KEY,    TextureStyle::PADDED, size); }
-void* GUI::GetTessellationControlShaderIcon(TextureSize size) const    { return SVGPathway::Get(TESS_CTRL_SHADER_ICON_KEY, TextureStyle::PADDED, size); }
-void* GUI::GetTessellationEvaluationShaderIcon(TextureSize size) const { return SVGPathway::Get(TESS_EVAL_SHADER_ICON_KEY, TextureStyle::PADDED, size); }
-void* GUI::GetGeometryShaderIcon(TextureSize size) const               { return SVGPathway::Get(GEOMETRY_SHADER_ICON_KEY,  TextureStyle::PADDED, size); }
-void* GUI::GetFragmentShaderIcon(TextureSize size) const               { return SVGPathway::Get(FRAGMENT_SHADER_ICON_KEY,  TextureStyle::PADDED, size); }
-void* GUI::GetComputeShaderIcon(TextureSize size) const                { return SVGPathway::Get(COMPUTE_SHADER_ICON_KEY,   TextureStyle::PADDED, size); }
-void* GUI::GetMaterialIcon(TextureSize size) const                     { return SVGPathway::Get(MATERIAL_ICON_KEY,         TextureStyle::PADDED, size); }
-void* GUI::GetFrameBufferIcon(TextureSize size) const                  { return SVGPathway::Get(FRAMEBUFFER_ICON_KEY,      TextureStyle::PADDED, size); }
-void* GUI::GetFileIcon(TextureSize size) const                         { return SVGPathway::Get(FILE_ICON_KEY,             TextureStyle::PADDED, size); }
-void* GUI::GetBackArrowIcon(TextureSize size) const                    { return SVGPathway::Get(BACK_ARROW_ICON_KEY,       TextureStyle::PADDED, size); }
-
-void* GUI::FindIconForFileType(const FNode& file, TextureSize size) const {
+SVGIcon GUI::GetFolderIcon(TextureSize size) const                       { return SVGPathway::Get(FOLDER_ICON_KEY,           TextureStyle::PADDED, size); }
+SVGIcon GUI::GetProjectIcon(TextureSize size) const                      { return SVGPathway::Get(PROJECT_ICON_KEY,          TextureStyle::PADDED, size); }
+SVGIcon GUI::GetSceneIcon(TextureSize size) const                        { return SVGPathway::Get(SCENE_ICON_KEY,            TextureStyle::PADDED, size); }
+SVGIcon GUI::GetComponentIcon(TextureSize size) const                    { return SVGPathway::Get(COMPONENT_ICON_KEY,        TextureStyle::PADDED, size); }
+SVGIcon GUI::GetSamplerIcon(TextureSize size) const                      { return SVGPathway::Get(SAMPLER_ICON_KEY,          TextureStyle::PADDED, size); }
+SVGIcon GUI::GetTextureIcon(TextureSize size) const                      { return SVGPathway::Get(TEXTURE_ICON_KEY,          TextureStyle::PADDED, size); }
+SVGIcon GUI::GetVertexShaderIcon(TextureSize size) const                 { return SVGPathway::Get(VERTEX_SHADER_ICON_KEY,    TextureStyle::PADDED, size); }
+SVGIcon GUI::GetTessellationControlShaderIcon(TextureSize size) const    { return SVGPathway::Get(TESS_CTRL_SHADER_ICON_KEY, TextureStyle::PADDED, size); }
+SVGIcon GUI::GetTessellationEvaluationShaderIcon(TextureSize size) const { return SVGPathway::Get(TESS_EVAL_SHADER_ICON_KEY, TextureStyle::PADDED, size); }
+SVGIcon GUI::GetGeometryShaderIcon(TextureSize size) const               { return SVGPathway::Get(GEOMETRY_SHADER_ICON_KEY,  TextureStyle::PADDED, size); }
+SVGIcon GUI::GetFragmentShaderIcon(TextureSize size) const               { return SVGPathway::Get(FRAGMENT_SHADER_ICON_KEY,  TextureStyle::PADDED, size); }
+SVGIcon GUI::GetComputeShaderIcon(TextureSize size) const                { return SVGPathway::Get(COMPUTE_SHADER_ICON_KEY,   TextureStyle::PADDED, size); }
+SVGIcon GUI::GetMaterialIcon(TextureSize size) const                     { return SVGPathway::Get(MATERIAL_ICON_KEY,         TextureStyle::PADDED, size); }
+SVGIcon GUI::GetFrameBufferIcon(TextureSize size) const                  { return SVGPathway::Get(FRAMEBUFFER_ICON_KEY,      TextureStyle::PADDED, size); }
+SVGIcon GUI::GetFileIcon(TextureSize size) const                         { return SVGPathway::Get(FILE_ICON_KEY,             TextureStyle::PADDED, size); }
+SVGIcon GUI::GetBackArrowIcon(TextureSize size) const                    { return SVGPathway::Get(BACK_ARROW_ICON_KEY,       TextureStyle::PADDED, size); }
+
+SVGIcon GUI::FindIconForFileType(const FNode& file, TextureSize size) const {
     assert(HasOpenProject());
 
     if (file.IsDirectory()) { return GetFolderIcon(size); }
@@ -362,7 +375,7 @@ void* GUI::FindIconForFileType(const FNode& file, TextureSize size) const {
     if (asset->IsModel())                                              { return GetSceneIcon(size);                        }
     return GetFileIcon(size);
 }
-void* GUI::FindIconByName(const std::string_view key, TextureSize size) const { return reinterpret_cast<void*>(static_cast<uint64_t>(SVGPathway::Get(std::string(key), TextureStyle::PADDED, size).GLObjectID)); }
+SVGIcon GUI::FindIconByName(const std::string_view key, TextureSize size) const { return SVGPathway::Get(std::string(key), TextureStyle::PADDED, size); }
 
 MetaAssetInfo& GUI::GetMetaInfoOf(const FNode& file) { return meta.GetMetaAssetInfoBank().GetMetaInfoOf(file); }
 MetaAssetInfoBank& GUI::GetMetaAssetInfoBank() noexcept { return meta.GetMetaAssetInfoBank(); }
@@ -391,6 +404,21 @@ void GUI::RedoLastCommand() noexcept {
 bool GUI::CanUndoLastCommand() const noexcept { return history.CanUndo(); }
 bool GUI::CanRedoLastCommand() const noexcept { return history.CanRedo(); }
 
+bool GUI::IsAnyInputHeld() const {
+    if (ImGui::IsAnyMouseDown()) { return true; }
+    for (int key = ImGuiKey_NamedKey_BEGIN; key < ImGuiKey_NamedKey_END; key++) {
+        if (ImGui::IsKeyDown(static_cast<ImGuiKey>(key))) { return true; }
+    }
+    return false;
+}
+
+void GUI::PublishProjectPresence(std::string_view topic) {
+    std::string message{ topic };
+    message.append(projectPath);
+    presence.Send(message, SendFlag::DontWait);
+    lastProjectHeartbeat = std::chrono::steady_clock::now();
+}
+
 // TODO REMOVE ME WHEN IMGUI IMPLEMENTS THIS WORKAROUND AS API FUNC.
 void GUI::ExecuteDockBuilderFocusWorkAround() {
     static int i = -1;
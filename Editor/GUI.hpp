@@ -1,11 +1,13 @@
 #pragma once
 
+#include <chrono>
 #include <optional>
 
 #include <imgui.h>
 
 #include <Utility/ConstexprConcat.hpp>
 #include <Utility/SimpleSocket.hpp>
+#include <Utility/ProjectPresence.hpp>
 #include <Utility/UndoRedoStack.hpp>
 
 #include <Engine/Core.hpp>
@@ -108,6 +110,7 @@ struct GUI {
     float delta{ 0 };
 
     explicit GUI(const CorePtr& core) noexcept;
+    ~GUI() noexcept;
 
     void Prepare();
     void operator() (float delta);
@@ -155,25 +158,25 @@ struct GUI {
     ImFont* GetFont() const;
     ImFont* GetFontBold() const;
 
-    void* GetFolderIcon(TextureSize size = TextureSize::MEDIUM) const;
-    void* GetProjectIcon(TextureSize size = TextureSize::MEDIUM) const;
-    void* GetSceneIcon(TextureSize size = TextureSize::MEDIUM) const;
-    void* GetComponentIcon(TextureSize size = TextureSize::MEDIUM) const;
-    void* GetSamplerIcon(TextureSize size = TextureSize::MEDIUM) const;
-    void* GetTextureIcon(TextureSize size = TextureSize::MEDIUM) const;
-    void* GetVertexShaderIcon(TextureSize size = TextureSize::MEDIUM) const;
-    void* GetTessellationControlShaderIcon(TextureSize size = TextureSize::MEDIUM) const;
-    void* GetTessellationEvaluationShaderIcon(TextureSize size = TextureSize::MEDIUM) const;
-    void* GetGeometryShaderIcon(TextureSize size = TextureSize::MEDIUM) const;
-    void* GetFragmentShaderIcon(TextureSize size = TextureSize::MEDIUM) const;
-    void* GetComputeShaderIcon(TextureSize size = TextureSize::MEDIUM) const;
-    void* GetMaterialIcon(TextureSize size = TextureSize::MEDIUM) const;
-    void* GetFrameBufferIcon(TextureSize size = TextureSize::MEDIUM) const;
-    void* GetFileIcon(TextureSize size = TextureSize::MEDIUM) const;
-    void* GetBackArrowIcon(TextureSize size = TextureSize::MEDIUM) const;
-
-    void* FindIconForFileType(const FNode& file, TextureSize = TextureSize::MEDIUM) const;
-    void* FindIconByName(const std::string_view key, TextureSize size = TextureSize::MEDIUM) const;
+    SVGIcon GetFolderIcon(TextureSize size = TextureSize::MEDIUM) const;
+    SVGIcon GetProjectIcon(TextureSize size = TextureSize::MEDIUM) const;
+    SVGIcon GetSceneIcon(TextureSize size = TextureSize::MEDIUM) const;
+    SVGIcon GetComponentIcon(TextureSize size = TextureSize::MEDIUM) const;
+    SVGIcon GetSamplerIcon(TextureSize size = TextureSize::MEDIUM) const;
+    SVGIcon GetTextureIcon(TextureSize size = TextureSize::MEDIUM) const;
+    SVGIcon GetVertexShaderIcon(TextureSize size = TextureSize::MEDIUM) const;
+    SVGIcon GetTessellationControlShaderIcon(TextureSize size = TextureSize::MEDIUM) const;
+    SVGIcon GetTessellationEvaluationShaderIcon(TextureSize size = TextureSize::MEDIUM) const;
+    SVGIcon GetGeometryShaderIcon(TextureSize size = TextureSize::MEDIUM) const;
+    SVGIcon GetFragmentShaderIcon(TextureSize size = TextureSize::MEDIUM) const;
+    SVGIcon GetComputeShaderIcon(TextureSize size = TextureSize::MEDIUM) const;
+    SVGIcon GetMaterialIcon(TextureSize size = TextureSize::MEDIUM) const;
+    SVGIcon GetFrameBufferIcon(TextureSize size = TextureSize::MEDIUM) const;
+    SVGIcon GetFileIcon(TextureSize size = TextureSize::MEDIUM) const;
+    SVGIcon GetBackArrowIcon(TextureSize size = TextureSize::MEDIUM) const;
+
+    SVGIcon FindIconForFileType(const FNode& file, TextureSize = TextureSize::MEDIUM) const;
+    SVGIcon FindIconByName(const std::string_view key, TextureSize size = TextureSize::MEDIUM) const;
 
     MetaAssetInfo& GetMetaInfoOf(const FNode& file);
     MetaAssetInfoBank& GetMetaAssetInfoBank() noexcept;
@@ -233,8 +236,11 @@ private:
 
     //- Sockets -//
     std::string projectPath;
-    ClientSocket request{ "tcp://localhost:5555", SocketType::Pull };
-    ClientSocket reply{ "tcp://localhost:5556", SocketType::Push };
+    std::chrono::steady_clock::time_point lastProjectHeartbeat{};
+    ClientSocket presence{ ProjectPresence::PublisherAddress, SocketType::Publisher };
+    void PublishProjectPresence(std::string_view topic);
+
+    bool IsAnyInputHeld() const;
 
     // TODO REMOVE ME WHEN IMGUI IMPLEMENTS THIS WORKAROUND AS API FUNC.
     void ExecuteDockBuilderFocusWorkAround();
@@ -3,3 +3,5 @@
 GUICommand::GUICommand(GUI& gui) noexcept : gui(gui) {}
 
 std::string_view GUICommand::GetDescription() const noexcept { return description; }
+
+size_t GUICommand::RetainedBytes() const noexcept { return sizeof(GUICommand) + description.capacity(); }
@@ -18,6 +18,8 @@ struct GUICommand : ICommand {
 
     std::string_view GetDescription() const noexcept;
 
+    size_t RetainedBytes() const noexcept override;
+
 protected:
     GUI& gui;
     std::string description;
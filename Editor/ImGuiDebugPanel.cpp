@@ -6,6 +6,8 @@
 
 #if _DEBUG
 
+#include <chrono>
+
 #include <Editor/TextEditor.hpp>
 #include <Editor/ImGuiExtensions.hpp>
 
@@ -46,12 +48,94 @@ void TextEditor::ImGuiDebugPanel(const std::string& panelName)
 			}
 		}
 	}
+	if (ImGui::CollapsingHeader("Colorizer")) {
+		ImGui::DragFloat("Time budget (ms)", &mColorizerTimeBudget, 0.1f, 0.1f, 16.0f);
+		ImGuiFormattedText("Pending range: [{}, {})", mColorRangeMin < mColorRangeMax ? mColorRangeMin : 0, mColorRangeMax);
+		ImGuiFormattedText("Last frame: {} lines in {:.3f} ms", mColorizedLines, mColorizeTime);
+		static std::string benchmarkText;
+		if (ImGui::Button("Run keystroke benchmark")) {
+			benchmarkText = ColorizerBenchmark();
+		}
+		ImGui::TextUnformatted(benchmarkText.c_str());
+	}
 	if (ImGui::Button("Run unit tests")) {
 		UnitTests();
 	}
 	ImGui::End();
 }
 
+std::string TextEditor::ColorizerBenchmark(int aLineCount, int aKeystrokes) const {
+	TextEditor scratch;
+	if (mLanguageDefinition != nullptr) {
+		scratch.SetLanguageDefinition(*mLanguageDefinition);
+	}
+	scratch.SetColorizerTimeBudget(mColorizerTimeBudget);
+	return scratch.RunColorizerBenchmark(aLineCount, aKeystrokes);
+}
+
+std::string TextEditor::RunColorizerBenchmark(int aLineCount, int aKeystrokes) {
+	using Clock = std::chrono::steady_clock;
+	using Milliseconds = std::chrono::duration<float, std::milli>;
+
+	std::string text;
+	for (int i = 0; i < aLineCount; i++) {
+		if (i % 50 == 0) {
+			text += "/* block comment\n   spanning two lines */\n";
+		}
+		text += "int value" + std::to_string(i) + " = " + std::to_string(i) + " + \"text\"; // trailing comment\n";
+	}
+	SetText(text);
+
+	// runs the colorizer to completion, as if it had unlimited time in a frame
+	const float budget = mColorizerTimeBudget;
+	mColorizerTimeBudget = 1e9f;
+	auto colorizeAll = [this]() {
+		int lines = 0;
+		do {
+			ColorizeInternal();
+			lines += mColorizedLines;
+		} while (mColorRangeMin < mColorRangeMax);
+		return lines;
+	};
+
+	auto begin = Clock::now();
+	colorizeAll();
+	const float fullTime = Milliseconds(Clock::now() - begin).count();
+
+	// plain keystrokes in the middle of the buffer, each one should relex a single line
+	const int line = (int) mLines.size() / 2;
+	float total = 0.0f;
+	float worst = 0.0f;
+	int relexed = 0;
+	for (int i = 0; i < aKeystrokes; i++) {
+		begin = Clock::now();
+		AddGlyphToLine(line, 0, Glyph('x', PaletteIndex::Default));
+		Colorize(line, 1);
+		relexed += colorizeAll();
+		const float elapsed = Milliseconds(Clock::now() - begin).count();
+		total += elapsed;
+		worst = std::max(worst, elapsed);
+	}
+	RemoveGlyphsFromLine(line, 0, aKeystrokes);
+	Colorize(line, 1);
+	colorizeAll();
+
+	// opening a block comment at the top changes the state of every line below it
+	begin = Clock::now();
+	AddGlyphToLine(0, 0, Glyph('*', PaletteIndex::Default));
+	AddGlyphToLine(0, 0, Glyph('/', PaletteIndex::Default));
+	Colorize(0, 1);
+	const int commentRelexed = colorizeAll();
+	const float commentTime = Milliseconds(Clock::now() - begin).count();
+
+	mColorizerTimeBudget = budget;
+
+	return "Full buffer: " + std::to_string(mLines.size()) + " lines in " + std::to_string(fullTime) + " ms\n" +
+		"Keystroke: " + std::to_string(total / aKeystrokes) + " ms average, " + std::to_string(worst) + " ms worst, " +
+		std::to_string(relexed / aKeystrokes) + " lines relexed\n" +
+		"Comment toggle: " + std::to_string(commentRelexed) + " lines relexed in " + std::to_string(commentTime) + " ms";
+}
+
 void TextEditor::UnitTests() {
 	SetText(" \t  \t   \t \t\n");
 	// --- GetCharacterColumn --- //
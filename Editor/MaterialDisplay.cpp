@@ -184,7 +184,7 @@ void MaterialDisplay::RenderShaderUniforms() noexcept {
         RenderUniformGroup(material.VertexUniforms, gpuProgram, ShaderType::Fragment);
     }
 
-    textureView.Render();
+    textureView.Render(*assets);
 }
 
 int MaterialDisplay::CountUniformsInGroup(const GPUShaderProgram& program, ShaderType group) noexcept {
@@ -338,7 +338,7 @@ bool MaterialDisplay::RenderSingleUniform(Material::Uniforms& uniforms, const Un
             }
 
             if (Image2DButtonWidget(uniformValue.Name.c_str(), *gpuTexture)) {
-                textureView.Show(*texture, *gpuTexture);
+                textureView.Show(value.textureUUID);
             }
 
             if (ImGui::BeginPopupContextItem(nullptr, ImGuiPopupFlags_MouseButtonRight)) {
@@ -423,8 +423,17 @@ bool MaterialDisplay::RenderSingleUniform(Material::Uniforms& uniforms, const Un
     return rv;
 }
 
-void MaterialDisplay::TextureView::Render() noexcept {
+void MaterialDisplay::TextureView::Render(Assets& assets) noexcept {
     if (!visible) { return; }
+    const Texture* texture{ &Texture::Missing() };
+    const GPUTexture* gpuTexture{ &assets.GPUBridge().GetTextures().Missing() };
+    AssetHandle handle = assets.FindAsset(this->texture);
+    if (handle && handle->IsTexture()) {
+        if (const GPUTexture* resident = assets.GPUBridge().GetTextures().Query(handle->ID())) {
+            texture = &handle->DataAs<Texture>();
+            gpuTexture = resident;
+        }
+    }
     ImGui::Begin(std::format("Texture View - {}", texture->Name).c_str(), &visible);
     /* channels */
     static bool r{ true }, g{ true }, b{ true }, a{ true };
@@ -483,9 +492,8 @@ void MaterialDisplay::TextureView::Render() noexcept {
     ImGui::SameLine(); ImGui::Text("Histogram:");  ImGui::SameLine(); ImGui::Checkbox("##histogram", &drawHistogram);
     ImGui::End();
 }
-void MaterialDisplay::TextureView::Show(const Texture& texture, const GPUTexture& gpuTexture) noexcept {
+void MaterialDisplay::TextureView::Show(UUID texture) noexcept {
     visible = true;
-    this->texture = &texture;
-    this->gpuTexture = &gpuTexture;
+    this->texture = texture;
 }
 void MaterialDisplay::TextureView::Hide() noexcept { visible = false; }
\ No newline at end of file
@@ -30,13 +30,13 @@ private:
     void RenderUniformGroup(Material::Uniforms& uniforms, const GPUShaderProgram& program, ShaderType group) noexcept;
     bool RenderSingleUniform(Material::Uniforms& uniforms, const UniformValue& value, const GPUShaderProgram::Uniform& uniform) noexcept;
 
+    /* Looks the texture up every frame, its GPUTexture may be evicted and re-allocated while the view is open. */
     struct TextureView {
-        void Render() noexcept;
-        void Show(const Texture& texture, const GPUTexture& gpuTexture) noexcept;
+        void Render(Assets& assets) noexcept;
+        void Show(UUID texture) noexcept;
         void Hide() noexcept;
     private:
         bool visible{ false };
-        const Texture* texture{ nullptr };
-        const GPUTexture* gpuTexture{ nullptr };
+        UUID texture{ UUID::Empty() };
     } textureView;
 };
\ No newline at end of file
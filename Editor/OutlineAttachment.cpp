@@ -1,21 +1,19 @@
 #include <Editor/OutlineAttachment.hpp>
 
 OutlineAttachment::OutlineAttachment(std::shared_ptr<GUI> gui) noexcept :
-    gui(gui)/*,
-    fbo()*/ {}
+    gui(gui) {}
 
 void OutlineAttachment::BeforeFrame(Project* project) {}
 void OutlineAttachment::AfterFrame(Project* project) {
     if (project == nullptr || !project->HasOpenScene()) { return; }
-    //if (gui->sh.selectedEntity == NULL_ENTT) { return; }
 
     Scene& scene = project->GetOpenScene();
-    //Entity entt = gui->sh.selectedEntity;
-    //if (!scene.HasComponent<MeshComponent>(entt)) return;
-    //TransformComponent& transformComponent = scene.GetComponent<TransformComponent>(entt);
-    //MeshComponent& meshComponent = scene.GetComponent<MeshComponent>(entt);
+    SceneViewport& viewport = gui->GetSceneViewport();
+    Entity selected = viewport.gizmos.selectedEntity;
 
-    //fbo.Bind();
-    // Graphics::DrawMesh(meshComponent.mesh, transformComponent.GetWorldMatrix(), solidColorShader, )
-    //glDepthMask(GL_FALSE);
-}
\ No newline at end of file
+    selection.clear();
+    if (selected != NULL_ENTT && scene.ContainsEntity(selected) && scene.HasComponent<TransformComponent>(selected)) {
+        selection.push_back(selected);
+    }
+    viewport.SetOutline(selection, OutlineColor, OutlineWidth);
+}
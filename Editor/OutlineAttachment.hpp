@@ -1,26 +1,31 @@
 #pragma once
 #include <memory>
+#include <vector>
 
 #include <glm/glm.hpp>
 
 #include <Engine/Core.hpp>
+#include <Engine/Entity.hpp>
 #include <Engine/Project.hpp>
-#include <Engine/Resolution.hpp>
 #include <Engine/TransformComponent.hpp>
 
 #include <Editor/GUI.hpp>
 
+/* Outlines the entity selected in the scene viewport. AfterFrame runs once the simulation steps of a frame are
+done and hands the selection to the viewport, which outlines it over the scene it renders later in the frame.
+There are no mesh components yet, the viewport draws its demo cube at every transform and the outline is the
+silhouette of that cube at the selected entity's transform. */
 struct OutlineAttachment {
 
     std::shared_ptr<GUI> gui;
     glm::vec4 OutlineColor{ 1.0f, 1.0f, 1.0f, 1.0f };
-    //FrameBuffer fbo;
-    std::weak_ptr<Shader> solidColorShader;
-    std::weak_ptr<Shader> gaussianBlurShader;
+    float OutlineWidth{ 3.0f };
 
     OutlineAttachment(std::shared_ptr<GUI> gui) noexcept;
 
     void BeforeFrame(Project* project);
     void AfterFrame(Project* project);
-};
 
+private:
+    std::vector<Entity> selection{};
+};
@@ -2,9 +2,6 @@
 
 #include <format>
 
-#include <Engine/SceneSerializer.hpp>
-#include <Engine/SceneDeserializer.hpp>
-
 #include <Editor/GUI.hpp>
 
 RemoveEntityCommand::RemoveEntityCommand(GUI& gui, Entity entity) noexcept :
@@ -13,9 +10,7 @@ RemoveEntityCommand::RemoveEntityCommand(GUI& gui, Entity entity) noexcept :
 
 void RemoveEntityCommand::Execute() noexcept {
     assert(gui.GetOpenScene().ContainsEntity(removedEntity));
-    tinyxml2::XMLPrinter p;
-    SceneSerializer::Entities::SerializeEntity(p, gui.GetOpenScene(), removedEntity);
-    serializedEntity = p.CStr();
+    removedSnapshot = EntitySnapshot::Capture(gui.GetOpenScene(), removedEntity);
 
     gui.GetOpenScene().DeleteEntity(removedEntity);
     gui.Events.OnEntityDeleted(removedEntity);
@@ -24,8 +19,11 @@ void RemoveEntityCommand::Execute() noexcept {
 }
 void RemoveEntityCommand::UnExecute() noexcept {
     assert(!gui.GetOpenScene().ContainsEntity(removedEntity));
-    tinyxml2::XMLDocument d; d.Parse(serializedEntity.c_str());
-    SceneDeserializer::Entities::DeserializeEntity(*d.RootElement(), gui.GetOpenScene());
+    removedSnapshot.Restore(gui.GetOpenScene());
 
     gui.Events.OnEntityCreated(removedEntity);
 }
+
+size_t RemoveEntityCommand::RetainedBytes() const noexcept {
+    return sizeof(RemoveEntityCommand) - sizeof(GUICommand) + GUICommand::RetainedBytes() + removedSnapshot.Size();
+}
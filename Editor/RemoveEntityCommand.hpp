@@ -3,13 +3,16 @@
 #include <Engine/Entity.hpp>
 
 #include <Editor/GUICommand.hpp>
+#include <Editor/EntitySnapshot.hpp>
 
 struct RemoveEntityCommand : GUICommand {
     explicit RemoveEntityCommand(GUI& gui, Entity entity) noexcept;
     void Execute() noexcept override;
     void UnExecute() noexcept override;
 
+    size_t RetainedBytes() const noexcept override;
+
 private:
     Entity removedEntity;
-    std::string serializedEntity;
+    EntitySnapshot removedSnapshot{};
 };
\ No newline at end of file
@@ -12,13 +12,18 @@ RenameEntityCommand::RenameEntityCommand(GUI& gui, Entity entity, std::string_vi
     newName(newName) {}
 
 void RenameEntityCommand::Execute() noexcept {
-    auto& cmp = gui.GetOpenScene().GetComponent<IDComponent>(entity);
-    oldName = cmp.GetTag();
-    cmp.SetTag(newName);
+    // patched rather than mutated, so listeners (e.g. the scene hierarchy) see the rename
+    gui.GetOpenScene().GetRegistry().patch<IDComponent>(entity, [this](IDComponent& cmp) {
+        oldName = cmp.GetTag();
+        cmp.SetTag(newName);
+    });
 
     description = std::format("Rename Entity {} to {}", oldName, newName);
 }
 void RenameEntityCommand::UnExecute() noexcept {
-    auto& cmp = gui.GetOpenScene().GetComponent<IDComponent>(entity);
-    cmp.SetTag(oldName);
+    gui.GetOpenScene().GetRegistry().patch<IDComponent>(entity, [this](IDComponent& cmp) { cmp.SetTag(oldName); });
+}
+
+size_t RenameEntityCommand::RetainedBytes() const noexcept {
+    return sizeof(RenameEntityCommand) - sizeof(GUICommand) + GUICommand::RetainedBytes() + newName.capacity() + oldName.capacity();
 }
@@ -9,6 +9,8 @@ struct RenameEntityCommand : GUICommand {
     void Execute() noexcept override;
     void UnExecute() noexcept override;
 
+    size_t RetainedBytes() const noexcept override;
+
 private:
     Entity entity;
     std::string newName;
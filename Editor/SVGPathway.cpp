@@ -1,11 +1,17 @@
 #include <Editor/SVGPathway.hpp>
 
+#include <span>
+#include <atomic>
+#include <charconv>
 #include <format>
 #include <string>
+#include <thread>
 #include <vector>
+#include <fstream>
 #include <sstream>
 #include <numeric>
 #include <iostream>
+#include <algorithm>
 #include <string_view>
 
 #include <tinyxml2.h>
@@ -15,41 +21,350 @@
 
 #include <Engine/Log.hpp>
 
-void SVGPathway::Initialize(const std::filesystem::path& directory, Color color) {
+namespace {
+    struct RasterizedIcon {
+        bool Valid{ false };
+        std::array<uint32_t, 3> Widths{};
+        std::array<uint32_t, 3> Heights{};
+        std::array<std::vector<std::byte>, 3> Pixels{};
+    };
+
+    constexpr uint64_t FNV_OFFSET_BASIS{ 0xcbf29ce484222325ull };
+    constexpr uint64_t FNV_PRIME{ 0x100000001b3ull };
+    uint64_t HashBytes(uint64_t hash, const void* data, size_t size) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash ^= bytes[i];
+            hash *= FNV_PRIME;
+        }
+        return hash;
+    }
+
+    uint32_t PackColor(Color color) {
+        auto channel = [](float c) { return static_cast<uint32_t>(std::clamp(c, 0.0f, 1.0f) * 255.999f); };
+        return (channel(color.r) << 24) | (channel(color.g) << 16) | (channel(color.b) << 8) | channel(color.a);
+    }
+
+    std::string ReadFile(const std::filesystem::path& path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) { return {}; }
+        std::stringstream ss;
+        ss << file.rdbuf();
+        return ss.str();
+    }
+
+    /* The four numbers of a viewBox attribute, fractional ones included. False if it has a different count or a
+    token is not a number, never throws, so it can run on worker threads. */
+    bool ParseViewBox(const char* viewBox, std::array<float, 4>& box) {
+        if (viewBox == nullptr) { return false; }
+        std::vector<std::string> tokens = split(viewBox, " ");
+        std::erase_if(tokens, [](const std::string& token) { return token.empty(); });
+        if (tokens.size() != box.size()) { return false; }
+        for (size_t i = 0; i < box.size(); i++) {
+            const char* end = tokens[i].data() + tokens[i].size();
+            auto [ptr, ec] = std::from_chars(tokens[i].data(), end, box[i]);
+            if (ec != std::errc{} || ptr != end) { return false; }
+        }
+        return true;
+    }
+
+    /* Recolors the SVG source and parses it. Touches neither the log nor the GPU, so it is safe to run on worker threads. */
+    std::unique_ptr<lunasvg::Document> ParseDocument(const std::string& source, Color color, std::array<float, 4>& box) {
+        tinyxml2::XMLDocument doc;
+        if (doc.Parse(source.c_str(), source.size()) != tinyxml2::XML_SUCCESS) { return nullptr; }
+
+        tinyxml2::XMLElement* rootNode = doc.RootElement();
+        if (rootNode == nullptr) { return nullptr; }
+        std::string colorString("#");
+        colorString += std::format("{:02x}", int(color.r * 255.999));
+        colorString += std::format("{:02x}", int(color.g * 255.999));
+        colorString += std::format("{:02x}", int(color.b * 255.999));
+        for (tinyxml2::XMLElement* node = rootNode->FirstChildElement(); node != nullptr; node = node->NextSiblingElement()) {
+            node->SetAttribute("fill", colorString.c_str());
+        }
+
+        const char* viewBox{ nullptr };
+        rootNode->QueryAttribute("viewBox", &viewBox);
+        if (!ParseViewBox(viewBox, box)) { return nullptr; }
+
+        tinyxml2::XMLPrinter printer;
+        doc.Print(&printer);
+        return lunasvg::Document::loadFromData(printer.CStr());
+    }
+
+    RasterizedIcon Rasterize(const std::string& source, Color color, const std::array<float, 3>& scaleFactors, uint32_t bgColor) {
+        RasterizedIcon rv;
+        std::array<float, 4> box{};
+        std::unique_ptr<lunasvg::Document> lunadoc = ParseDocument(source, color, box);
+        if (!lunadoc) { return rv; }
+
+        for (size_t i = 0; i < scaleFactors.size(); i++) {
+            lunasvg::Bitmap bitmap = lunadoc->renderToBitmap(
+                static_cast<uint32_t>((box[2] - box[0]) * scaleFactors[i]),
+                static_cast<uint32_t>((box[3] - box[1]) * scaleFactors[i]),
+                bgColor
+            );
+            if (!bitmap.valid()) { return rv; }
+            rv.Widths[i] = bitmap.width();
+            rv.Heights[i] = bitmap.height();
+            const auto* begin = reinterpret_cast<const std::byte*>(bitmap.data());
+            rv.Pixels[i].assign(begin, begin + size_t(bitmap.width()) * bitmap.height() * 4);
+        }
+        rv.Valid = true;
+        return rv;
+    }
+
+    template<typename T>
+    void Write(std::ofstream& out, const T& value) { out.write(reinterpret_cast<const char*>(&value), sizeof(T)); }
+    template<typename T>
+    bool Read(std::ifstream& in, T& value) { return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T))); }
+}
+
+void SVGPathway::Initialize(const std::filesystem::path& directory, Color color, const std::vector<std::string>& preloadKeys) {
     SVGPathway::directory = directory;
     SVGPathway::color = color;
     Initialized = true;
+    BuildAtlas(preloadKeys);
 }
-void SVGPathway::Initialize(std::filesystem::path&& directory, Color color) {
+void SVGPathway::Initialize(std::filesystem::path&& directory, Color color, const std::vector<std::string>& preloadKeys) {
     SVGPathway::directory = std::move(directory);
     SVGPathway::color = color;
     Initialized = true;
+    BuildAtlas(preloadKeys);
 }
 
-const GPUTexture& SVGPathway::Get(const std::string& key, const TextureStyle style, const TextureSize size) {
+SVGIcon SVGPathway::Get(const std::string& key, const TextureStyle style, const TextureSize size) {
     assert(Initialized);
+    const size_t index = static_cast<size_t>(size);
+    if (style != TextureStyle::SCALED) {
+        auto it = Atlas.find(key);
+        if (it != Atlas.end()) {
+            const AtlasRegion& region = style == TextureStyle::PADDED ? it->second.Cells[index] : it->second.Tight[index];
+            const AtlasPage& page = Pages[region.Page];
+            return {
+                page.Texture,
+                { static_cast<float>(region.X) / page.Width, static_cast<float>(region.Y) / page.Height },
+                { static_cast<float>(region.X + region.Width) / page.Width, static_cast<float>(region.Y + region.Height) / page.Height }
+            };
+        }
+    }
+
+    /* not in the atlas, fall back to a dedicated texture */
     switch (style) {
     using enum TextureStyle;
     case NONE:
         if (!Textures.contains(key)) {
             Load(key);
         }
-        return Textures.at(key)[static_cast<size_t>(size)];
+        return { Textures.at(key)[index] };
     case PADDED:
         if (!TexturesPadded.contains(key)) {
             Load(key);
         }
-        return TexturesPadded.at(key)[static_cast<size_t>(size)];
+        return { TexturesPadded.at(key)[index] };
     case SCALED:
         if (!TexturesScaled.contains(key)) {
             Load(key);
         }
-        return TexturesScaled.at(key)[static_cast<size_t>(TextureSize::SMALL)]; /* see ref. [1] */
+        return { TexturesScaled.at(key)[static_cast<size_t>(TextureSize::SMALL)] }; /* see ref. [1] */
     }
     assert(false); /* no such texture */
     throw 1;
 }
 
+void SVGPathway::BuildAtlas(const std::vector<std::string>& keys) {
+    assert(Initialized);
+    Pages.clear();
+    Atlas.clear();
+    if (keys.empty()) { return; }
+
+    std::vector<std::string> sources;
+    sources.reserve(keys.size());
+    uint64_t iconSetHash = FNV_OFFSET_BASIS;
+    iconSetHash = HashBytes(iconSetHash, &CACHE_VERSION, sizeof(CACHE_VERSION));
+    iconSetHash = HashBytes(iconSetHash, SCALE_FACTORS.data(), sizeof(SCALE_FACTORS));
+    iconSetHash = HashBytes(iconSetHash, &ATLAS_PAGE_SIZE, sizeof(ATLAS_PAGE_SIZE));
+    iconSetHash = HashBytes(iconSetHash, &ATLAS_GUTTER, sizeof(ATLAS_GUTTER));
+    for (const auto& key : keys) {
+        sources.emplace_back(ReadFile(directory / PATH / (key + EXT)));
+        iconSetHash = HashBytes(iconSetHash, key.data(), key.size() + 1);
+        iconSetHash = HashBytes(iconSetHash, sources.back().data(), sources.back().size());
+    }
+
+    const std::filesystem::path cacheFile = directory / CACHE_PATH / std::format("svg_atlas_{:016x}_{:08x}.bin", iconSetHash, PackColor(color));
+    if (LoadAtlasFromCache(cacheFile, iconSetHash)) {
+        DOA_LOG_TRACE("Loaded SVG atlas from cache: %s", cacheFile.string().c_str());
+        return;
+    }
+
+    // Rasterize on worker threads
+    std::vector<RasterizedIcon> icons(keys.size());
+    {
+        std::atomic_size_t next{ 0 };
+        const size_t workerCount = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, keys.size());
+        std::vector<std::jthread> workers;
+        workers.reserve(workerCount);
+        for (size_t i = 0; i < workerCount; i++) {
+            workers.emplace_back([&]() {
+                for (size_t j = next++; j < sources.size(); j = next++) {
+                    if (sources[j].empty()) { continue; }
+                    icons[j] = Rasterize(sources[j], color, SCALE_FACTORS, RASTER_BG_COLOR);
+                }
+            });
+        }
+    } // workers join here
+
+    // Shelf-pack the square cells, largest first
+    struct Cell { size_t Icon; size_t Size; uint32_t Side; };
+    std::vector<Cell> cells;
+    for (size_t i = 0; i < icons.size(); i++) {
+        if (!icons[i].Valid) {
+            DOA_LOG_WARNING("Could not read SVG: %s", keys[i].c_str());
+            continue;
+        }
+        DOA_LOG_TRACE("Reading SVG: %s", keys[i].c_str());
+        for (size_t s = 0; s < SCALE_FACTORS.size(); s++) {
+            cells.emplace_back(i, s, std::max(icons[i].Widths[s], icons[i].Heights[s]));
+        }
+    }
+    std::stable_sort(cells.begin(), cells.end(), [](const Cell& lhs, const Cell& rhs) { return lhs.Side > rhs.Side; });
+
+    std::vector<std::pair<uint32_t, uint32_t>> pageExtents(1);
+    uint32_t page{ 0 }, x{ ATLAS_GUTTER }, y{ ATLAS_GUTTER }, shelfHeight{ 0 };
+    for (const auto& cell : cells) {
+        assert(cell.Side + 2 * ATLAS_GUTTER <= ATLAS_PAGE_SIZE);
+        if (x + cell.Side + ATLAS_GUTTER > ATLAS_PAGE_SIZE) {
+            x = ATLAS_GUTTER;
+            y += shelfHeight + ATLAS_GUTTER;
+            shelfHeight = 0;
+        }
+        if (y + cell.Side + ATLAS_GUTTER > ATLAS_PAGE_SIZE) {
+            page++;
+            pageExtents.emplace_back();
+            x = ATLAS_GUTTER;
+            y = ATLAS_GUTTER;
+            shelfHeight = 0;
+        }
+
+        const RasterizedIcon& icon = icons[cell.Icon];
+        AtlasEntry& entry = Atlas[keys[cell.Icon]];
+        const uint32_t width = icon.Widths[cell.Size];
+        const uint32_t height = icon.Heights[cell.Size];
+        entry.Cells[cell.Size] = { page, x, y, cell.Side, cell.Side };
+        entry.Tight[cell.Size] = { page, x + (cell.Side - width) / 2, y + (cell.Side - height) / 2, width, height };
+
+        x += cell.Side + ATLAS_GUTTER;
+        shelfHeight = std::max(shelfHeight, cell.Side);
+        pageExtents[page].first = std::max(pageExtents[page].first, x);
+        pageExtents[page].second = std::max(pageExtents[page].second, y + shelfHeight + ATLAS_GUTTER);
+    }
+
+    // Compose the pages
+    std::vector<std::vector<std::byte>> pixels(pageExtents.size());
+    for (size_t i = 0; i < pageExtents.size(); i++) {
+        pixels[i].resize(size_t(pageExtents[i].first) * pageExtents[i].second * 4); /* zero initialized, transparent */
+    }
+    for (const auto& cell : cells) {
+        const RasterizedIcon& icon = icons[cell.Icon];
+        const AtlasRegion& region = Atlas[keys[cell.Icon]].Tight[cell.Size];
+        const size_t pageWidth = pageExtents[region.Page].first;
+        const auto& src = icon.Pixels[cell.Size];
+        auto& dst = pixels[region.Page];
+        for (uint32_t row = 0; row < region.Height; row++) {
+            std::copy_n(src.begin() + size_t(row) * region.Width * 4, size_t(region.Width) * 4,
+                        dst.begin() + ((region.Y + row) * pageWidth + region.X) * 4);
+        }
+    }
+
+    for (uint32_t i = 0; i < pixels.size(); i++) {
+        UploadPage(i, pageExtents[i].first, pageExtents[i].second, pixels[i]);
+    }
+    SaveAtlasToCache(cacheFile, iconSetHash, pixels);
+}
+
+bool SVGPathway::LoadAtlasFromCache(const std::filesystem::path& cacheFile, uint64_t iconSetHash) {
+    std::ifstream in(cacheFile, std::ios::binary);
+    if (!in) { return false; }
+
+    uint32_t magic{}, version{}, packedColor{}, pageCount{}, entryCount{};
+    uint64_t hash{};
+    if (!Read(in, magic) || magic != CACHE_MAGIC) { return false; }
+    if (!Read(in, version) || version != CACHE_VERSION) { return false; }
+    if (!Read(in, hash) || hash != iconSetHash) { return false; }
+    if (!Read(in, packedColor) || packedColor != PackColor(color)) { return false; }
+    if (!Read(in, pageCount)) { return false; }
+
+    std::vector<std::pair<uint32_t, uint32_t>> extents(pageCount);
+    std::vector<std::vector<std::byte>> pixels(pageCount);
+    for (uint32_t i = 0; i < pageCount; i++) {
+        if (!Read(in, extents[i].first) || !Read(in, extents[i].second)) { return false; }
+        if (extents[i].first > ATLAS_PAGE_SIZE || extents[i].second > ATLAS_PAGE_SIZE) { return false; }
+        pixels[i].resize(size_t(extents[i].first) * extents[i].second * 4);
+        if (!in.read(reinterpret_cast<char*>(pixels[i].data()), pixels[i].size())) { return false; }
+    }
+
+    unordered_string_map<AtlasEntry> atlas;
+    if (!Read(in, entryCount)) { return false; }
+    for (uint32_t i = 0; i < entryCount; i++) {
+        uint32_t keyLength{};
+        if (!Read(in, keyLength)) { return false; }
+        std::string key(keyLength, '\0');
+        if (!in.read(key.data(), keyLength)) { return false; }
+        AtlasEntry entry;
+        if (!Read(in, entry)) { return false; }
+        for (size_t s = 0; s < entry.Cells.size(); s++) {
+            if (entry.Cells[s].Page >= pageCount || entry.Tight[s].Page >= pageCount) { return false; }
+        }
+        atlas.emplace(std::move(key), entry);
+    }
+
+    Atlas = std::move(atlas);
+    for (uint32_t i = 0; i < pageCount; i++) {
+        UploadPage(i, extents[i].first, extents[i].second, pixels[i]);
+    }
+    return true;
+}
+
+void SVGPathway::SaveAtlasToCache(const std::filesystem::path& cacheFile, uint64_t iconSetHash, const std::vector<std::vector<std::byte>>& pixels) {
+    std::error_code ec;
+    std::filesystem::create_directories(cacheFile.parent_path(), ec);
+    std::ofstream out(cacheFile, std::ios::binary | std::ios::trunc);
+    if (ec || !out) {
+        DOA_LOG_WARNING("Could not write SVG atlas cache: %s", cacheFile.string().c_str());
+        return;
+    }
+
+    Write(out, CACHE_MAGIC);
+    Write(out, CACHE_VERSION);
+    Write(out, iconSetHash);
+    Write(out, PackColor(color));
+    Write(out, static_cast<uint32_t>(Pages.size()));
+    for (size_t i = 0; i < Pages.size(); i++) {
+        Write(out, Pages[i].Width);
+        Write(out, Pages[i].Height);
+        out.write(reinterpret_cast<const char*>(pixels[i].data()), pixels[i].size());
+    }
+    Write(out, static_cast<uint32_t>(Atlas.size()));
+    for (const auto& [key, entry] : Atlas) {
+        Write(out, static_cast<uint32_t>(key.size()));
+        out.write(key.data(), key.size());
+        Write(out, entry);
+    }
+}
+
+void SVGPathway::UploadPage(uint32_t index, uint32_t width, uint32_t height, const std::vector<std::byte>& pixels) {
+    GPUTextureBuilder builder;
+    builder.SetName(std::format("!!svg_atlas_{}!!", index))
+        .SetWidth(width)
+        .SetHeight(height)
+        .SetData(DataFormat::RGBA8, pixels);
+    auto [tex, _] = builder.Build();
+    if (!tex) {
+        DOA_LOG_WARNING("Could not upload SVG atlas page %d", index);
+    }
+    Pages.emplace_back(tex ? std::move(tex.value()) : GPUTexture{}, width, height);
+}
+
 void SVGPathway::Load(std::string_view key) {
     assert(Initialized);
 
@@ -81,13 +396,11 @@ void SVGPathway::Load(std::string_view key) {
 
     const char* viewBox{ nullptr };
     rootNode->QueryAttribute("viewBox", &viewBox);
-    std::vector<std::string> tokens = split(viewBox, " ");
-    std::vector<float> box{
-        static_cast<float>(stoi(tokens[0])),
-        static_cast<float>(stoi(tokens[1])),
-        static_cast<float>(stoi(tokens[2])),
-        static_cast<float>(stoi(tokens[3]))
-    };
+    std::array<float, 4> box{};
+    if (!ParseViewBox(viewBox, box)) {
+        DOA_LOG_WARNING("Could not read the viewBox of SVG: %s", key.data());
+        return;
+    }
 
     auto convertToSpan = [](uint8_t* ptr, size_t size) -> std::span<std::byte> {
         return std::span<std::byte>(reinterpret_cast<std::byte*>(ptr), size);
@@ -1,10 +1,15 @@
 #pragma once
 
+#include <array>
 #include <memory>
 #include <string>
+#include <vector>
+#include <cstdint>
 #include <filesystem>
 #include <string_view>
 
+#include <imgui.h>
+
 #include <Utility/StringMap.hpp>
 
 #include <Engine/Color.hpp>
@@ -23,14 +28,37 @@ enum class TextureSize {
     SIZE_COUNT /* = 3 */
 };
 
+struct SVGIcon {
+    void* TextureID{ nullptr };
+    ImVec2 UV0{ 0.0f, 0.0f };
+    ImVec2 UV1{ 1.0f, 1.0f };
+};
+
 struct SVGPathway {
 
-    static void Initialize(const std::filesystem::path& directory, Color color = { 1, 1, 1, 1 });
-    static void Initialize(std::filesystem::path&& directory, Color color = { 1, 1, 1, 1 });
+    /* Icons listed in preloadKeys are rasterized up front on worker threads and packed into the icon atlas.
+    The packed atlas is cached on disk, keyed by the icon set hash and color, and reused on the next launch. */
+    static void Initialize(const std::filesystem::path& directory, Color color = { 1, 1, 1, 1 }, const std::vector<std::string>& preloadKeys = {});
+    static void Initialize(std::filesystem::path&& directory, Color color = { 1, 1, 1, 1 }, const std::vector<std::string>& preloadKeys = {});
 
-    static const GPUTexture& Get(const std::string& key, const TextureStyle style = TextureStyle::NONE, const TextureSize size = TextureSize::MEDIUM);
+    static SVGIcon Get(const std::string& key, const TextureStyle style = TextureStyle::NONE, const TextureSize size = TextureSize::MEDIUM);
 
 private:
+    struct AtlasRegion {
+        uint32_t Page{};
+        uint32_t X{}, Y{}, Width{}, Height{};
+    };
+    /* NONE and PADDED share the atlas. A PADDED icon is the whole square cell, a NONE icon is the tight
+    rectangle centered inside that cell. The gutter between cells is transparent, so neither bleeds. */
+    struct AtlasEntry {
+        std::array<AtlasRegion, 3> Cells{};
+        std::array<AtlasRegion, 3> Tight{};
+    };
+    struct AtlasPage {
+        GPUTexture Texture;
+        uint32_t Width{};
+        uint32_t Height{};
+    };
     struct TexturePack {
         GPUTexture SmallTexture;
         GPUTexture MediumTexture;
@@ -44,18 +72,30 @@ private:
 
     static constexpr const char* const PATH{ "SVGs" };
     static constexpr const char* const EXT{ ".svg" };
+    static constexpr const char* const CACHE_PATH{ "Cache" };
+    static constexpr uint32_t CACHE_MAGIC{ 0x4153444E }; /* "NDSA" */
+    static constexpr uint32_t CACHE_VERSION{ 1 };
     static constexpr int WIDTH{ 1024 };
     static constexpr int HEIGHT{ 1024 };
     static constexpr float SCALE_FACTOR_SMALL{ .05f };
     static constexpr float SCALE_FACTOR_MEDIUM{ .25f };
     static constexpr float SCALE_FACTOR_LARGE{ .5f };
+    static constexpr std::array<float, 3> SCALE_FACTORS{ SCALE_FACTOR_SMALL, SCALE_FACTOR_MEDIUM, SCALE_FACTOR_LARGE };
     static constexpr uint32_t RASTER_BG_COLOR{ 0xffffff00 };
+    static constexpr uint32_t ATLAS_PAGE_SIZE{ 4096 };
+    static constexpr uint32_t ATLAS_GUTTER{ 2 };
 
     static inline bool Initialized{ false };
+    static inline std::vector<AtlasPage> Pages{};
+    static inline unordered_string_map<SVGPathway::AtlasEntry> Atlas{};
     static inline unordered_string_map<SVGPathway::TexturePack> Textures{};
     static inline unordered_string_map<SVGPathway::TexturePack> TexturesPadded{};
     static inline unordered_string_map<SVGPathway::TexturePack> TexturesScaled{};
 
+    static void BuildAtlas(const std::vector<std::string>& keys);
+    static bool LoadAtlasFromCache(const std::filesystem::path& cacheFile, uint64_t iconSetHash);
+    static void SaveAtlasToCache(const std::filesystem::path& cacheFile, uint64_t iconSetHash, const std::vector<std::vector<std::byte>>& pixels);
+    static void UploadPage(uint32_t index, uint32_t width, uint32_t height, const std::vector<std::byte>& pixels);
+
     static void Load(std::string_view key);
 };
-
@@ -5,6 +5,7 @@
 #include <imgui.h>
 
 #include <EZEasing.hpp>
+#include <Utility/CheckSubstring.hpp>
 #include <Utility/ConstexprConcat.hpp>
 
 #include <Engine/Scene.hpp>
@@ -40,6 +41,7 @@ void SceneHierarchy::Render() {
     GUI& gui = this->gui;
     if (!gui.HasOpenScene()) { return; }
     Scene& scene = gui.GetOpenScene();
+    Track(scene.GetRegistry());
 
     if (ImGui::BeginDragDropTarget()) {
         auto* payload = ImGui::AcceptDragDropPayload("SELECTED_ENTT");
@@ -61,6 +63,17 @@ void SceneHierarchy::Render() {
         }
     }
 
+    ImGui::SetNextItemWidth(-FLT_MIN);
+    if (ImGui::InputTextWithHint(
+        "##EntitySearch",
+        ICON_FA_MAGNIFYING_GLASS "  Search an entity...",
+        searchQuery.data(), searchQuery.size(),
+        ImGuiInputTextFlags_AutoSelectAll |
+        ImGuiInputTextFlags_EscapeClearsAll
+    )) {
+        rowsDirty = true;
+    }
+
     std::string title(SceneHierarchyIcons::SCENE_ICON);
     title.reserve(64);
     title.append(scene.Name);
@@ -106,10 +119,14 @@ void SceneHierarchy::Render() {
             }
         }
 
-        // render entities with no parent (parent == NULL_ENTT);
-        auto view = scene.GetRegistry().view<IDComponent>(entt::exclude<ChildComponent>);
-        for (auto& entt : view) {
-            RenderEntityNode(entt);
+        // only the rows in view are submitted, the rest of the hierarchy costs nothing per frame
+        SyncRows(scene);
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(rows.size()));
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                RenderEntityNode(rows[i]);
+            }
         }
     }
 
@@ -139,28 +156,129 @@ void SceneHierarchy::End() {
     ImGui::PopID();
 }
 
-void SceneHierarchy::RenderEntityNode(const Entity entity) {
+void SceneHierarchy::Changes::OnStructureChanged([[maybe_unused]] Registry& registry, [[maybe_unused]] Entity entity) {
+    Structure = true;
+}
+void SceneHierarchy::Changes::OnRenamed([[maybe_unused]] Registry& registry, Entity entity) {
+    Renamed.push_back(entity);
+}
+void SceneHierarchy::Changes::OnDestroyed([[maybe_unused]] Registry& registry, Entity entity) {
+    Destroyed.push_back(entity);
+    Structure = true;
+}
+
+void SceneHierarchy::Track(Registry& registry) {
+    using Token = std::shared_ptr<Changes>;
+    if (registry.ctx().contains<Token>()) { return; }
+
+    registry.ctx().emplace<Token>(changes);
+    registry.on_construct<IDComponent>().connect<&Changes::OnStructureChanged>(*changes);
+    registry.on_destroy<IDComponent>().connect<&Changes::OnDestroyed>(*changes);
+    registry.on_update<IDComponent>().connect<&Changes::OnRenamed>(*changes);
+    registry.on_construct<ParentComponent>().connect<&Changes::OnStructureChanged>(*changes);
+    registry.on_destroy<ParentComponent>().connect<&Changes::OnStructureChanged>(*changes);
+    registry.on_update<ParentComponent>().connect<&Changes::OnStructureChanged>(*changes);
+    registry.on_construct<ChildComponent>().connect<&Changes::OnStructureChanged>(*changes);
+    registry.on_destroy<ChildComponent>().connect<&Changes::OnStructureChanged>(*changes);
+    registry.on_update<ChildComponent>().connect<&Changes::OnStructureChanged>(*changes);
+
+    // a scene we haven't seen, nothing cached so far applies to it
+    expanded.clear();
+    labels.clear();
+    changes->Renamed.clear();
+    changes->Destroyed.clear();
+    changes->Structure = true;
+}
+void SceneHierarchy::SyncRows(Scene& scene) {
+    for (const Entity entity : changes->Destroyed) {
+        labels.erase(entity);
+        expanded.erase(entity);
+    }
+    for (const Entity entity : changes->Renamed) {
+        labels.erase(entity);
+    }
+    rowsDirty |= changes->Structure || (IsSearching() && !changes->Renamed.empty());
+    changes->Destroyed.clear();
+    changes->Renamed.clear();
+    changes->Structure = false;
+    if (!rowsDirty) { return; }
+
+    rowsDirty = false;
+    rows.clear();
+    auto roots = scene.GetRegistry().view<IDComponent>(entt::exclude<ChildComponent>);
+    if (!IsSearching()) {
+        for (const Entity entity : roots) {
+            AppendRows(scene, entity, 0);
+        }
+        return;
+    }
+
+    // matches are shown along with their ancestors, so each match stays in context
+    std::unordered_set<Entity> shown;
+    for (auto&& [entity, id] : scene.GetRegistry().view<IDComponent>().each()) {
+        if (!CheckSubstringIgnoreCase(id.GetTag(), searchQuery.data())) { continue; }
+        Entity current = entity;
+        while (current != NULL_ENTT && shown.insert(current).second) {
+            current = scene.HasComponent<ChildComponent>(current) ? scene.GetComponent<ChildComponent>(current).GetParent() : NULL_ENTT;
+        }
+    }
+    for (const Entity entity : roots) {
+        if (shown.contains(entity)) {
+            AppendMatchingRows(scene, entity, 0, shown);
+        }
+    }
+}
+void SceneHierarchy::AppendRows(const Scene& scene, Entity entity, int depth) {
+    const std::vector<Entity>* children = scene.HasComponent<ParentComponent>(entity) ? &scene.GetComponent<ParentComponent>(entity).GetChildren() : nullptr;
+    const bool isLeaf = children == nullptr || children->empty();
+    rows.push_back({ entity, depth, isLeaf });
+    if (isLeaf || !expanded.contains(entity)) { return; }
+
+    for (const Entity child : *children) {
+        AppendRows(scene, child, depth + 1);
+    }
+}
+void SceneHierarchy::AppendMatchingRows(const Scene& scene, Entity entity, int depth, const std::unordered_set<Entity>& shown) {
+    const std::vector<Entity>* children = scene.HasComponent<ParentComponent>(entity) ? &scene.GetComponent<ParentComponent>(entity).GetChildren() : nullptr;
+    const bool isLeaf = children == nullptr || children->empty();
+    rows.push_back({ entity, depth, isLeaf });
+    if (isLeaf) { return; }
+
+    for (const Entity child : *children) {
+        if (shown.contains(child)) {
+            AppendMatchingRows(scene, child, depth + 1, shown);
+        }
+    }
+}
+bool SceneHierarchy::IsSearching() const noexcept { return searchQuery[0] != '\0'; }
+const std::string& SceneHierarchy::LabelOf(const Scene& scene, Entity entity) {
+    auto [itr, inserted] = labels.try_emplace(entity);
+    if (inserted) {
+        const IDComponent& id = scene.GetComponent<IDComponent>(entity);
+        std::string& title = itr->second;
+        title.reserve(64);
+        title.append(SceneHierarchyIcons::ENTITY_ICON).append(id.GetTag()).append("###Entity").append(std::to_string(EntityTo<uint32_t>(id.GetEntity())));
+    }
+    return itr->second;
+}
+
+void SceneHierarchy::RenderEntityNode(const Row& row) {
     GUI& gui = this->gui;
     if (!gui.HasOpenScene()) { return; }
     Scene& scene = gui.GetOpenScene();
 
-    const IDComponent& id = scene.GetComponent<IDComponent>(entity);
+    const Entity entity = row.Target;
+    const float indent = static_cast<float>(row.Depth) * ImGui::GetStyle().IndentSpacing;
+    if (indent > 0) { ImGui::Indent(indent); }
 
-    std::string title;
-    title.reserve(64);
-    title.append(SceneHierarchyIcons::ENTITY_ICON).append(id.GetTag()).append("###Entity").append(std::to_string(EntityTo<uint32_t>(id.GetEntity())));
-
-    bool isLeaf = true;
-    if (scene.HasComponent<ParentComponent>(entity)) {
-        ParentComponent& parent = scene.GetComponent<ParentComponent>(entity);
-        isLeaf = parent.GetChildren().empty();
-    }
-
-    panel_flags = ImGuiTreeNodeFlags_SpanAvailWidth;
-    if (!isLeaf) {
+    // rows are flat, the hierarchy is drawn by indenting, so no node pushes onto the tree stack
+    const bool isExpanded = IsSearching() || expanded.contains(entity);
+    panel_flags = ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+    if (!row.IsLeaf) {
         panel_flags |= ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick;
+        ImGui::SetNextItemOpen(isExpanded);
     } else {
-        panel_flags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+        panel_flags |= ImGuiTreeNodeFlags_Leaf;
     }
 
     if (entity == selectedEntity) {
@@ -193,7 +311,7 @@ void SceneHierarchy::RenderEntityNode(const Entity entity) {
         lastHighlighted = highlightedEntity;
     }
 
-    bool opened = ImGui::TreeNodeEx(title.c_str(), panel_flags);
+    bool opened = ImGui::TreeNodeEx(LabelOf(scene, entity).c_str(), panel_flags);
     if (entity == highlightedEntity) {
         ImGui::PopStyleColor(2);
         if (_highlightTime > highlight_expire) {
@@ -204,7 +322,7 @@ void SceneHierarchy::RenderEntityNode(const Entity entity) {
 
     if (ImGui::BeginDragDropSource()) {
         ImGui::SetDragDropPayload("SELECTED_ENTT", &entity, sizeof(Entity));
-        ImGuiFormattedText("DragDrop - {}", id.GetTag().data());
+        ImGuiFormattedText("DragDrop - {}", scene.GetComponent<IDComponent>(entity).GetTag().data());
         ImGui::EndDragDropSource();
     }
 
@@ -249,6 +367,8 @@ void SceneHierarchy::RenderEntityNode(const Entity entity) {
                 }
                 child.SetParent(parent.GetEntity());
                 parent.GetChildren().push_back(child.GetEntity());
+                // mutated in place, let the registry's listeners (and our rows) know
+                scene.GetRegistry().patch<ChildComponent>(dropped);
             }
         }
         ImGui::EndDragDropTarget();
@@ -259,20 +379,16 @@ void SceneHierarchy::RenderEntityNode(const Entity entity) {
     }
     RenderContextMenu(entity);
 
-    if (opened) {
-        if (scene.HasComponent<ParentComponent>(entity)) {
-            ParentComponent& parent = scene.GetComponent<ParentComponent>(entity);
-            const std::vector<Entity>& children = parent.GetChildren();
-
-            for (auto& entt : children) {
-                RenderEntityNode(entt);
-            }
-        }
-
-        if (!isLeaf) {
-            ImGui::TreePop();
+    if (!row.IsLeaf && !IsSearching() && opened != isExpanded) {
+        if (opened) {
+            expanded.insert(entity);
+        } else {
+            expanded.erase(entity);
         }
+        rowsDirty = true;
     }
+
+    if (indent > 0) { ImGui::Unindent(indent); }
 }
 void SceneHierarchy::RenderContextMenu(const Entity entity) {
     GUI& gui = this->gui;
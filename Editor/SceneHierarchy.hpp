@@ -1,6 +1,12 @@
 #pragma once
 
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
 #include <functional>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <imgui.h>
 
@@ -27,10 +33,43 @@ struct SceneHierarchy {
     void End();
 
 private:
+    /* Written by the open scene's registry signals, read when rows are synced. The registry's context shares
+    ownership, so a signal can never reach a destroyed panel. A registry without it in its context is a newly
+    opened (or replaced) scene, which gets connected on the next Render. */
+    struct Changes {
+        bool Structure{ true };
+        std::vector<Entity> Renamed{};
+        std::vector<Entity> Destroyed{};
+
+        void OnStructureChanged(Registry& registry, Entity entity);
+        void OnRenamed(Registry& registry, Entity entity);
+        void OnDestroyed(Registry& registry, Entity entity);
+    };
+    /* The hierarchy flattened in display order, only expanded subtrees are included. */
+    struct Row {
+        Entity Target{ NULL_ENTT };
+        int Depth{};
+        bool IsLeaf{ true };
+    };
+
+    std::shared_ptr<Changes> changes{ std::make_shared<Changes>() };
+    std::vector<Row> rows{};
+    bool rowsDirty{ true };
+    std::unordered_set<Entity> expanded{};
+    std::unordered_map<Entity, std::string> labels{}; /* only built for rows that were visible at least once */
+    std::array<char, 64> searchQuery{};
+
     Entity highlightedEntity{ NULL_ENTT };
     Entity deletedEntity{ NULL_ENTT };
 
-    void RenderEntityNode(const Entity entity);
+    void Track(Registry& registry);
+    void SyncRows(Scene& scene);
+    void AppendRows(const Scene& scene, Entity entity, int depth);
+    void AppendMatchingRows(const Scene& scene, Entity entity, int depth, const std::unordered_set<Entity>& shown);
+    bool IsSearching() const noexcept;
+    const std::string& LabelOf(const Scene& scene, Entity entity);
+
+    void RenderEntityNode(const Row& row);
     void RenderContextMenu(const Entity entity);
 
     Entity selectedEntity{ NULL_ENTT };
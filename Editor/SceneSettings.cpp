@@ -1,5 +1,10 @@
 #include <Editor/SceneSettings.hpp>
 
+#include <Utility/FormatBytes.hpp>
+
+#include <Engine/AssetBridge.hpp>
+#include <Engine/GPUObjectCache.hpp>
+
 #include <Editor/GUI.hpp>
 #include <Editor/Icons.hpp>
 #include <Editor/Strings.hpp>
@@ -23,6 +28,10 @@ void SceneSettings::Render() {
     if (gui.HasOpenScene()) {
         DrawStats(gui.GetOpenScene());
         ImGui::Separator();
+        DrawSimulationSettings();
+        ImGui::Separator();
+        DrawGPUMemorySettings();
+        ImGui::Separator();
     }
 }
 
@@ -50,3 +59,47 @@ void SceneSettings::DrawStats(Scene& scene) const {
 
     ImGui::EndGroup();
 }
+
+void SceneSettings::DrawSimulationSettings() const {
+    const GUI& gui = this->gui;
+    FixedTimestepSettings settings = gui.CORE->GetFixedTimestep();
+
+    ImGui::BeginGroup();
+    bool changed = false;
+    changed |= ImGui::DragFloat("Tick Rate", &settings.TickRate, 1.0f, 1.0f, 1000.0f, "%.0f Hz", ImGuiSliderFlags_AlwaysClamp);
+    int maxTicks = static_cast<int>(settings.MaxTicksPerFrame);
+    changed |= ImGui::SliderInt("Max Ticks Per Frame", &maxTicks, 1, 32, "%d", ImGuiSliderFlags_AlwaysClamp);
+    settings.MaxTicksPerFrame = static_cast<unsigned>(maxTicks);
+    if (changed) {
+        gui.CORE->SetFixedTimestep(settings);
+    }
+    ImGuiFormattedText("Ticks last frame: {}", gui.CORE->GetTicksLastFrame());
+    ImGuiFormattedText("Interpolation alpha: {:.3f}", gui.CORE->GetInterpolationAlpha());
+    ImGui::EndGroup();
+}
+
+void SceneSettings::DrawGPUMemorySettings() const {
+    const GUI& gui = this->gui;
+    AssetGPUBridge& bridge = *gui.CORE->GetAssetGPUBridge();
+    const GPUMemoryBudget& memory = bridge.GetMemoryBudget();
+
+    ImGui::BeginGroup();
+    int budgetMiB = static_cast<int>(memory.Budget / (1024 * 1024));
+    if (ImGui::DragInt("GPU Memory Budget", &budgetMiB, 8.0f, 16, 64 * 1024, "%d MiB", ImGuiSliderFlags_AlwaysClamp)) {
+        bridge.SetMemoryBudget(static_cast<size_t>(budgetMiB) * 1024 * 1024);
+    }
+    ImGuiFormattedText("GPU memory in use: {} (peak {})", FormatBytes(static_cast<float>(memory.Usage)), FormatBytes(static_cast<float>(memory.Peak)));
+    ImGuiFormattedText("Resident textures: {}", bridge.GetTextures().ResidentCount());
+    ImGuiFormattedText("Texture evictions: {}, re-allocations: {}", memory.Evictions, memory.Reallocations);
+    Graphics::RetirementStats retirement = Graphics::GetRetirementStats();
+    ImGuiFormattedText("Retired GPU objects: {} pending, {} destroyed last frame", retirement.Pending, retirement.DestroyedLastFrame);
+    auto cacheStatistics = [](std::string_view cache, const auto& statistics) {
+        ImGuiFormattedText("{}: {} objects, {:.1f}% hits of {} requests", cache, statistics.Entries, statistics.HitRate() * 100.0f, statistics.Hits + statistics.Misses);
+    };
+    const GPUObjectCaches& caches = *gui.CORE->GetGPUObjectCaches();
+    cacheStatistics("Pipeline cache", caches.Pipelines.GetStatistics());
+    cacheStatistics("Sampler cache", caches.Samplers.GetStatistics());
+    cacheStatistics("Descriptor set cache", caches.DescriptorSets.GetStatistics());
+    cacheStatistics("Sampler asset cache", bridge.GetSamplerCache().GetStatistics());
+    ImGui::EndGroup();
+}
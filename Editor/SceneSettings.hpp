@@ -22,4 +22,6 @@ struct SceneSettings {
 
 private:
     void DrawStats(Scene& scene) const;
+    void DrawSimulationSettings() const;
+    void DrawGPUMemorySettings() const;
 };
@@ -1,5 +1,6 @@
 #include <Editor/SceneViewport.hpp>
 
+#include <cstring>
 #include <utility>
 
 #include <imgui.h>
@@ -16,6 +17,8 @@
 #include <Engine/GPUVertexAttribLayout.hpp>
 #include <Engine/GPUPipeline.hpp>
 #include <Engine/GPUDescriptorSet.hpp>
+#include <Engine/GPUObjectCache.hpp>
+#include <Engine/GPURingBuffer.hpp>
 
 #include <Editor/GUI.hpp>
 #include <Editor/Icons.hpp>
@@ -31,15 +34,31 @@ PerspectiveCamera& SceneViewport::ViewportCamera::GetPerspectiveCamera() { retur
 bool SceneViewport::ViewportCamera::IsOrtho() const { return activeCamera == &ortho; }
 bool SceneViewport::ViewportCamera::IsPerspective() const { return activeCamera == &perspective; }
 
-GPUPipeline pipeline;
+GPUPipelineCache::Handle pipeline;
 GPUShaderProgram prog;
-GPUDescriptorSet perFrame;
-GPUDescriptorSet perObject;
+GPUDescriptorSetCache::Handle perFrame;
+GPUDescriptorSetCache::Handle perObject;
 const GPUTexture* tex;
-GPUSampler sampler;
+GPUSamplerCache::Handle sampler;
 GPUBuffer buf;
+GPUVertexAttribLayout layout;
 GPUBuffer perFrameUniformBuffer;
-GPUBuffer perObjectUniformBuffer;
+GPURingBuffer perObjectRing;
+/* The viewport is set per draw, so one pipeline serves every viewport size. */
+static GPUPipelineCache::Handle ScenePipeline() {
+    GPUPipelineBuilder builder;
+    builder
+        .SetFaceCullEnabled(true)
+        .SetCullMode(CullMode::Back)
+        .SetArrayBuffer(0, buf, layout)
+        .SetTopology(TopologyType::Triangles)
+        .SetPolygonMode(PolygonMode::Fill)
+        .SetDepthTestEnabled(true)
+        .SetDepthWriteEnabled(true)
+        .SetMultisampleEnabled(true)
+        .SetShaderProgram(prog);
+    return Core::GetCore()->GetGPUObjectCaches()->Pipelines.Get(builder).first;
+}
 SceneViewport::SceneViewport(GUI& gui) noexcept :
     gui(gui),
     gizmos(*this) {
@@ -93,8 +112,7 @@ SceneViewport::SceneViewport(GUI& gui) noexcept :
     GPUBufferBuilder bBuilder;
     buf = bBuilder.SetStorage(std::span<std::byte>(bytePtr, 180 * sizeof(float))).Build().first.value();
     perFrameUniformBuffer = bBuilder.SetProperties(BufferProperties::DynamicStorage).SetStorage(sizeof(glm::mat4) * 2, nullptr).Build().first.value(); // proj and view
-    perObjectUniformBuffer = bBuilder.SetProperties(BufferProperties::DynamicStorage).SetStorage(sizeof(glm::mat4), nullptr).Build().first.value(); // model
-    GPUVertexAttribLayout layout;
+    perObjectRing = GPURingBuffer(sizeof(glm::mat4) * 1024, "NeoDoa Editor Scene Viewport Per-Object Ring"); // model, grows on demand
     layout.Define<float>(3);
     layout.Define<float>(2);
 
@@ -138,38 +156,25 @@ void main() {
     GPUShaderProgramBuilder spBuilder;
     prog = spBuilder.SetVertexShader(v.value()).SetFragmentShader(f.value()).Build().first.value();
 
-    GPUPipelineBuilder aBuilder;
-    pipeline = aBuilder
-        .SetFaceCullEnabled(true)
-        .SetCullMode(CullMode::Back)
-        .SetArrayBuffer(0, buf, layout)
-        .SetTopology(TopologyType::Triangles)
-        .SetPolygonMode(PolygonMode::Fill)
-        .SetViewport({ 0, 0, viewportSize.Width, viewportSize.Height })
-        .SetDepthTestEnabled(true)
-        .SetDepthWriteEnabled(true)
-        .SetMultisampleEnabled(true)
-        .SetShaderProgram(prog)
-        .Build().first.value();
+    pipeline = ScenePipeline();
 
     tex = &Core::GetCore()->GetAssetGPUBridge()->GetTextures().Missing();
 
+    GPUObjectCaches& caches = *Core::GetCore()->GetGPUObjectCaches();
     GPUSamplerBuilder saBuilder;
-    sampler = saBuilder
+    saBuilder
         .SetMagnificationFilter(TextureMagnificationMode::Nearest)
         .SetWrapS(TextureWrappingMode::ClampToEdge)
-        .SetWrapT(TextureWrappingMode::ClampToEdge)
-        .Build().first.value();
-
-    GPUDescriptorSetBuilder dsBuilder;
-    perFrame = dsBuilder
-        .SetUniformBufferBinding(0, perFrameUniformBuffer)
-        .Build().first.value();
-
-    perObject = dsBuilder
-        .SetUniformBufferBinding(1, perObjectUniformBuffer)
-        .SetCombinedImageSamplerBinding(0, *tex, sampler)
-        .Build().first.value();
+        .SetWrapT(TextureWrappingMode::ClampToEdge);
+    sampler = caches.Samplers.Get(saBuilder).first;
+
+    GPUDescriptorSetBuilder perFrameBuilder;
+    perFrameBuilder.SetUniformBufferBinding(0, perFrameUniformBuffer);
+    perFrame = caches.DescriptorSets.Get(perFrameBuilder).first;
+
+    GPUDescriptorSetBuilder perObjectBuilder;
+    perObjectBuilder.SetCombinedImageSamplerBinding(0, *tex, *sampler);
+    perObject = caches.DescriptorSets.Get(perObjectBuilder).first;
 }
 
 
@@ -195,10 +200,12 @@ void SceneViewport::Render() {
         ImGui::GetWindowPos().y + ImGui::GetCursorPos().y
     };
     ReallocBufferIfNeeded({ static_cast<unsigned>(ImGui::GetContentRegionAvail().x), static_cast<unsigned>(ImGui::GetContentRegionAvail().y) });
-    RenderSceneToBuffer(scene);
+    RenderSceneGraph(scene);
 
     ImVec2 size{ static_cast<float>(viewportSize.Width), static_cast<float>(viewportSize.Height) };
-    ImGui::Image(std::get<GPUTexture>(viewportFramebuffer.ColorAttachments[0].value()), size, { 0, 1 }, { 1, 0 });
+    Resolution extent{ viewportFramebuffer.Extent() };
+    ImVec2 uvMax{ size.x / static_cast<float>(extent.Width), size.y / static_cast<float>(extent.Height) };
+    ImGui::Image(std::get<GPUTexture>(viewportFramebuffer.FrameBuffer().ColorAttachments[0].value()), size, { 0, uvMax.y }, { uvMax.x, 0 });
 
     ImGui::PushClipRect({ viewportPosition.x, viewportPosition.y }, { viewportPosition.x + size.x, viewportPosition.y + size.y }, false);
     gizmos.settings.viewportSize = viewportSize;
@@ -217,97 +224,95 @@ void SceneViewport::End() {
 }
 
 SceneViewport::ViewportCamera& SceneViewport::GetViewportCamera() { return viewportCamera; }
+void SceneViewport::SetOutline(std::span<const Entity> entities, glm::vec4 color, float width) {
+    outlined.assign(entities.begin(), entities.end());
+    selectionOutline.Color = color;
+    selectionOutline.Width = width;
+}
 
 ImVec2 SceneViewport::GetViewportCameraSettingsButtonPosition() const noexcept { return viewportCameraSettingsButtonPosition; }
 
 void SceneViewport::ReallocBufferIfNeeded(Resolution size) {
+    /* Targets are pooled in size buckets, resizing within a bucket only changes the rendered sub-rectangle. */
+    renderTargetPool.Trim();
+    viewportFramebuffer.Resize(size);
+
     if (viewportSize == size) { return; }
     viewportSize = size;
     viewportCamera.GetPerspectiveCamera().AspectRatio = size.Aspect();
-
-    { // Build Multisampled FB
-        GPURenderBufferBuilder rbBuilder;
-        auto&& color = rbBuilder
-            .SetLayout(viewportSize.Width, viewportSize.Height, DataFormat::RGBA16F)
-            .SetSamples(Multisample::x8)
-            .Build().first;
-        assert(color.has_value());
-
-        auto&& depthStencil = rbBuilder
-            .SetLayout(viewportSize.Width, viewportSize.Height, DataFormat::DEPTH32F_STENCIL8)
-            .SetSamples(Multisample::x8)
-            .Build().first;
-        assert(depthStencil.has_value());
-
-        GPUFrameBufferBuilder fbBuilder;
-        fbBuilder.SetName("NeoDoa Editor Scene Viewport Buffer (MS)")
-            .AttachColorRenderBuffer(std::move(color.value()), 0)
-            .AttachDepthStencilRenderBuffer(std::move(depthStencil.value()));
-        auto&& fb = fbBuilder.Build().first;
-        assert(fb.has_value());
-
-        viewportFramebufferMultisampled = std::move(fb.value());
-    }
-
-    { // Build FB
-        GPUTextureBuilder tBuilder;
-        auto&& color = tBuilder
-            .SetWidth(viewportSize.Width)
-            .SetHeight(viewportSize.Height)
-            .SetData(DataFormat::RGBA16F, {})
-            .SetSamples(Multisample::None)
-            .Build().first;
-        assert(color.has_value());
-
-        GPURenderBufferBuilder rbBuilder;
-        auto&& depthStencil = rbBuilder.SetLayout(viewportSize.Width, viewportSize.Height, DataFormat::DEPTH32F_STENCIL8).Build().first;
-        assert(depthStencil.has_value());
-
-        GPUFrameBufferBuilder fbBuilder;
-        fbBuilder.SetName("NeoDoa Editor Scene Viewport Buffer")
-            .AttachColorTexture(std::move(color.value()), 0)
-            .AttachDepthStencilRenderBuffer(std::move(depthStencil.value()));
-        auto&& fb = fbBuilder.Build().first;
-        assert(fb.has_value());
-
-        viewportFramebuffer = std::move(fb.value());
+}
+void SceneViewport::RenderSceneGraph(Scene& scene) {
+    PerspectiveCamera& camera = viewportCamera.GetPerspectiveCamera();
+    camera.UpdateView();
+    camera.UpdateProjection();
+
+    renderGraph.Reset();
+    RenderGraph::Resource viewport = renderGraph.Import("Viewport", viewportFramebuffer.FrameBuffer(), viewportFramebuffer.Extent());
+
+    /* The multisampled target is transient, the graph takes it from the pool in the same bucket as the
+    viewport target, so the resolve copies between equally sized buffers. */
+    RenderGraph::Resource sceneColor;
+    renderGraph.AddPass("Scene", [&](RenderGraph::PassBuilder& builder) {
+        sceneColor = builder.Create(
+            "Scene (MS)",
+            { .ColorFormat = DataFormat::RGBA16F, .DepthStencilFormat = DataFormat::DEPTH32F_STENCIL8, .Samples = Multisample::x8 },
+            viewportFramebuffer.Extent()
+        );
+        builder.Write(sceneColor);
+    }, [this, &scene, &sceneColor](RenderGraph::PassContext& context) {
+        RenderSceneToBuffer(scene, context.FrameBuffer(sceneColor));
+    });
+    renderGraph.AddBlitPass("Resolve", sceneColor, viewport);
+
+    /* The outline rasterizes the same demo cube every entity is drawn as, see RenderSceneToBuffer. */
+    outlinedModels.clear();
+    for (Entity entity : outlined) {
+        if (!scene.ContainsEntity(entity) || !scene.HasComponent<TransformComponent>(entity)) { continue; }
+        outlinedModels.push_back(TransformComponent::ComputeWorldMatrix(entity, scene));
     }
-
-    pipeline.Viewport = { 0, 0, viewportSize.Width, viewportSize.Height };
+    selectionOutline.AddPasses(
+        renderGraph, viewport, viewportSize,
+        { .VertexBuffer = &buf, .Layout = layout, .VertexCount = 36 },
+        camera.GetProjectionMatrix() * camera.GetViewMatrix(),
+        outlinedModels
+    );
+
+    renderGraph.Compile();
+    renderGraph.Execute();
 }
-void SceneViewport::RenderSceneToBuffer(Scene& scene) {
+void SceneViewport::RenderSceneToBuffer(Scene& scene, GPUFrameBuffer& target) {
     //scene.Update(gui.get().delta);
     //scene.Render();
 
     std::array<unsigned, 1> targets{ 0 };
-    Graphics::SetRenderTarget(viewportFramebufferMultisampled, targets);
-    Graphics::BindPipeline(pipeline);
-    Graphics::ClearRenderTarget(viewportFramebufferMultisampled, { scene.ClearColor.r, scene.ClearColor.g, scene.ClearColor.b, scene.ClearColor.a });
+    Graphics::SetRenderTarget(target, targets);
+    Graphics::BindPipeline(*pipeline);
+    Graphics::SetViewport({ 0, 0, viewportSize.Width, viewportSize.Height });
+    Graphics::ClearRenderTarget(target, { scene.ClearColor.r, scene.ClearColor.g, scene.ClearColor.b, scene.ClearColor.a });
 
-    // Bind per-frame uniform
-    viewportCamera.GetPerspectiveCamera().UpdateView();
-    viewportCamera.GetPerspectiveCamera().UpdateProjection();
+    // Bind per-frame uniform, the camera was updated when the graph was built
     glm::mat4 matrices[2] {
         viewportCamera.GetPerspectiveCamera().GetProjectionMatrix(),
         viewportCamera.GetPerspectiveCamera().GetViewMatrix()
     };
     Graphics::BufferSubData(perFrameUniformBuffer, sizeof(matrices), reinterpret_cast<NonOwningPointerToConstRawData>(glm::value_ptr(matrices[0])));
-    Graphics::BindDescriptorSet(perFrame);
+    Graphics::BindDescriptorSet(*perFrame);
     // ---
 
-    // Bind per-object uniform
+    // Bind per-object uniform, streamed through the ring and bound by offset so no draw waits on the previous one
+    perObjectRing.BeginFrame();
+    Graphics::BindDescriptorSet(*perObject);
     for (const auto& e : scene.GetRegistry().view<TransformComponent>()) {
         glm::mat4 model = TransformComponent::ComputeWorldMatrix(e, scene);
-        Graphics::BufferSubData(perObjectUniformBuffer, sizeof(model), reinterpret_cast<NonOwningPointerToConstRawData>(glm::value_ptr(model)));
-        Graphics::BindDescriptorSet(perObject);
+        GPURingBuffer::Allocation allocation = perObjectRing.Allocate(sizeof(model));
+        std::memcpy(allocation.Data, glm::value_ptr(model), sizeof(model));
+        Graphics::BindUniformBufferRange(1, perObjectRing.Buffer(), allocation.OffsetBytes, allocation.SizeBytes);
 
         Graphics::Render(36);
     }
+    perObjectRing.EndFrame();
     // ---
     Graphics::SetRenderTarget({});
-
-    std::array<unsigned, 1> dst{ 0 };
-    Graphics::BlitColor(viewportFramebufferMultisampled, viewportFramebuffer, 0, dst);
 }
 
 void SceneViewport::DrawViewportSettings(bool hasScene) {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <span>
+#include <vector>
 #include <optional>
 #include <functional>
 
@@ -8,10 +10,14 @@
 #include <ImGuizmo.h>
 
 #include <Engine/Scene.hpp>
+#include <Engine/Entity.hpp>
 #include <Engine/Resolution.hpp>
 #include <Engine/GPUFrameBuffer.hpp>
+#include <Engine/GPURenderTargetPool.hpp>
+#include <Engine/RenderGraph.hpp>
 
 #include <Editor/Gizmos.hpp>
+#include <Editor/SelectionOutline.hpp>
 
 struct GUI;
 
@@ -46,19 +52,30 @@ struct SceneViewport {
     void End();
 
     ViewportCamera& GetViewportCamera();
+    /* Outlines entities in the frames rendered from now on, until called again. */
+    void SetOutline(std::span<const Entity> entities, glm::vec4 color, float width);
 
     ImVec2 GetViewportCameraSettingsButtonPosition() const noexcept;
 
 private:
     glm::vec2 viewportPosition{};
     Resolution viewportSize{};
-    GPUFrameBuffer viewportFramebufferMultisampled;
-    GPUFrameBuffer viewportFramebuffer;
+    GPURenderTargetPool renderTargetPool{};
+    RenderGraph renderGraph{ renderTargetPool };
+    GPUPooledRenderTarget viewportFramebuffer{
+        renderTargetPool,
+        { .ColorFormat = DataFormat::RGBA16F, .DepthStencilFormat = DataFormat::DEPTH32F_STENCIL8, .SampledColor = true },
+        "NeoDoa Editor Scene Viewport Buffer"
+    };
+    SelectionOutline selectionOutline{};
+    std::vector<Entity> outlined{};
+    std::vector<glm::mat4> outlinedModels{};
 
     ImVec2 viewportCameraSettingsButtonPosition;
 
     void ReallocBufferIfNeeded(Resolution size);
-    void RenderSceneToBuffer(Scene& scene);
+    void RenderSceneGraph(Scene& scene);
+    void RenderSceneToBuffer(Scene& scene, GPUFrameBuffer& target);
 
     void DrawViewportSettings(bool hasScene);
     void DrawCubeControl();
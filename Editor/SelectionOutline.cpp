@@ -0,0 +1,218 @@
+#include <Editor/SelectionOutline.hpp>
+
+#include <cstring>
+#include <algorithm>
+
+#include <Engine/Core.hpp>
+#include <Engine/Graphics.hpp>
+#include <Engine/GPUPipeline.hpp>
+#include <Engine/GPUDescriptorSet.hpp>
+
+namespace {
+    /* std140, OutlineBuffer of the flood and composite shaders. */
+    struct OutlineUniforms {
+        glm::vec4 Color{};
+        glm::ivec2 Size{};
+        int Step{};
+        float Width{};
+    };
+
+    constexpr auto MASK_VERTEX_SHADER{ R"(
+#version 460 core
+
+layout(location = 0) in vec3 vPos;
+
+layout(std140, binding = 0) uniform ViewProjectionBuffer {
+    mat4 viewProjection;
+};
+
+layout(std140, binding = 1) uniform ModelBuffer {
+    mat4 model;
+};
+
+void main() {
+    gl_Position = viewProjection * model * vec4(vPos, 1.0);
+}
+)" };
+    constexpr auto MASK_FRAGMENT_SHADER{ R"(
+#version 460 core
+
+out vec2 seed;
+
+void main() {
+    seed = floor(gl_FragCoord.xy);
+}
+)" };
+    constexpr auto FULLSCREEN_VERTEX_SHADER{ R"(
+#version 460 core
+
+void main() {
+    vec2 corner = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+    gl_Position = vec4(corner * 2.0 - 1.0, 0.0, 1.0);
+}
+)" };
+    constexpr auto FLOOD_FRAGMENT_SHADER{ R"(
+#version 460 core
+
+layout(binding = 0) uniform sampler2D seeds;
+
+layout(std140, binding = 0) uniform OutlineBuffer {
+    vec4 color;
+    ivec2 size;
+    int step;
+    float width;
+};
+
+out vec2 seed;
+
+void main() {
+    ivec2 pixel = ivec2(gl_FragCoord.xy);
+    vec2 best = vec2(-1.0);
+    float bestDistance = 3.402823466e38;
+    for (int dy = -1; dy <= 1; dy++) {
+        for (int dx = -1; dx <= 1; dx++) {
+            ivec2 neighbour = pixel + ivec2(dx, dy) * step;
+            if (any(lessThan(neighbour, ivec2(0))) || any(greaterThanEqual(neighbour, size))) { continue; }
+            vec2 candidate = texelFetch(seeds, neighbour, 0).xy;
+            if (candidate.x < 0.0) { continue; }
+            vec2 offset = candidate - vec2(pixel);
+            float candidateDistance = dot(offset, offset);
+            if (candidateDistance < bestDistance) {
+                best = candidate;
+                bestDistance = candidateDistance;
+            }
+        }
+    }
+    seed = best;
+}
+)" };
+    constexpr auto COMPOSITE_FRAGMENT_SHADER{ R"(
+#version 460 core
+
+layout(binding = 0) uniform sampler2D seeds;
+
+layout(std140, binding = 0) uniform OutlineBuffer {
+    vec4 color;
+    ivec2 size;
+    int step;
+    float width;
+};
+
+out vec4 FragColor;
+
+void main() {
+    vec2 nearest = texelFetch(seeds, ivec2(gl_FragCoord.xy), 0).xy;
+    if (nearest.x < 0.0) { discard; }
+    float nearestDistance = length(nearest - floor(gl_FragCoord.xy));
+    if (nearestDistance < 0.5) { discard; }
+    float coverage = clamp(width + 0.5 - nearestDistance, 0.0, 1.0);
+    if (coverage <= 0.0) { discard; }
+    FragColor = vec4(color.rgb, color.a * coverage);
+}
+)" };
+
+    GPUShaderProgram BuildProgram(const char* vertex, const char* fragment, std::string_view name) noexcept {
+        GPUShaderBuilder sBuilder;
+        auto v = sBuilder.SetType(ShaderType::Vertex).SetSourceCode(vertex).Build().first;
+        auto f = sBuilder.SetType(ShaderType::Fragment).SetSourceCode(fragment).Build().first;
+
+        GPUShaderProgramBuilder spBuilder;
+        return spBuilder.SetName(name).SetVertexShader(v.value()).SetFragmentShader(f.value()).Build().first.value();
+    }
+
+    void BindSeeds(const GPUTexture& seeds, const GPUSampler& sampler) noexcept {
+        /* A descriptor set has no GL object behind it, one per pass costs nothing. */
+        GPUDescriptorSetBuilder builder;
+        builder.SetCombinedImageSamplerBinding(0, seeds, sampler);
+        Graphics::BindDescriptorSet(builder.Build().first.value());
+    }
+}
+
+SelectionOutline::SelectionOutline() noexcept :
+    maskProgram(BuildProgram(MASK_VERTEX_SHADER, MASK_FRAGMENT_SHADER, "NeoDoa Editor Selection Outline Mask")),
+    floodProgram(BuildProgram(FULLSCREEN_VERTEX_SHADER, FLOOD_FRAGMENT_SHADER, "NeoDoa Editor Selection Outline Flood")),
+    compositeProgram(BuildProgram(FULLSCREEN_VERTEX_SHADER, COMPOSITE_FRAGMENT_SHADER, "NeoDoa Editor Selection Outline Composite")),
+    uniforms(sizeof(OutlineUniforms) * 64, "NeoDoa Editor Selection Outline Uniforms") {
+
+    GPUSamplerBuilder builder;
+    builder
+        .SetMinificationFilter(TextureMinificationMode::Nearest)
+        .SetMagnificationFilter(TextureMagnificationMode::Nearest)
+        .SetWrapS(TextureWrappingMode::ClampToEdge)
+        .SetWrapT(TextureWrappingMode::ClampToEdge);
+    sampler = Core::GetCore()->GetGPUObjectCaches()->Samplers.Get(builder).first;
+}
+
+void SelectionOutline::AddPasses(RenderGraph& graph, RenderGraph::Resource target, Resolution size, const Geometry& geometry, const glm::mat4& viewProjection, std::span<const glm::mat4> models) {
+    if (models.empty() || size.Width == 0 || size.Height == 0 || geometry.VertexBuffer == nullptr) { return; }
+
+    UpdatePipelines(geometry);
+    objects.assign(models.begin(), models.end());
+    objectsViewProjection = viewProjection;
+    objectsVertexCount = geometry.VertexCount;
+
+    JumpFlood::AddPasses(graph, target, size, Width, {
+        .Mask = [this]() {
+            Graphics::BindPipeline(*maskPipeline);
+            uniforms.BeginFrame();
+            GPURingBuffer::Allocation allocation = uniforms.Allocate(sizeof(objectsViewProjection));
+            std::memcpy(allocation.Data, &objectsViewProjection, sizeof(objectsViewProjection));
+            Graphics::BindUniformBufferRange(0, uniforms.Buffer(), allocation.OffsetBytes, allocation.SizeBytes);
+            for (const glm::mat4& model : objects) {
+                allocation = uniforms.Allocate(sizeof(model));
+                std::memcpy(allocation.Data, &model, sizeof(model));
+                Graphics::BindUniformBufferRange(1, uniforms.Buffer(), allocation.OffsetBytes, allocation.SizeBytes);
+                Graphics::Render(objectsVertexCount);
+            }
+        },
+        .Flood = [this](const GPUTexture& seeds, Resolution seedsSize, unsigned step) {
+            Graphics::BindPipeline(*floodPipeline);
+            BindSeeds(seeds, *sampler);
+            BindUniforms(seedsSize, step);
+            Graphics::Render(3);
+        },
+        .Composite = [this](const GPUTexture& seeds, Resolution seedsSize) {
+            Graphics::BindPipeline(*compositePipeline);
+            BindSeeds(seeds, *sampler);
+            BindUniforms(seedsSize, 0);
+            Graphics::Render(3);
+            uniforms.EndFrame();
+        }
+    });
+}
+
+void SelectionOutline::UpdatePipelines(const Geometry& geometry) noexcept {
+    if (maskPipeline != nullptr && pipelineGeometry == geometry) { return; }
+    pipelineGeometry = geometry;
+
+    GPUPipelineCache& pipelines = Core::GetCore()->GetGPUObjectCaches()->Pipelines;
+
+    GPUPipelineBuilder mask;
+    mask.SetArrayBuffer(0, *geometry.VertexBuffer, geometry.Layout)
+        .SetTopology(TopologyType::Triangles)
+        .SetShaderProgram(maskProgram);
+    maskPipeline = pipelines.Get(mask).first;
+
+    GPUPipelineBuilder flood;
+    flood.SetTopology(TopologyType::Triangles)
+        .SetShaderProgram(floodProgram);
+    floodPipeline = pipelines.Get(flood).first;
+
+    GPUPipelineBuilder composite;
+    composite.SetTopology(TopologyType::Triangles)
+        .SetBlendEnabled(true)
+        .SetBlendFunctionSeparate(BlendFactor::SrcAlpha, BlendFactor::OneMinusSrcAlpha, BlendFactor::One, BlendFactor::OneMinusSrcAlpha)
+        .SetShaderProgram(compositeProgram);
+    compositePipeline = pipelines.Get(composite).first;
+}
+void SelectionOutline::BindUniforms(Resolution size, unsigned step) noexcept {
+    OutlineUniforms values{
+        .Color = Color,
+        .Size = { static_cast<int>(size.Width), static_cast<int>(size.Height) },
+        .Step = static_cast<int>(step),
+        .Width = std::clamp(Width, 0.0f, MAX_WIDTH)
+    };
+    GPURingBuffer::Allocation allocation = uniforms.Allocate(sizeof(values));
+    std::memcpy(allocation.Data, &values, sizeof(values));
+    Graphics::BindUniformBufferRange(0, uniforms.Buffer(), allocation.OffsetBytes, allocation.SizeBytes);
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <Engine/JumpFlood.hpp>
+#include <Engine/Resolution.hpp>
+#include <Engine/RenderGraph.hpp>
+#include <Engine/GPUShader.hpp>
+#include <Engine/GPURingBuffer.hpp>
+#include <Engine/GPUObjectCache.hpp>
+#include <Engine/GPUVertexAttribLayout.hpp>
+
+/* Outlines selected objects in screen space with a jump flood (see JumpFlood), at a cost independent of how
+many are selected. Supplies the shaders and draws of the passes, the mask pass draws every selected object. */
+struct SelectionOutline {
+
+    static constexpr float MAX_WIDTH{ JumpFlood::MAX_WIDTH };
+
+    struct Geometry {
+        const GPUBuffer* VertexBuffer{ nullptr };
+        GPUVertexAttribLayout Layout{};
+        int VertexCount{ 0 };
+
+        bool operator==(const Geometry&) const noexcept = default;
+    };
+
+    glm::vec4 Color{ 1.0f, 1.0f, 1.0f, 1.0f };
+    float Width{ 3.0f };
+
+    SelectionOutline() noexcept;
+    ~SelectionOutline() noexcept = default;
+    SelectionOutline(const SelectionOutline&) = delete;
+    SelectionOutline(SelectionOutline&&) = delete;
+    SelectionOutline& operator=(const SelectionOutline&) = delete;
+    SelectionOutline& operator=(SelectionOutline&&) = delete;
+
+    /* Adds the passes outlining the objects at models over the size sized corner of target. Adds nothing when
+    models is empty. geometry and target must live until the graph has executed. */
+    void AddPasses(RenderGraph& graph, RenderGraph::Resource target, Resolution size, const Geometry& geometry, const glm::mat4& viewProjection, std::span<const glm::mat4> models);
+
+private:
+    GPUShaderProgram maskProgram{};
+    GPUShaderProgram floodProgram{};
+    GPUShaderProgram compositeProgram{};
+    GPUSamplerCache::Handle sampler{};
+    GPUPipelineCache::Handle maskPipeline{};
+    GPUPipelineCache::Handle floodPipeline{};
+    GPUPipelineCache::Handle compositePipeline{};
+    Geometry pipelineGeometry{};
+    GPURingBuffer uniforms{};
+
+    /* Filled when the passes are added, read by their execution. */
+    std::vector<glm::mat4> objects{};
+    glm::mat4 objectsViewProjection{ 1.0f };
+    int objectsVertexCount{ 0 };
+
+    void UpdatePipelines(const Geometry& geometry) noexcept;
+    void BindUniforms(Resolution size, unsigned step) noexcept;
+};
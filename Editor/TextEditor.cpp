@@ -46,23 +46,21 @@ TextEditor::TextEditor()
 	, mLeftMargin(10)
 	, mColorRangeMin(0)
 	, mColorRangeMax(0)
-	, mCheckComments(true)
+	, mColorizerTimeBudget(2.0f)
+	, mColorizedLines(0)
+	, mColorizeTime(0.0f)
 	, mShowWhitespaces(true)
 	, mStartTime(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count())
 	, mLastClick(-1.0f) {
 	SetPalette(GetMarianaPalette());
 	mLines.push_back(Line());
+	mLineStates.push_back(LineState());
 }
 
 TextEditor::~TextEditor() {}
 
 void TextEditor::SetLanguageDefinition(const LanguageDefinition& aLanguageDef) {
 	mLanguageDefinition = &aLanguageDef;
-	mRegexList.clear();
-
-	for (const auto& r : mLanguageDefinition->mTokenRegexStrings)
-		mRegexList.push_back(std::make_pair(std::regex(r.first, std::regex_constants::optimize), r.second));
-
 	Colorize();
 }
 
@@ -543,8 +541,13 @@ void TextEditor::RemoveLines(int aStart, int aEnd) {
 	assert(mLines.size() > (size_t) (aEnd - aStart));
 
 	mLines.erase(mLines.begin() + aStart, mLines.begin() + aEnd);
+	mLineStates.erase(mLineStates.begin() + aStart, mLineStates.begin() + aEnd);
 	assert(!mLines.empty());
 
+	if (mColorRangeMax > aStart)
+		mColorRangeMax = std::max(aStart, mColorRangeMax - (aEnd - aStart));
+	Colorize(aStart - 1, 2);
+
 	OnLinesDeleted(aStart, aEnd);
 }
 
@@ -553,8 +556,13 @@ void TextEditor::RemoveLine(int aIndex, const std::unordered_set<int>* aHandledC
 	assert(mLines.size() > 1);
 
 	mLines.erase(mLines.begin() + aIndex);
+	mLineStates.erase(mLineStates.begin() + aIndex);
 	assert(!mLines.empty());
 
+	if (mColorRangeMax > aIndex)
+		mColorRangeMax--;
+	Colorize(aIndex - 1, 2);
+
 	OnLineDeleted(aIndex, aHandledCursors);
 }
 
@@ -657,8 +665,13 @@ TextEditor::Line& TextEditor::InsertLine(int aIndex) {
 	assert(!mReadOnly);
 
 	auto& result = *mLines.insert(mLines.begin() + aIndex, Line());
+	mLineStates.insert(mLineStates.begin() + aIndex, LineState());
 	OnLineAdded(aIndex);
 
+	if (mColorRangeMax > aIndex)
+		mColorRangeMax++;
+	Colorize(aIndex - 1, 2);
+
 	return result;
 }
 
@@ -1208,6 +1221,7 @@ void TextEditor::SetText(const std::string& aText) {
 		}
 	}
 
+	mLineStates.assign(mLines.size(), LineState());
 	mScrollToTop = true;
 
 	mUndoBuffer.clear();
@@ -1233,6 +1247,7 @@ void TextEditor::SetTextLines(const std::vector<std::string>& aLines) {
 		}
 	}
 
+	mLineStates.assign(mLines.size(), LineState());
 	mScrollToTop = true;
 
 	mUndoBuffer.clear();
@@ -1319,6 +1334,8 @@ void TextEditor::MoveUpCurrentLines() {
 	u.mOperations.push_back({ GetText(start, end), start, end, UndoOperationType::Add });
 	u.mAfter = mState;
 	AddUndo(u);
+
+	Colorize(minLine - 1, maxLine - minLine + 2);
 }
 
 void TextEditor::MoveDownCurrentLines() {
@@ -1360,6 +1377,8 @@ void TextEditor::MoveDownCurrentLines() {
 	u.mOperations.push_back({ GetText(start, end), start, end, UndoOperationType::Add });
 	u.mAfter = mState;
 	AddUndo(u);
+
+	Colorize(minLine, maxLine - minLine + 2);
 }
 
 void TextEditor::ToggleLineComment() {
@@ -2162,216 +2181,202 @@ void TextEditor::Colorize(int aFromLine, int aLines) {
 	mColorRangeMax = std::max(mColorRangeMax, toLine);
 	mColorRangeMin = std::max(0, mColorRangeMin);
 	mColorRangeMax = std::max(mColorRangeMin, mColorRangeMax);
-	mCheckComments = true;
 }
 
-void TextEditor::ColorizeRange(int aFromLine, int aToLine) {
-	if (mLines.empty() || aFromLine >= aToLine || mLanguageDefinition == nullptr)
-		return;
-
-	std::string buffer;
-	std::cmatch results;
-	std::string id;
-
-	int endLine = std::max(0, std::min((int) mLines.size(), aToLine));
-	for (int i = aFromLine; i < endLine; ++i) {
-		auto& line = mLines[i];
-
-		if (line.empty())
-			continue;
-
-		buffer.resize(line.size());
-		for (size_t j = 0; j < line.size(); ++j) {
-			auto& col = line[j];
-			buffer[j] = col.mChar;
-			col.mColorIndex = PaletteIndex::Default;
-		}
+TextEditor::LineState TextEditor::ColorizeLine(int aLine, const LineState& aState) {
+	auto& line = mLines[aLine];
 
-		const char* bufferBegin = &buffer.front();
-		const char* bufferEnd = bufferBegin + buffer.size();
+	// comments, strings and preprocessor directives can span lines, so they are resolved first, starting
+	// from the state the previous line ended with
+	auto withinMultiLineComment = aState.mWithinMultiLineComment;
+	auto withinString = aState.mWithinString;
+	auto withinSingleLineComment = aState.mConcatenate && aState.mWithinSingleLineComment;
+	auto withinPreproc = aState.mConcatenate && aState.mWithinPreproc;
+	auto firstChar = !aState.mConcatenate || aState.mFirstChar;	// there is no other non-whitespace characters in the line before
+	auto concatenate = false;
 
-		auto last = bufferEnd;
+	auto pred = [](const char& a, const Glyph& b) { return a == b.mChar; };
+	auto& startStr = mLanguageDefinition->mCommentStart;
+	auto& endStr = mLanguageDefinition->mCommentEnd;
+	auto& singleStartStr = mLanguageDefinition->mSingleLineComment;
 
-		for (auto first = bufferBegin; first != last; ) {
-			const char* token_begin = nullptr;
-			const char* token_end = nullptr;
-			PaletteIndex token_color = PaletteIndex::Default;
+	for (auto& glyph : line) {
+		glyph.mComment = false;
+		glyph.mMultiLineComment = false;
+		glyph.mPreprocessor = false;
+	}
 
-			bool hasTokenizeResult = false;
+	int currentIndex = 0;
+	while (currentIndex < (int) line.size()) {
+		auto c = line[currentIndex].mChar;
 
-			if (mLanguageDefinition->mTokenize != nullptr) {
-				if (mLanguageDefinition->mTokenize(first, last, token_begin, token_end, token_color))
-					hasTokenizeResult = true;
-			}
+		if (c != mLanguageDefinition->mPreprocChar && !isspace(c))
+			firstChar = false;
 
-			if (hasTokenizeResult == false) {
-				// todo : remove
-				//printf("using regex for %.*s\n", first + 10 < last ? 10 : int(last - first), first);
+		concatenate = currentIndex == (int) line.size() - 1 && c == '\\';
 
-				for (const auto& p : mRegexList) {
-					if (std::regex_search(first, last, results, p.first, std::regex_constants::match_continuous)) {
-						hasTokenizeResult = true;
+		if (withinString) {
+			line[currentIndex].mMultiLineComment = withinMultiLineComment;
 
-						auto& v = *results.begin();
-						token_begin = v.first;
-						token_end = v.second;
-						token_color = p.second;
-						break;
-					}
-				}
+			if (c == '\"') {
+				if (currentIndex + 1 < (int) line.size() && line[currentIndex + 1].mChar == '\"') {
+					currentIndex += 1;
+					line[currentIndex].mMultiLineComment = withinMultiLineComment;
+				} else
+					withinString = false;
+			} else if (c == '\\') {
+				currentIndex += 1;
+				if (currentIndex < (int) line.size())
+					line[currentIndex].mMultiLineComment = withinMultiLineComment;
 			}
+		} else {
+			if (firstChar && c == mLanguageDefinition->mPreprocChar)
+				withinPreproc = true;
 
-			if (hasTokenizeResult == false) {
-				first++;
+			if (c == '\"' && !withinMultiLineComment && !withinSingleLineComment) {
+				withinString = true;
 			} else {
-				const size_t token_length = token_end - token_begin;
-
-				if (token_color == PaletteIndex::Identifier) {
-					id.assign(token_begin, token_end);
-
-					// todo : allmost all language definitions use lower case to specify keywords, so shouldn't this use ::tolower ?
-					if (!mLanguageDefinition->mCaseSensitive)
-						std::transform(id.begin(), id.end(), id.begin(), ::toupper);
-
-					if (!line[first - bufferBegin].mPreprocessor) {
-						if (mLanguageDefinition->mKeywords.count(id) != 0)
-							token_color = PaletteIndex::Keyword;
-						else if (mLanguageDefinition->mIdentifiers.count(id) != 0)
-							token_color = PaletteIndex::KnownIdentifier;
-						else if (mLanguageDefinition->mPreprocIdentifiers.count(id) != 0)
-							token_color = PaletteIndex::PreprocIdentifier;
-					} else {
-						if (mLanguageDefinition->mPreprocIdentifiers.count(id) != 0)
-							token_color = PaletteIndex::PreprocIdentifier;
-					}
+				auto from = line.begin() + currentIndex;
+
+				if (!withinSingleLineComment && currentIndex + startStr.size() <= line.size() &&
+					equals(startStr.begin(), startStr.end(), from, from + startStr.size(), pred)) {
+					withinMultiLineComment = true;
+				} else if (singleStartStr.size() > 0 &&
+						  currentIndex + singleStartStr.size() <= line.size() &&
+						  equals(singleStartStr.begin(), singleStartStr.end(), from, from + singleStartStr.size(), pred)) {
+					withinSingleLineComment = true;
 				}
 
-				for (size_t j = 0; j < token_length; ++j)
-					line[(token_begin - bufferBegin) + j].mColorIndex = token_color;
+				line[currentIndex].mMultiLineComment = withinMultiLineComment;
+				line[currentIndex].mComment = withinSingleLineComment;
 
-				first = token_end;
+				if (currentIndex + 1 >= (int) endStr.size() &&
+					equals(endStr.begin(), endStr.end(), from + 1 - endStr.size(), from + 1, pred)) {
+					withinMultiLineComment = false;
+				}
 			}
 		}
+		if (currentIndex < (int) line.size())
+			line[currentIndex].mPreprocessor = withinPreproc;
+		currentIndex += UTF8CharLength(c);
 	}
-}
-
-void TextEditor::ColorizeInternal() {
-	if (mLines.empty() || !mColorizerEnabled || mLanguageDefinition == nullptr)
-		return;
 
-	if (mCheckComments) {
-		auto endLine = mLines.size();
-		auto endIndex = 0;
-		auto commentStartLine = endLine;
-		auto commentStartIndex = endIndex;
-		auto withinString = false;
-		auto withinSingleLineComment = false;
-		auto withinPreproc = false;
-		auto firstChar = true;			// there is no other non-whitespace characters in the line before
-		auto concatenate = false;		// '\' on the very end of the line
-		auto currentLine = 0;
-		auto currentIndex = 0;
-		while (currentLine < endLine || currentIndex < endIndex) {
-			auto& line = mLines[currentLine];
-
-			if (currentIndex == 0 && !concatenate) {
-				withinSingleLineComment = false;
-				withinPreproc = false;
-				firstChar = true;
-			}
+	LineState result;
+	result.mWithinMultiLineComment = withinMultiLineComment;
+	result.mWithinString = withinString;
+	result.mConcatenate = concatenate;
+	if (concatenate) {
+		result.mWithinSingleLineComment = withinSingleLineComment;
+		result.mWithinPreproc = withinPreproc;
+		result.mFirstChar = firstChar;
+	}
 
-			concatenate = false;
+	if (line.empty() || mLanguageDefinition->mTokenize == nullptr)
+		return result;
 
-			if (!line.empty()) {
-				auto& g = line[currentIndex];
-				auto c = g.mChar;
+	mColorizeBuffer.resize(line.size());
+	for (size_t j = 0; j < line.size(); ++j) {
+		auto& col = line[j];
+		mColorizeBuffer[j] = col.mChar;
+		col.mColorIndex = PaletteIndex::Default;
+	}
 
-				if (c != mLanguageDefinition->mPreprocChar && !isspace(c))
-					firstChar = false;
+	const char* bufferBegin = &mColorizeBuffer.front();
+	const char* bufferEnd = bufferBegin + mColorizeBuffer.size();
 
-				if (currentIndex == (int) line.size() - 1 && line[line.size() - 1].mChar == '\\')
-					concatenate = true;
+	auto last = bufferEnd;
 
-				bool inComment = (commentStartLine < currentLine || (commentStartLine == currentLine && commentStartIndex <= currentIndex));
+	std::string id;
+	for (auto first = bufferBegin; first != last; ) {
+		const char* token_begin = nullptr;
+		const char* token_end = nullptr;
+		PaletteIndex token_color = PaletteIndex::Default;
 
-				if (withinString) {
-					line[currentIndex].mMultiLineComment = inComment;
+		if (!mLanguageDefinition->mTokenize(first, last, token_begin, token_end, token_color)) {
+			first++;
+			continue;
+		}
 
-					if (c == '\"') {
-						if (currentIndex + 1 < (int) line.size() && line[currentIndex + 1].mChar == '\"') {
-							currentIndex += 1;
-							if (currentIndex < (int) line.size())
-								line[currentIndex].mMultiLineComment = inComment;
-						} else
-							withinString = false;
-					} else if (c == '\\') {
-						currentIndex += 1;
-						if (currentIndex < (int) line.size())
-							line[currentIndex].mMultiLineComment = inComment;
-					}
-				} else {
-					if (firstChar && c == mLanguageDefinition->mPreprocChar)
-						withinPreproc = true;
-
-					if (c == '\"') {
-						withinString = true;
-						line[currentIndex].mMultiLineComment = inComment;
-					} else {
-						auto pred = [](const char& a, const Glyph& b) { return a == b.mChar; };
-						auto from = line.begin() + currentIndex;
-						auto& startStr = mLanguageDefinition->mCommentStart;
-						auto& singleStartStr = mLanguageDefinition->mSingleLineComment;
-
-						if (!withinSingleLineComment && currentIndex + startStr.size() <= line.size() &&
-							equals(startStr.begin(), startStr.end(), from, from + startStr.size(), pred)) {
-							commentStartLine = currentLine;
-							commentStartIndex = currentIndex;
-						} else if (singleStartStr.size() > 0 &&
-								  currentIndex + singleStartStr.size() <= line.size() &&
-								  equals(singleStartStr.begin(), singleStartStr.end(), from, from + singleStartStr.size(), pred)) {
-							withinSingleLineComment = true;
-						}
+		const size_t token_length = token_end - token_begin;
 
-						inComment = (commentStartLine < currentLine || (commentStartLine == currentLine && commentStartIndex <= currentIndex));
+		if (token_color == PaletteIndex::Identifier) {
+			id.assign(token_begin, token_end);
 
-						line[currentIndex].mMultiLineComment = inComment;
-						line[currentIndex].mComment = withinSingleLineComment;
+			// todo : allmost all language definitions use lower case to specify keywords, so shouldn't this use ::tolower ?
+			if (!mLanguageDefinition->mCaseSensitive)
+				std::transform(id.begin(), id.end(), id.begin(), ::toupper);
 
-						auto& endStr = mLanguageDefinition->mCommentEnd;
-						if (currentIndex + 1 >= (int) endStr.size() &&
-							equals(endStr.begin(), endStr.end(), from + 1 - endStr.size(), from + 1, pred)) {
-							commentStartIndex = endIndex;
-							commentStartLine = endLine;
-						}
-					}
-				}
-				if (currentIndex < (int) line.size())
-					line[currentIndex].mPreprocessor = withinPreproc;
-				currentIndex += UTF8CharLength(c);
-				if (currentIndex >= (int) line.size()) {
-					currentIndex = 0;
-					++currentLine;
-				}
+			if (!line[first - bufferBegin].mPreprocessor) {
+				if (mLanguageDefinition->mKeywords.count(id) != 0)
+					token_color = PaletteIndex::Keyword;
+				else if (mLanguageDefinition->mIdentifiers.count(id) != 0)
+					token_color = PaletteIndex::KnownIdentifier;
+				else if (mLanguageDefinition->mPreprocIdentifiers.count(id) != 0)
+					token_color = PaletteIndex::PreprocIdentifier;
 			} else {
-				currentIndex = 0;
-				++currentLine;
+				if (mLanguageDefinition->mPreprocIdentifiers.count(id) != 0)
+					token_color = PaletteIndex::PreprocIdentifier;
 			}
 		}
-		mCheckComments = false;
+
+		for (size_t j = 0; j < token_length; ++j)
+			line[(token_begin - bufferBegin) + j].mColorIndex = token_color;
+
+		first = token_end;
+	}
+
+	return result;
+}
+
+void TextEditor::ColorizeInternal() {
+	mColorizedLines = 0;
+	mColorizeTime = 0.0f;
+
+	if (mLines.empty() || !mColorizerEnabled || mLanguageDefinition == nullptr)
+		return;
+
+	if (mLineStates.size() != mLines.size()) {
+		mLineStates.resize(mLines.size());
+		Colorize();
 	}
 
-	if (mColorRangeMin < mColorRangeMax) {
-		const int increment = (mLanguageDefinition->mTokenize == nullptr) ? 10 : 10000;
-		const int to = std::min(mColorRangeMin + increment, mColorRangeMax);
-		ColorizeRange(mColorRangeMin, to);
-		mColorRangeMin = to;
+	if (mColorRangeMin >= mColorRangeMax)
+		return;
 
-		if (mColorRangeMax == mColorRangeMin) {
-			mColorRangeMin = std::numeric_limits<int>::max();
-			mColorRangeMax = 0;
+	// lines in [mColorRangeMin, mColorRangeMax) were edited, lines past that are relexed only until the
+	// state at a line start matches the one stored for it, after which nothing below can change
+	const auto start = std::chrono::steady_clock::now();
+	const auto budget = std::chrono::duration<float, std::milli>(mColorizerTimeBudget);
+	const int lineCount = (int) mLines.size();
+
+	int currentLine = mColorRangeMin;
+	LineState state = currentLine < lineCount ? mLineStates[currentLine] : LineState();
+	bool converged = currentLine >= lineCount;
+	while (!converged) {
+		state = ColorizeLine(currentLine, state);
+		++currentLine;
+		++mColorizedLines;
+
+		if (currentLine >= lineCount) {
+			converged = true;
+		} else {
+			converged = currentLine >= mColorRangeMax && mLineStates[currentLine] == state;
+			mLineStates[currentLine] = state;
 		}
-		return;
+
+		// checking the clock is cheap, but not free; a line rarely takes more than a few microseconds
+		if (!converged && (mColorizedLines & 63) == 0 && std::chrono::steady_clock::now() - start >= budget)
+			break;
+	}
+
+	if (converged) {
+		mColorRangeMin = std::numeric_limits<int>::max();
+		mColorRangeMax = 0;
+	} else {
+		mColorRangeMin = currentLine;
+		mColorRangeMax = std::max(mColorRangeMax, currentLine + 1);
 	}
+	mColorizeTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
 }
 
 float TextEditor::TextDistanceToLineStart(const Coordinates& aFrom) const {
@@ -10,7 +10,6 @@
 #include <unordered_set>
 #include <unordered_map>
 #include <map>
-#include <regex>
 #include <algorithm>
 
 class IMGUI_API TextEditor {
@@ -165,8 +164,6 @@ public:
 	typedef std::vector<Line> Lines;
 
 	struct LanguageDefinition {
-		typedef std::pair<std::string, PaletteIndex> TokenRegexString;
-		typedef std::vector<TokenRegexString> TokenRegexStrings;
 		typedef bool(*TokenizeCallback)(const char* in_begin, const char* in_end, const char*& out_begin, const char*& out_end, PaletteIndex& paletteIndex);
 
 		std::string mName;
@@ -178,8 +175,6 @@ public:
 
 		TokenizeCallback mTokenize;
 
-		TokenRegexStrings mTokenRegexStrings;
-
 		bool mCaseSensitive;
 
 		LanguageDefinition()
@@ -238,7 +233,10 @@ public:
 	void OnCursorPositionChanged();
 
 	bool IsColorizerEnabled() const { return mColorizerEnabled; }
+	bool IsColorizing() const { return mColorizerEnabled && mColorRangeMin < mColorRangeMax; }
 	void SetColorizerEnable(bool aValue);
+	float GetColorizerTimeBudget() const { return mColorizerTimeBudget; }
+	void SetColorizerTimeBudget(float aMilliseconds) { mColorizerTimeBudget = aMilliseconds; }
 
 	Coordinates GetCursorPosition() const { return GetActualCursorCoordinates(); }
 	void SetCursorPosition(const Coordinates& aPosition, int aCursor = -1, bool aClearSelection = true);
@@ -328,12 +326,28 @@ public:
 
 	void ImGuiDebugPanel(const std::string& panelName = "Debug");
 	void UnitTests();
+	// Times the colorizer on a scratch editor with this one's language and time budget, this editor is left untouched
+	std::string ColorizerBenchmark(int aLineCount = 20000, int aKeystrokes = 200) const;
 private:
+	std::string RunColorizerBenchmark(int aLineCount, int aKeystrokes);
 	inline bool IsUTFSequence(char c) const {
 		return (c & 0xC0) == 0x80;
 	}
 
-	typedef std::vector<std::pair<std::regex, PaletteIndex>> RegexList;
+	// Lexer state carried over a line break. One is kept for the start of every line, so recolorizing
+	// after an edit can stop at the first line whose start state did not change.
+	struct LineState {
+		bool mWithinMultiLineComment = false;
+		bool mWithinString = false;
+		bool mWithinSingleLineComment = false;
+		bool mWithinPreproc = false;
+		bool mFirstChar = true;
+		bool mConcatenate = false;   // '\' on the very end of the line
+
+		bool operator==(const LineState&) const = default;
+	};
+
+	typedef std::vector<LineState> LineStates;
 
 	void MergeCursorsIfPossible();
 
@@ -360,7 +374,7 @@ private:
 
 	void ProcessInputs();
 	void Colorize(int aFromLine = 0, int aCount = -1);
-	void ColorizeRange(int aFromLine = 0, int aToLine = 0);
+	LineState ColorizeLine(int aLine, const LineState& aState);
 	void ColorizeInternal();
 	float TextDistanceToLineStart(const Coordinates& aFrom) const;
 	void EnsureCursorVisible(int aCursor = -1);
@@ -426,16 +440,19 @@ private:
 	float mTextStart;                   // position (in pixels) where a code line starts relative to the left of the TextEditor.
 	int  mLeftMargin;
 	int mColorRangeMin, mColorRangeMax;
+	float mColorizerTimeBudget;         // milliseconds of colorizing per frame
+	LineStates mLineStates;
+	int mColorizedLines;                // lines lexed by the last ColorizeInternal call
+	float mColorizeTime;                // milliseconds spent in the last ColorizeInternal call
 	bool mShowWhitespaces;
 
 	Palette mPaletteBase;
 	Palette mPalette;
 	const LanguageDefinition* mLanguageDefinition = nullptr;
-	RegexList mRegexList;
 
-	bool mCheckComments;
 	ImVec2 mCharAdvance;
 	std::string mLineBuffer;
+	std::string mColorizeBuffer;
 	uint64_t mStartTime;
 
 	float mLastClick;
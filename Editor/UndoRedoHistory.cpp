@@ -1,9 +1,12 @@
 #include <Editor/UndoRedoHistory.hpp>
 
 #include <cmath>
+#include <string>
 
 #include <imgui.h>
 
+#include <Utility/FormatBytes.hpp>
+
 #include <Editor/GUI.hpp>
 #include <Editor/Icons.hpp>
 #include <Editor/Strings.hpp>
@@ -26,8 +29,26 @@ bool UndoRedoHistory::Begin() noexcept {
     return visible;
 }
 
+static void RenderCommand(const GUICommand& command) noexcept {
+    ImGui::TextUnformatted(command.GetDescription().data());
+
+    std::string size = FormatBytes(static_cast<float>(command.RetainedBytes()));
+    ImGui::SameLine(ImGui::GetContentRegionMax().x - ImGui::CalcTextSize(size.c_str()).x);
+    ImGui::TextDisabled("%s", size.c_str());
+}
+
 void UndoRedoHistory::Render() noexcept {
     GUI& gui = this->gui.get();
+    const UndoRedoStack& history = gui.GetCommandHistory();
+    std::string usage = FormatBytes(static_cast<float>(history.MemoryUsage()));
+    std::string budget = FormatBytes(static_cast<float>(history.MemoryBudget()));
+    ImGui::Text("Memory: %s / %s", usage.c_str(), budget.c_str());
+    if (history.EvictedCount() > 0) {
+        ImGui::SameLine();
+        ImGui::TextDisabled("(%zu dropped)", history.EvictedCount());
+    }
+    ImGui::Separator();
+
     ImGui::BeginDisabled();
     UndoRedoStack::RedoStackIterator r_it{ gui.GetCommandHistory() };
     while(r_it.HasNext()) {
@@ -35,7 +56,7 @@ void UndoRedoHistory::Render() noexcept {
         const GUICommand* guiCommand = dynamic_cast<GUICommand*>(&command);
         if (!guiCommand) { continue; }
 
-        ImGui::TextUnformatted(guiCommand->GetDescription().data());
+        RenderCommand(*guiCommand);
     }
     ImGui::EndDisabled();
 
@@ -74,7 +95,7 @@ void UndoRedoHistory::Render() noexcept {
         const GUICommand* guiCommand = dynamic_cast<GUICommand*>(&command);
         if (!guiCommand) { continue; }
 
-        ImGui::TextUnformatted(guiCommand->GetDescription().data());
+        RenderCommand(*guiCommand);
     }
 }
 
@@ -6,6 +6,7 @@
 #include <Engine/ImGuiRenderer.hpp>
 
 #include <Editor/GUI.hpp>
+#include <Editor/Icons.hpp>
 #include <Editor/OutlineAttachment.hpp>
 
 WindowIconPack::IconData LoadIcon(std::string_view path) noexcept {
@@ -23,6 +24,32 @@ WindowIconPack::IconData LoadIcon(std::string_view path) noexcept {
     return data;
 }
 
+std::vector<std::string> CollectPreloadedIconKeys() noexcept {
+    std::vector<std::string> keys{
+        GUI::FOLDER_ICON_KEY, GUI::PROJECT_ICON_KEY, GUI::SCENE_ICON_KEY, GUI::COMPONENT_ICON_KEY,
+        GUI::SAMPLER_ICON_KEY, GUI::TEXTURE_ICON_KEY, GUI::VERTEX_SHADER_ICON_KEY, GUI::TESS_CTRL_SHADER_ICON_KEY,
+        GUI::TESS_EVAL_SHADER_ICON_KEY, GUI::GEOMETRY_SHADER_ICON_KEY, GUI::FRAGMENT_SHADER_ICON_KEY, GUI::COMPUTE_SHADER_ICON_KEY,
+        GUI::MATERIAL_ICON_KEY, GUI::FRAMEBUFFER_ICON_KEY, GUI::FILE_ICON_KEY, GUI::BACK_ARROW_ICON_KEY
+    };
+    auto append = [&keys](const auto& icons) {
+        for (const auto& [_, key] : icons) { keys.push_back(key); }
+    };
+    append(FileIcons::DirectoryIcons);
+    append(FileIcons::SceneIcons);
+    append(FileIcons::ComponentIcons);
+    append(FileIcons::SamplerIcons);
+    append(FileIcons::TextureIcons);
+    append(FileIcons::ShaderIcons);
+    append(FileIcons::ShaderProgramIcons);
+    append(FileIcons::MaterialIcons);
+    append(FileIcons::FrameBufferIcons);
+    append(FileIcons::RegularFileIcons);
+
+    std::ranges::sort(keys);
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    return keys;
+}
+
 int main(int argc, char* argv[]) {
     DOA_LOG_TRACE("NeoDoa Editor");
     DOA_LOG_TRACE("//- CMD Arguments -//");
@@ -78,7 +105,7 @@ int main(int argc, char* argv[]) {
 
     DOA_LOG_INFO("Initializing SVG Pathway @ %s", std::filesystem::current_path().string().c_str());
     ImVec4 txtColor = ImGui::GetStyle().Colors[ImGuiCol_Text];
-    SVGPathway::Initialize(std::filesystem::current_path(), { txtColor.x, txtColor.y, txtColor.z, txtColor.w });
+    SVGPathway::Initialize(std::filesystem::current_path(), { txtColor.x, txtColor.y, txtColor.z, txtColor.w }, CollectPreloadedIconKeys());
     DOA_LOG_INFO("Initialized SVG Pathway");
 
     DOA_LOG_INFO("Allocating %d bytes...", sizeof(GUI));
@@ -88,6 +115,7 @@ int main(int argc, char* argv[]) {
     ImGuiAddRenderCommand([gui = gui_ptr](float delta) { gui->operator()(delta); });
 
     core->CreateAttachment<OutlineAttachment>(gui_ptr);
+    core->SetIdleSettings({ .Enabled = true });
     core->Start();
     Core::DestroyCore();
 
@@ -24,8 +24,9 @@ Asset::Asset() noexcept :
 Asset::Asset(const UUID id, FNode* file) noexcept :
     id(id),
     file(file) {}
-Asset::~Asset() noexcept { NotifyObservers("destructed"_hs); }
-Asset::Asset(Asset&& other) noexcept : ObserverPattern::Observable(std::move(other)),
+Asset::~Asset() noexcept { notifications.Publish(AssetEvent::Destructed{ *this }); }
+Asset::Asset(Asset&& other) noexcept :
+    notifications(std::move(other.notifications)),
     id(std::exchange(other.id, UUID::Empty())),
     file(std::exchange(other.file, nullptr)),
     data(std::move(other.data)),
@@ -33,10 +34,10 @@ Asset::Asset(Asset&& other) noexcept : ObserverPattern::Observable(std::move(oth
     infoList(std::move(other.infoList)),
     warningList(std::move(other.warningList)),
     errorList(std::move(other.errorList)) {
-    NotifyObservers("moved"_hs);
+    notifications.Publish(AssetEvent::Moved{ *this });
 }
 Asset& Asset::operator=(Asset&& other) noexcept {
-    ObserverPattern::Observable::operator=(std::move(other));
+    notifications = std::move(other.notifications);
     id = std::exchange(other.id, UUID::Empty());
     file = std::exchange(other.file, nullptr);
     DeleteDeserializedData();
@@ -45,7 +46,7 @@ Asset& Asset::operator=(Asset&& other) noexcept {
     infoList = std::move(other.infoList);
     warningList = std::move(other.warningList);
     errorList = std::move(other.errorList);
-    NotifyObservers("moved"_hs);
+    notifications.Publish(AssetEvent::Moved{ *this });
     return *this;
 }
 
@@ -200,7 +201,10 @@ void Asset::Deserialize() {
     * TODO others
     */
     version++;
-    NotifyObservers("deserialized"_hs);
+    notifications.Publish(AssetEvent::Deserialized{ *this });
+    if (!notifications.IsQueued<AssetEvent::Reloaded>()) {
+        notifications.Enqueue(AssetEvent::Reloaded{ *this });
+    }
 }
 void Asset::ForceDeserialize() {
     DeleteDeserializedData();
@@ -212,7 +216,7 @@ void Asset::DeleteDeserializedData() {
     warningList.clear();
     errorList.clear();
     version++;
-    NotifyObservers("data_deleted"_hs);
+    notifications.Publish(AssetEvent::DataDeleted{ *this });
 }
 bool Asset::HasDeserializedData() const { return !std::holds_alternative<std::monostate>(data); }
 
@@ -240,4 +244,4 @@ const std::vector<std::any>& Asset::WarningMessages() const { return warningList
 bool Asset::HasErrorMessages() const { return !errorList.empty(); }
 const std::vector<std::any>& Asset::ErrorMessages() const { return errorList; }
 
-void Asset::NotifyObservers(ObserverPattern::Notification message) { ObserverPattern::Observable::NotifyObservers(message); }
+AssetNotificationBus& Asset::Notifications() { return notifications; }
@@ -3,10 +3,10 @@
 #include <any>
 #include <variant>
 
-#include <Utility/ObserverPattern.hpp>
 #include <Utility/TemplateUtilities.hpp>
 
 #include <Engine/UUID.hpp>
+#include <Engine/NotificationBus.hpp>
 #include <Engine/FileNode.hpp>
 #include <Engine/Scene.hpp>
 #include <Engine/Component.hpp>
@@ -25,11 +25,26 @@ concept AssetType = concepts::IsAnyOf<T, ASSET_TYPE> && concepts::Copyable<T> &&
 using AssetData = std::variant<std::monostate, ASSET_TYPE>;
 #undef ASSET_TYPE
 
-struct Asset final : ObserverPattern::Observable {
+struct Asset;
+
+namespace AssetEvent {
+    struct Deserialized { const Asset& Source; };
+    /* Queued by every deserialization, at most once until delivered by Assets::FlushNotifications at the end of
+    the frame. For listeners rebuilding their own data from the asset, which only need its latest state. */
+    struct Reloaded { const Asset& Source; };
+    struct DataDeleted { const Asset& Source; };
+    /* Source is the new address, the asset was moved into it. Assets in Assets' storage never move, hold an
+    AssetHandle to them instead of tracking this. */
+    struct Moved { Asset& Source; };
+    struct Destructed { const Asset& Source; };
+}
+using AssetNotificationBus = NotificationBus<AssetEvent::Deserialized, AssetEvent::Reloaded, AssetEvent::DataDeleted, AssetEvent::Moved, AssetEvent::Destructed>;
+
+struct Asset final {
 
     Asset() noexcept;
     Asset(const UUID id, FNode* file) noexcept;
-    ~Asset() noexcept override;
+    ~Asset() noexcept;
     Asset(const Asset& other) = delete;
     Asset(Asset&& other) noexcept;
     Asset& operator=(const Asset& other) = delete;
@@ -81,10 +96,10 @@ struct Asset final : ObserverPattern::Observable {
     bool HasErrorMessages() const;
     const std::vector<std::any>& ErrorMessages() const;
 
-protected:
-    void NotifyObservers(ObserverPattern::Notification message) final;
+    AssetNotificationBus& Notifications();
 
 private:
+    AssetNotificationBus notifications{};
     UUID id{ UUID::Empty() };
     FNode* file{ nullptr };
     AssetData data{ std::monostate{} };
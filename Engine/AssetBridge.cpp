@@ -123,7 +123,7 @@ std::vector<FrameBufferAllocatorMessage> GPUFrameBuffers::Allocate(const Assets&
 
     auto [gpuFrameBuffer, messages] = builder.Build();
     if (gpuFrameBuffer.has_value()) {
-        database[asset] = std::move(gpuFrameBuffer.value());
+        Store(assets, asset, std::move(gpuFrameBuffer.value()));
     } else {
         DOA_LOG_ERROR("FrameBuffer allocation failed for %s (UUID: %s). Aborting.", frameBuffer.Name.c_str(), asset.AsString().c_str());
     }
@@ -142,7 +142,7 @@ std::vector<ShaderCompilerMessage> GPUShaders::Allocate(const Assets& assets, co
 
     auto [gpuShader, messages] = builder.Build();
     if (gpuShader.has_value()) {
-        database[asset] = std::move(gpuShader.value());
+        Store(assets, asset, std::move(gpuShader.value()));
     } else {
         DOA_LOG_ERROR("Shader allocation failed for %s (UUID: %s). Aborting.", shader.Name.c_str(), asset.AsString().c_str());
     }
@@ -221,7 +221,7 @@ std::vector<ShaderLinkerMessage> GPUShaderPrograms::Allocate(const Assets& asset
 
     auto [gpuShaderProgram, messages] = builder.Build();
     if (gpuShaderProgram.has_value()) {
-        database[asset] = std::move(gpuShaderProgram.value());
+        Store(assets, asset, std::move(gpuShaderProgram.value()));
     } else {
         DOA_LOG_ERROR("Shader program allocation failed for %s (UUID: %s). Aborting.", program.Name.c_str(), asset.AsString().c_str());
     }
@@ -251,9 +251,9 @@ std::vector<SamplerAllocatorMessage> GPUSamplers::Allocate(const Assets& assets,
         .SetMaxAnisotropy(sampler.MaxAnisotropy)
         .SetCubemapSeamless(sampler.CubemapSeamless);
 
-    auto [gpuSampler, messages] = builder.Build();
-    if (gpuSampler.has_value()) {
-        database[asset] = std::move(gpuSampler.value());
+    auto [gpuSampler, messages] = bridge.GetSamplerCache().Get(builder);
+    if (gpuSampler != nullptr) {
+        Store(assets, asset, std::move(gpuSampler));
     } else {
         DOA_LOG_ERROR("Sampler allocation failed for %s (UUID: %s). Aborting.", sampler.Name.c_str(), asset.AsString().c_str());
     }
@@ -276,7 +276,7 @@ std::vector<TextureAllocatorMessage> GPUTextures::Allocate(const Assets& assets,
 
     auto [gpuTexture, messages] = builder.Build();
     if (gpuTexture.has_value()) {
-        database[asset] = std::move(gpuTexture.value());
+        Store(assets, asset, std::move(gpuTexture.value()));
     } else {
         DOA_LOG_ERROR("Texture allocation failed for %s (UUID: %s). Aborting.", texture.Name.c_str(), asset.AsString().c_str());
     }
@@ -304,4 +304,13 @@ const GPUShaders& AssetGPUBridge::GetShaders() const noexcept               { re
 GPUShaderPrograms& AssetGPUBridge::GetShaderPrograms() noexcept             { return gpuShaderPrograms; }
 const GPUShaderPrograms& AssetGPUBridge::GetShaderPrograms() const noexcept { return gpuShaderPrograms; }
 GPUFrameBuffers& AssetGPUBridge::GetFrameBuffers() noexcept                 { return gpuFrameBuffers;   }
-const GPUFrameBuffers& AssetGPUBridge::GetFrameBuffers() const noexcept     { return gpuFrameBuffers;   }
\ No newline at end of file
+const GPUFrameBuffers& AssetGPUBridge::GetFrameBuffers() const noexcept     { return gpuFrameBuffers;   }
+GPUSamplerCache& AssetGPUBridge::GetSamplerCache() noexcept                 { return samplerCache;      }
+const GPUSamplerCache& AssetGPUBridge::GetSamplerCache() const noexcept     { return samplerCache;      }
+
+const GPUMemoryBudget& AssetGPUBridge::GetMemoryBudget() const noexcept { return memory; }
+void AssetGPUBridge::SetMemoryBudget(size_t bytes) noexcept { memory.Budget = bytes; }
+void AssetGPUBridge::EvictToBudget() noexcept {
+    gpuTextures.EvictToBudget();
+    samplerCache.Trim();
+}
\ No newline at end of file
@@ -1,55 +1,83 @@
 #pragma once
 
+#include <list>
 #include <vector>
+#include <cassert>
+#include <cstdint>
 #include <iomanip>
+#include <memory>
 #include <utility>
+#include <algorithm>
+#include <type_traits>
 #include <unordered_map>
 
-#include <entt/entt.hpp>
-
 #include <Engine/Log.hpp>
 #include <Engine/UUID.hpp>
 #include <Engine/Assets.hpp>
 #include <Engine/GPUShader.hpp>
 #include <Engine/GPUTexture.hpp>
 #include <Engine/GPUFrameBuffer.hpp>
+#include <Engine/GPUObjectCache.hpp>
 
 struct AssetGPUBridge;
 
+/* GPU memory held by the databases of one AssetGPUBridge. Every resource with a MemorySize is counted, only
+textures are evicted: they are rebuilt from their asset, framebuffer contents cannot be. Usage may exceed Budget
+within a frame, AssetGPUBridge::EvictToBudget brings it back down between frames. */
+struct GPUMemoryBudget {
+    static constexpr size_t DEFAULT_BUDGET{ 1024uLL * 1024 * 1024 };
+
+    size_t Budget{ DEFAULT_BUDGET };
+    size_t Usage{ 0 };
+    size_t Peak{ 0 };
+    uint64_t Evictions{ 0 };
+    uint64_t Reallocations{ 0 };
+
+    void Add(size_t bytes) noexcept { Usage += bytes; Peak = std::max(Peak, Usage); }
+    void Remove(size_t bytes) noexcept { assert(Usage >= bytes); Usage -= bytes; }
+    bool IsOverBudget() const noexcept { return Usage > Budget; }
+};
+
+/* Objects are heap allocated one by one and never move: a pointer or reference Fetch and Query hand out stays
+valid until that object itself is evicted or deallocated, whatever happens to the others. */
 template<typename T, typename ErrorMessageType>
 struct GPUObjectDatabase {
-#if DEBUG
-    using Database = std::unordered_map<UUID, T>;
-#elif NDEBUG
-    using Database = entt::dense_map<UUID, T>;
-#else
-#error "Neither DEBUG nor NDEBUG are defined!"
-#endif
-
-    explicit GPUObjectDatabase(AssetGPUBridge& bridge) noexcept :
-        bridge(bridge) {}
+    static constexpr bool EVICTABLE{ std::is_same_v<T, GPUTexture> };
+
+    GPUObjectDatabase(AssetGPUBridge& bridge, GPUMemoryBudget& memory) noexcept :
+        bridge(bridge),
+        memory(memory) {}
     ~GPUObjectDatabase() noexcept = default;
     GPUObjectDatabase(GPUObjectDatabase&) noexcept = delete;
     GPUObjectDatabase(GPUObjectDatabase&&) noexcept = delete;
     GPUObjectDatabase& operator=(GPUObjectDatabase&) noexcept = delete;
     GPUObjectDatabase& operator=(GPUObjectDatabase&&) noexcept = delete;
 
-    bool Exists(const UUID asset) const noexcept { return database.contains(asset); }
+    /* Evicted objects exist, Fetch and Query re-allocate them. */
+    bool Exists(const UUID asset) const noexcept { return residency.contains(asset); }
+    bool IsResident(const UUID asset) const noexcept {
+        auto it = residency.find(asset);
+        return it != residency.end() && it->second.Object != nullptr;
+    }
     T& Fetch(const UUID asset) noexcept {
         assert(Exists(asset));
-        return database[asset];
+        T* object = Resident(asset);
+        assert(object && "Re-allocation of an evicted object failed, use Query.");
+        return *object;
     }
     const T& Fetch(const UUID asset) const noexcept {
         assert(Exists(asset));
-        return database.at(asset);
+        const T* object = Resident(asset);
+        assert(object && "Re-allocation of an evicted object failed, use Query.");
+        return *object;
     }
     T* Query(const UUID asset) noexcept {
         if (!Exists(asset)) { return nullptr; }
-        return &Fetch(asset);
+        return Resident(asset);
     }
     const T* Query(const UUID asset) const noexcept {
         if (!Exists(asset)) { return nullptr; }
-        return &Fetch(asset);
+        return Resident(asset);
     }
 
     std::vector<ErrorMessageType> Allocate(const Assets& assets, const UUID asset) noexcept { DOA_LOG_FATAL("Illegal allocator! %s", std::quoted(assets.FindAsset(asset)->File().Name())); std::unreachable(); };
@@ -58,16 +86,95 @@ struct GPUObjectDatabase {
         return Allocate(assets, asset);
     }
     void Deallocate(const UUID asset) noexcept {
-        database.erase(asset);
+        auto it = residency.find(asset);
+        if (it == residency.end()) { return; }
+        Release(asset, it->second);
+        residency.erase(it);
+    }
+
+    /* Evicts least recently fetched objects until the budget holds or nothing evictable is left.
+    Invalidates pointers and references to evicted objects, call between frames. */
+    void EvictToBudget() noexcept {
+        if constexpr (EVICTABLE) {
+            while (memory.IsOverBudget() && !uses.empty()) {
+                const UUID asset = uses.back();
+                Release(asset, residency.at(asset));
+                memory.Evictions++;
+            }
+        }
     }
 
+    size_t MemoryUsage() const noexcept {
+        size_t usage = 0;
+        for (const auto& [asset, entry] : residency) { usage += entry.Bytes; }
+        return usage;
+    }
+    size_t ResidentCount() const noexcept { return residentCount; }
+
     const T& Missing() const noexcept {
         DOA_LOG_FATAL("Illegal missing resource!"); std::unreachable();
     }
 
 private:
+    struct Residency {
+        std::unique_ptr<T> Object{}; /* null while evicted */
+        const Assets* Source{ nullptr };
+        size_t Bytes{ 0 };
+        std::list<UUID>::iterator Use{};
+    };
+
     AssetGPUBridge& bridge;
-    Database database{};
+    GPUMemoryBudget& memory;
+    /* Residency outlives eviction, Source is what an evicted object is re-allocated from. The LRU and the
+    re-allocation are bookkeeping of a cache, so const lookups update them too. */
+    mutable std::unordered_map<UUID, Residency> residency{};
+    mutable std::list<UUID> uses{}; /* resident evictable objects, most recently fetched first */
+    mutable size_t residentCount{ 0 };
+
+    /* Called by the Allocate specializations instead of writing to residency directly. */
+    void Store(const Assets& assets, const UUID asset, T&& object) noexcept {
+        Deallocate(asset);
+        Residency& entry = residency[asset];
+        entry.Source = &assets;
+        if constexpr (requires { object.MemorySize(); }) {
+            entry.Bytes = object.MemorySize();
+        }
+        if constexpr (EVICTABLE) {
+            uses.push_front(asset);
+            entry.Use = uses.begin();
+        }
+        memory.Add(entry.Bytes);
+        entry.Object = std::make_unique<T>(std::move(object));
+        residentCount++;
+    }
+    void Release(const UUID asset, Residency& entry) noexcept {
+        if (!entry.Object) { return; }
+        entry.Object.reset();
+        residentCount--;
+        memory.Remove(entry.Bytes);
+        entry.Bytes = 0;
+        if constexpr (EVICTABLE) {
+            uses.erase(entry.Use);
+            entry.Use = {};
+        }
+    }
+    T* Resident(const UUID asset) const noexcept {
+        Residency* entry = &residency.at(asset);
+        if (!entry->Object) {
+            // Allocate only mutates the mutable members, the bridge owning this database is never const itself.
+            auto& self = const_cast<GPUObjectDatabase&>(*this);
+            self.Allocate(*entry->Source, asset);
+            memory.Reallocations++;
+            entry = &residency.at(asset); // Store replaced the entry
+            if (!entry->Object) {
+                residency.erase(asset); // the asset no longer builds, stop retrying on every lookup
+                return nullptr;
+            }
+        } else if constexpr (EVICTABLE) {
+            uses.splice(uses.begin(), uses, entry->Use);
+        }
+        return entry->Object.get();
+    }
 };
 
 #define ND_EXPLICIT_SPECIALIZE_ALLOCATOR(Name, T, ErrorMessageType) \
@@ -80,7 +187,7 @@ const T& Name::Missing() const noexcept
 ND_EXPLICIT_SPECIALIZE_ALLOCATOR(GPUFrameBuffers, GPUFrameBuffer, FrameBufferAllocatorMessage);
 ND_EXPLICIT_SPECIALIZE_ALLOCATOR(GPUShaders, GPUShader, ShaderCompilerMessage);
 ND_EXPLICIT_SPECIALIZE_ALLOCATOR(GPUShaderPrograms, GPUShaderProgram, ShaderLinkerMessage);
-ND_EXPLICIT_SPECIALIZE_ALLOCATOR(GPUSamplers, GPUSampler, SamplerAllocatorMessage);
+ND_EXPLICIT_SPECIALIZE_ALLOCATOR(GPUSamplers, GPUSamplerCache::Handle, SamplerAllocatorMessage);
 ND_EXPLICIT_SPECIALIZE_ALLOCATOR(GPUTextures, GPUTexture, TextureAllocatorMessage); ND_EXPLICIT_SPECIALIZE_ALLOCATOR_SPECIALIZE_MISSING(GPUTextures, GPUTexture);
 #undef ND_EXPLICIT_SPECIALIZE_ALLOCATOR
 #undef ND_EXPLICIT_SPECIALIZE_ALLOCATOR_SPECIALIZE_MISSING
@@ -97,13 +204,24 @@ struct AssetGPUBridge {
     const GPUShaderPrograms& GetShaderPrograms() const noexcept;
     GPUFrameBuffers& GetFrameBuffers() noexcept;
     const GPUFrameBuffers& GetFrameBuffers() const noexcept;
+    /* Sampler assets with identical settings share one GPUSampler through it. */
+    GPUSamplerCache& GetSamplerCache() noexcept;
+    const GPUSamplerCache& GetSamplerCache() const noexcept;
+
+    const GPUMemoryBudget& GetMemoryBudget() const noexcept;
+    /* Takes effect on the next EvictToBudget. */
+    void SetMemoryBudget(size_t bytes) noexcept;
+    /* Call once per frame, before anything is fetched. Also destroys the samplers no asset uses anymore. */
+    void EvictToBudget() noexcept;
 
 private:
-    GPUSamplers gpuSamplers{ *this };
-    GPUTextures gpuTextures{ *this };
-    GPUShaders gpuShaders{ *this };
-    GPUShaderPrograms gpuShaderPrograms{ *this };
-    GPUFrameBuffers gpuFrameBuffers{ *this };
+    GPUMemoryBudget memory{};
+    GPUSamplerCache samplerCache{}; /* outlives gpuSamplers, which holds its handles */
+    GPUSamplers gpuSamplers{ *this, memory };
+    GPUTextures gpuTextures{ *this, memory };
+    GPUShaders gpuShaders{ *this, memory };
+    GPUShaderPrograms gpuShaderPrograms{ *this, memory };
+    GPUFrameBuffers gpuFrameBuffers{ *this, memory };
 
 public:
     AssetGPUBridge() noexcept = default;
@@ -7,17 +7,27 @@
 #include <Engine/SceneSerializer.hpp>
 
 AssetHandle::AssetHandle() noexcept :
-    _asset(nullptr) {}
-AssetHandle::AssetHandle(Asset* const asset) noexcept :
-    _asset(asset) {}
-Asset& AssetHandle::operator*() const noexcept { return *_asset; }
-Asset* AssetHandle::operator->() const noexcept { return _asset; }
-AssetHandle::operator Asset* () const noexcept { return _asset; }
+    _slot(nullptr),
+    _generation(0) {}
+AssetHandle::AssetHandle(std::nullptr_t) noexcept :
+    AssetHandle() {}
+AssetHandle::AssetHandle(AssetStorage::Slot& slot) noexcept :
+    _slot(&slot),
+    _generation(slot.Generation) {}
+Asset& AssetHandle::operator*() const noexcept { return Value(); }
+Asset* AssetHandle::operator->() const noexcept { return HasValue() ? &*_slot->Value : nullptr; }
+AssetHandle::operator Asset* () const noexcept { return HasValue() ? &*_slot->Value : nullptr; }
 AssetHandle::operator bool() const noexcept { return HasValue(); }
 
-bool AssetHandle::HasValue() const { return _asset != nullptr; }
-Asset& AssetHandle::Value() const { return *_asset; }
-void AssetHandle::Reset() { _asset = nullptr; }
+bool AssetHandle::HasValue() const { return _slot != nullptr && _slot->Generation == _generation && _slot->Value.has_value(); }
+Asset& AssetHandle::Value() const {
+    assert(HasValue()); // Stale handle, the asset was deleted or reimported.
+    return *_slot->Value;
+}
+void AssetHandle::Reset() {
+    _slot = nullptr;
+    _generation = 0;
+}
 
 bool Assets::IsProjectFile(const FNode& file) noexcept { return file.ext == ProjectExtension; }
 bool Assets::IsSceneFile(const FNode& file) noexcept { return file.ext == SceneExtension; }
@@ -87,6 +97,7 @@ void Assets::DeleteAsset(const AssetHandle asset) {
     asset->File().Delete();
 
     UUID id = asset->ID();
+    const AssetStorage::Key key = database.at(id);
     database.erase(id);
     std::erase(allAssets, id);
     std::erase(sceneAssets, id);
@@ -98,31 +109,30 @@ void Assets::DeleteAsset(const AssetHandle asset) {
     std::erase(frameBufferAssets, id);
 
     dependencyGraph.RemoveVertex(id);
+    storage.Erase(key); /* last, the asset must be fully unregistered when its handles go stale */
     //ReimportAll();
 }
 
 AssetHandle Assets::FindAsset(UUID uuid) const {
-    if (!database.contains(uuid)) { return nullptr; }
+    auto itr = database.find(uuid);
+    if (itr == database.end()) { return nullptr; }
 
     /*
     * casting away const is safe here
-    * because database does not contain "const Asset*"
-    * in the first place, it contains "Asset*"
+    * because storage does not contain "const Asset"
+    * in the first place, it contains "Asset"
     */
-    return { const_cast<Asset*>(&database.at(uuid)) };
+    return { const_cast<AssetStorage&>(storage).SlotOf(itr->second) };
 }
 AssetHandle Assets::FindAssetAt(const FNode& file) const {
-    for (const auto& [uuid, asset] : database) {
-        if (asset.File() == file) {
-            /*
-            * casting away const is safe here
-            * because database does not contain "const Asset*"
-            * in the first place, it contains "Asset*"
-            */
-            return { const_cast<Asset*>(&asset) };
+    AssetHandle rv{ nullptr };
+    storage.ForEach([&rv, &file, this](AssetStorage::Key key, const Asset& asset) {
+        if (!rv.HasValue() && asset.File() == file) {
+            /* see FindAsset */
+            rv = { const_cast<AssetStorage&>(storage).SlotOf(key) };
         }
-    }
-    return nullptr;
+    });
+    return rv;
 }
 bool Assets::IsAssetExistsAt(const FNode& file) const { return files.contains(&file); }
 
@@ -146,6 +156,8 @@ const AssetGPUBridge& Assets::GPUBridge() const { return bridge; }
 AssetHandle Assets::Import(const FNode& file) { return ImportFile(database, file); }
 void Assets::ReimportAll() {
     database.clear();
+    files.clear();
+    storage.Clear();
     allAssets.clear();
     sceneAssets.clear();
     componentDefinitionAssets.clear();
@@ -175,6 +187,11 @@ void Assets::EnsureDeserialization() {
 
     ReBuildDependencyGraph();
 }
+void Assets::FlushNotifications() {
+    storage.ForEach([](AssetStorage::Key, Asset& asset) {
+        asset.Notifications().Flush();
+    });
+}
 
 void Assets::TryRegisterDependencyBetween(UUID dependent, UUID dependency) noexcept {
     if (dependencyGraph.HasVertex(dependent) && !dependencyGraph.HasEdge(dependent, dependency)) {
@@ -187,44 +204,34 @@ void Assets::TryDeleteDependencyBetween(UUID dependent, UUID dependency) noexcep
     }
 }
 
-void Assets::OnNotify(const ObserverPattern::Observable* source, ObserverPattern::Notification message) {
-    if (message == "deserialized"_hs) {
-        const Asset* asset = dynamic_cast<const Asset*>(source);
-        assert(asset); // must be non-null
-        const UUID origin = asset->ID();
-
-        if (asset->IsScene())               { PerformPostDeserializationAction<Scene>        (origin); }
-        if (asset->IsComponentDefinition()) { PerformPostDeserializationAction<Component>    (origin); }
-        if (asset->IsSampler())             { PerformPostDeserializationAction<Sampler>      (origin); }
-        if (asset->IsTexture())             { PerformPostDeserializationAction<Texture>      (origin); }
-        if (asset->IsShader())              { PerformPostDeserializationAction<Shader>       (origin); }
-        if (asset->IsShaderProgram())       { PerformPostDeserializationAction<ShaderProgram>(origin); }
-        if (asset->IsMaterial())            { PerformPostDeserializationAction<Material>     (origin); }
-        if (asset->IsFrameBuffer())         { PerformPostDeserializationAction<FrameBuffer>  (origin); }
-
-        if (dependencyGraph.HasVertex(origin)) {
-            auto edgeVertices = dependencyGraph.GetIncomingEdgesOf(origin);
-            while (edgeVertices.HasNext()) {
-                const UUID& dependentID = edgeVertices.Next();
-                assert(database.contains(dependentID));
-                database[dependentID].ForceDeserialize();
-            }
-        }
-    }
-    if (message == "data_deleted"_hs || message == "destructed"_hs) {
-        const Asset* asset = dynamic_cast<const Asset*>(source);
-        assert(asset); // must be non-null
-        if (asset->ID() == UUID::Empty())   { return; }
-        if (asset->IsScene())               {}
-        if (asset->IsComponentDefinition()) {}
-        if (asset->IsSampler())             { bridge.GetSamplers().Deallocate(asset->ID());       }
-        if (asset->IsTexture())             { bridge.GetTextures().Deallocate(asset->ID());       }
-        if (asset->IsShader())              { bridge.GetShaders().Deallocate(asset->ID());        }
-        if (asset->IsShaderProgram())       { bridge.GetShaderPrograms().Deallocate(asset->ID()); }
-        if (asset->IsMaterial())            {}
-        if (asset->IsFrameBuffer())         { bridge.GetFrameBuffers().Deallocate(asset->ID());   }
+Assets::UUIDCollection Assets::DependentsOf(UUID dependency) const noexcept {
+    if (!dependencyGraph.HasVertex(dependency)) { return {}; }
+    return dependencyGraph.GetTransitiveOriginsOf(dependency);
+}
+
+void Assets::OnAssetDeserialized(const Asset& asset) {
+    const UUID origin = asset.ID();
+    if (invalidatingDependents) {
+        // A dependent being re-deserialized by InvalidateDependentsOf, which rebuilds it later.
+        deferredPostDeserializations.push_back(origin);
+    } else {
+        InvalidateDependentsOf(origin);
     }
 }
+void Assets::OnAssetDataDeleted(const Asset& asset) {
+    if (asset.ID() == UUID::Empty())   { return; }
+    if (asset.IsScene())               {}
+    if (asset.IsComponentDefinition()) {}
+    if (asset.IsSampler())             { bridge.GetSamplers().Deallocate(asset.ID());       }
+    if (asset.IsTexture())             { bridge.GetTextures().Deallocate(asset.ID());       }
+    if (asset.IsShader())              { bridge.GetShaders().Deallocate(asset.ID());        }
+    if (asset.IsShaderProgram())       { bridge.GetShaderPrograms().Deallocate(asset.ID()); }
+    if (asset.IsMaterial())            {}
+    if (asset.IsFrameBuffer())         { bridge.GetFrameBuffers().Deallocate(asset.ID());   }
+}
+
+Asset& Assets::AssetOf(UUID id) noexcept { return *storage.Find(database.at(id)); }
+const Asset& Assets::AssetOf(UUID id) const noexcept { return *storage.Find(database.at(id)); }
 
 AssetHandle Assets::ImportFile(AssetDatabase& database, const FNode& file) {
     /* Import a file:
@@ -238,7 +245,7 @@ AssetHandle Assets::ImportFile(AssetDatabase& database, const FNode& file) {
         (this is no longer the case, as we have dependencies between assets
         eg. Scene depends on ComponentDefinition or Material depends on Program, Program depends on Shader etc.)
         * Step 8: Separate imported asset to its own subcategory (and put it into allAssets list)
-        * Step 9: Set ownself as imported asset's Observer and return
+        * Step 9: Subscribe to imported asset's notifications and return
     */
     if (IsProjectFile(file)) { return nullptr; }
     if (file.IsDirectory()) { return nullptr; }
@@ -290,8 +297,11 @@ AssetHandle Assets::ImportFile(AssetDatabase& database, const FNode& file) {
         }
 
         // Step 6
-        auto&& [itr, result] = database.emplace(uuid, Asset{ uuid, const_cast<FNode*>(&file) });
-        auto&& [id, asset] = *itr;
+        const AssetStorage::Key key = storage.Emplace(uuid, const_cast<FNode*>(&file));
+        auto&& [itr, result] = database.emplace(uuid, key);
+        const UUID id = itr->first;
+        AssetStorage::Slot& slot = storage.SlotOf(key);
+        Asset& asset = *slot.Value;
         files.emplace(&file, id);
 
         // Step 7
@@ -324,9 +334,12 @@ AssetHandle Assets::ImportFile(AssetDatabase& database, const FNode& file) {
             frameBufferAssets.push_back(id);
         }
 
-        asset.AddObserver(*this);
+        AssetNotificationBus& notifications = asset.Notifications();
+        notifications.Subscribe<AssetEvent::Deserialized>([this](const AssetEvent::Deserialized& event) { OnAssetDeserialized(event.Source); });
+        notifications.Subscribe<AssetEvent::DataDeleted>([this](const AssetEvent::DataDeleted& event) { OnAssetDataDeleted(event.Source); });
+        notifications.Subscribe<AssetEvent::Destructed>([this](const AssetEvent::Destructed& event) { OnAssetDataDeleted(event.Source); });
         dependencyGraph.AddVertex(id);
-        return &asset;
+        return { slot };
     } else {
         DOA_LOG_ERROR("Failed to import asset at %s do you have read/write access to the directory?", std::quoted(file.Path().c_str()));
         return nullptr;
@@ -344,8 +357,8 @@ void Assets::ImportAllFiles(AssetDatabase& database, const FNode& root) {
 }
 void Assets::Deserialize(const UUIDCollection& assets) {
     for (const UUID id : assets) {
-        database[id].DeleteDeserializedData();
-        database[id].ForceDeserialize();
+        AssetOf(id).DeleteDeserializedData();
+        AssetOf(id).ForceDeserialize();
     }
 }
 
@@ -384,7 +397,8 @@ void Assets::ReBuildDependencyGraph() noexcept {
         dependencyGraph.AddVertex(id);
     }
 
-    for (const auto& [id, asset] : database) {
+    for (const auto& [id, key] : database) {
+        const Asset& asset = *storage.Find(key);
         // Some asset types have no innate dependencies.
         if (asset.IsScene()) {}
         if (asset.IsComponentDefinition()) {}
@@ -419,13 +433,45 @@ void Assets::ReBuildDependencyGraph() noexcept {
     }
 }
 
+void Assets::InvalidateDependentsOf(UUID origin) {
+    /* Each dependent is deserialized exactly once even when it is reachable through several paths (diamonds),
+    and only after all of its dependencies. GPU objects are rebuilt afterwards in one pass, in the same order,
+    so e.g. a material's uniforms are remapped against the freshly linked program, never the stale one. */
+    const UUIDCollection dependents = DependentsOf(origin);
+
+    deferredPostDeserializations.push_back(origin);
+    invalidatingDependents = true;
+    for (const UUID dependentID : dependents) {
+        assert(database.contains(dependentID));
+        AssetOf(dependentID).ForceDeserialize();
+    }
+    invalidatingDependents = false;
+
+    const UUIDCollection rebuilds = std::move(deferredPostDeserializations);
+    deferredPostDeserializations.clear();
+    for (const UUID id : rebuilds) {
+        PerformPostDeserializationActionOf(id);
+    }
+}
+
+void Assets::PerformPostDeserializationActionOf(UUID id) noexcept {
+    const Asset& asset{ AssetOf(id) };
+    if (asset.IsScene())               { PerformPostDeserializationAction<Scene>        (id); }
+    if (asset.IsComponentDefinition()) { PerformPostDeserializationAction<Component>    (id); }
+    if (asset.IsSampler())             { PerformPostDeserializationAction<Sampler>      (id); }
+    if (asset.IsTexture())             { PerformPostDeserializationAction<Texture>      (id); }
+    if (asset.IsShader())              { PerformPostDeserializationAction<Shader>       (id); }
+    if (asset.IsShaderProgram())       { PerformPostDeserializationAction<ShaderProgram>(id); }
+    if (asset.IsMaterial())            { PerformPostDeserializationAction<Material>     (id); }
+    if (asset.IsFrameBuffer())         { PerformPostDeserializationAction<FrameBuffer>  (id); }
+}
 template<>
 void Assets::PerformPostDeserializationAction<Sampler>(UUID id) noexcept {
     bridge.GetSamplers().Deallocate(id);
     std::vector<SamplerAllocatorMessage> messages = bridge.GetSamplers().Allocate(*this, id);
 
     // Cast-away const. Assets are never created const.
-    const Asset& asset{ database[id] };
+    const Asset& asset{ AssetOf(id) };
     std::vector<std::any>& errorMessages = const_cast<std::vector<std::any>&>(asset.ErrorMessages());
     for (auto& message : messages) {
         errorMessages.emplace_back(std::move(message));
@@ -437,7 +483,7 @@ void Assets::PerformPostDeserializationAction<Texture>(UUID id) noexcept {
     std::vector<TextureAllocatorMessage> messages = bridge.GetTextures().Allocate(*this, id);
 
     // Cast-away const. Assets are never created const.
-    const Asset& asset{ database[id] };
+    const Asset& asset{ AssetOf(id) };
     std::vector<std::any>& errorMessages = const_cast<std::vector<std::any>&>(asset.ErrorMessages());
     for (auto& message : messages) {
         errorMessages.emplace_back(std::move(message));
@@ -449,7 +495,7 @@ void Assets::PerformPostDeserializationAction<Shader>(UUID id) noexcept {
     std::vector<ShaderCompilerMessage> messages = bridge.GetShaders().Allocate(*this, id);
 
     // Cast-away const. Assets are never created const.
-    const Asset& asset{ database[id] };
+    const Asset& asset{ AssetOf(id) };
     std::vector<std::any>& infoMessages = const_cast<std::vector<std::any>&>(asset.InfoMessages());
     std::vector<std::any>& warningMessages = const_cast<std::vector<std::any>&>(asset.WarningMessages());
     std::vector<std::any>& errorMessages = const_cast<std::vector<std::any>&>(asset.ErrorMessages());
@@ -476,7 +522,7 @@ void Assets::PerformPostDeserializationAction<ShaderProgram>(UUID id) noexcept {
     std::vector<ShaderLinkerMessage> messages = bridge.GetShaderPrograms().Allocate(*this, id);
 
     // Cast-away const. Assets are never created const.
-    const Asset& asset{ database[id] };
+    const Asset& asset{ AssetOf(id) };
     std::vector<std::any>& errorMessages = const_cast<std::vector<std::any>&>(asset.ErrorMessages());
     for (auto& message : messages) {
         errorMessages.emplace_back(std::move(message));
@@ -684,7 +730,7 @@ void MaterialPostDeserialization::EmplaceUniform(Material::Uniforms& uniforms, i
 
 template<>
 void Assets::PerformPostDeserializationAction<Material>(UUID id) noexcept {
-    Material& asset = database[id].DataAs<Material>();
+    Material& asset = AssetOf(id).DataAs<Material>();
     if (!asset.HasShaderProgram()) {
         asset.ClearAllUniforms();
         return;
@@ -721,7 +767,7 @@ void Assets::PerformPostDeserializationAction<Material>(UUID id) noexcept {
         algorithm(asset.FragmentUniforms, ShaderType::Fragment, *program);
     } else {
         // Cast-away const. Assets are never created const.
-        const Asset& asset{ database[id] };
+        const Asset& asset{ AssetOf(id) };
         std::vector<std::any>& errorMessages = const_cast<std::vector<std::any>&>(asset.ErrorMessages());
         errorMessages.emplace_back(std::string("Material deserialization failed."));
         errorMessages.emplace_back(std::string("Referenced shader program failed to allocate. Check for errors in program!"));
@@ -734,7 +780,7 @@ void Assets::PerformPostDeserializationAction<FrameBuffer>(UUID id) noexcept {
     std::vector<FrameBufferAllocatorMessage> messages = bridge.GetFrameBuffers().Allocate(*this, id);
 
     // Cast-away const. Assets are never created const.
-    const Asset& asset{ database[id] };
+    const Asset& asset{ AssetOf(id) };
     std::vector<std::any>& errorMessages = const_cast<std::vector<std::any>&>(asset.ErrorMessages());
     for (auto& message : messages) {
         errorMessages.emplace_back(std::move(message));
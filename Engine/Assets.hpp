@@ -1,14 +1,15 @@
 #pragma once
 
 #include <string>
+#include <cstddef>
 #include <cstdlib>
 #include <filesystem>
 #include <unordered_map>
 
 #include <entt/entt.hpp>
 
+#include <Utility/SlotArray.hpp>
 #include <Utility/AdjacencyList.hpp>
-#include <Utility/ObserverPattern.hpp>
 
 #include <Engine/Log.hpp>
 #include <Engine/UUID.hpp>
@@ -17,10 +18,16 @@
 
 struct AssetGPUBridge;
 
+using AssetStorage = SlotArray<Asset>;
+
+/* Refers to an asset's slot in Assets' storage, not to the asset itself. Slots never move, so a handle survives
+database growth and asset moves; when its asset is deleted or reimported the slot's generation changes and the
+handle reads as empty from then on. Checking a handle is one comparison, no lookup. */
 struct AssetHandle {
 
     AssetHandle() noexcept;
-    AssetHandle(Asset* const asset) noexcept;
+    AssetHandle(std::nullptr_t) noexcept;
+    AssetHandle(AssetStorage::Slot& slot) noexcept;
     Asset& operator*() const noexcept;
     Asset* operator->() const noexcept;
     operator Asset* () const noexcept;
@@ -33,10 +40,11 @@ struct AssetHandle {
     friend bool operator==(const AssetHandle& handle1, const AssetHandle& handle2) = default;
 
 private:
-    Asset* _asset;
+    AssetStorage::Slot* _slot;
+    uint32_t _generation;
 };
 
-struct Assets : ObserverPattern::Observer {
+struct Assets {
 
     using UUIDCollection = std::vector<UUID>;
 
@@ -134,25 +142,28 @@ struct Assets : ObserverPattern::Observer {
     void ReimportAll();
 
     void EnsureDeserialization();
+    /* Delivers the notifications queued by every asset since the last flush, called once per frame. */
+    void FlushNotifications();
 
     void TryRegisterDependencyBetween(UUID dependent, UUID dependency) noexcept;
     void TryDeleteDependencyBetween(UUID dependent, UUID dependency) noexcept;
 
-protected:
-    void OnNotify(const ObserverPattern::Observable* source, ObserverPattern::Notification message) final;
+    /* Every asset that depends on dependency directly or transitively, each once, after all of its own dependencies. */
+    UUIDCollection DependentsOf(UUID dependency) const noexcept;
 
 private:
 
 #if DEBUG
-    using AssetDatabase = std::unordered_map<UUID, Asset>;
+    using AssetDatabase = std::unordered_map<UUID, AssetStorage::Key>;
     using AssetFileDatabase = std::unordered_map<const FNode*, UUID>;
 #elif NDEBUG
-    using AssetDatabase = entt::dense_map<UUID, Asset>;
+    using AssetDatabase = entt::dense_map<UUID, AssetStorage::Key>;
     using AssetFileDatabase = entt::dense_map<const FNode*, UUID>;
 #else
 #error "Neither DEBUG nor NDEBUG are defined!"
 #endif
 
+    AssetStorage storage{};
     AssetDatabase database{};
     AssetFileDatabase files{};
 
@@ -174,13 +185,25 @@ private:
 
     AssetGPUBridge& bridge;
 
+    bool invalidatingDependents{ false };
+    UUIDCollection deferredPostDeserializations{};
+
+    /* Precondition: id is in the database. */
+    Asset& AssetOf(UUID id) noexcept;
+    const Asset& AssetOf(UUID id) const noexcept;
+
     AssetHandle ImportFile(AssetDatabase& database, const FNode& file);
     void ImportAllFiles(AssetDatabase& database, const FNode& root);
     void Deserialize(const UUIDCollection& assets);
 
     void BuildFileNodeTree(const Project& project, FNode& root);
     void ReBuildDependencyGraph() noexcept;
+    void InvalidateDependentsOf(UUID origin);
+
+    void OnAssetDeserialized(const Asset& asset);
+    void OnAssetDataDeleted(const Asset& asset);
 
+    void PerformPostDeserializationActionOf(UUID id) noexcept;
     template<AssetType T>
     void PerformPostDeserializationAction([[maybe_unused]] UUID id) noexcept {}
 };
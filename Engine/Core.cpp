@@ -1,6 +1,9 @@
 #include "Core.hpp"
 
+#include <cmath>
+#include <cassert>
 #include <utility>
+#include <algorithm>
 
 #include <GLFW/glfw3.h>
 #include <tinyxml2.h>
@@ -42,6 +45,25 @@ const CorePtr& Core::CreateCore(GraphicsBackend gBackend, WindowBackend wBackend
 
     IWindow& window = *core->window.get();
     core->input = std::make_unique<Input>(window);
+    { // any input wakes an idle loop up
+        auto redraw = [](auto&&...) { Core::GetCore()->RequestRedraw(INPUT_REDRAW_FRAMES); };
+        window.Events.OnResize            += redraw;
+        window.Events.OnFrameBufferResize += redraw;
+        window.Events.OnMove              += redraw;
+        window.Events.OnIconify           += redraw;
+        window.Events.OnFocus             += redraw;
+        window.Events.OnRefresh           += redraw;
+        window.Events.OnKeyPress          += redraw;
+        window.Events.OnKeyRelease        += redraw;
+        window.Events.OnCharInput         += redraw;
+        window.Events.OnMouseMove         += redraw;
+        window.Events.OnMouseEnter        += redraw;
+        window.Events.OnMouseLeave        += redraw;
+        window.Events.OnMousePress        += redraw;
+        window.Events.OnMouseRelease      += redraw;
+        window.Events.OnMouseScroll       += redraw;
+        window.Events.OnPathDrop          += redraw;
+    }
     ImGuiInit(window);
     ImGuiSetUpWindowIcons(params.IconPack);
 #pragma endregion
@@ -67,6 +89,8 @@ const CorePtr& Core::CreateCore(GraphicsBackend gBackend, WindowBackend wBackend
 
 #pragma region GPU Resource Allocator Initialization
     core->gpuBridge = std::make_unique<AssetGPUBridge>();
+    core->readbacks = std::make_unique<GPUReadbackQueue>();
+    core->gpuCaches = std::make_unique<GPUObjectCaches>();
 #pragma endregion
 
 #pragma region Built-in Stuff Initialization
@@ -206,15 +230,35 @@ const CorePtr& Core::CreateCore(GraphicsBackend gBackend, WindowBackend wBackend
 
     return core;
 }
+const CorePtr& Core::CreateHeadlessCore() {
+    std::set_new_handler(HandleNew);
+    CorePtr& core = *const_cast<CorePtr*>(&GetCore()); // cast-away const to initialize internals. GetCore never instantiates a const Core!
+    core->headless = true;
+
+    Graphics::ChangeGraphicsBackend(GraphicsBackend::None);
+    core->angel = std::make_unique<Angel>();
+    core->gpuBridge = std::make_unique<AssetGPUBridge>();
+    core->readbacks = std::make_unique<GPUReadbackQueue>();
+    core->gpuCaches = std::make_unique<GPUObjectCaches>();
+
+    return core;
+}
 const CorePtr& Core::GetCore() {
     static CorePtr core{ new Core, DeleteCore };
     return core;
 }
 void Core::DestroyCore() {
-    Monitors::DeInitialize();
-    ImGuiClean();
     CorePtr& core = *const_cast<CorePtr*>(&GetCore()); // cast-away const to destroy instance. GetCore never instantiates a const Core!
+    if (!core->headless) {
+        Monitors::DeInitialize();
+        ImGuiClean();
+    }
     core->Stop();
+    core->UnloadProject();
+    core->gpuBridge.reset();
+    core->readbacks.reset();
+    core->gpuCaches.reset();
+    Graphics::FlushRetired(); /* the context dies with the window, destroy what is retired while it is alive */
     core.reset();
 }
 
@@ -250,6 +294,7 @@ bool Core::IsDirect3D11Initialized() const noexcept {
 }
 #endif
 
+bool Core::IsHeadless() const noexcept { return headless; }
 bool Core::IsRunning() const { return running; }
 bool Core::IsPlaying() const { return playing; }
 void Core::SetPlaying(bool playing) { this->playing = playing; }
@@ -285,6 +330,8 @@ void Core::LoadProject(const std::filesystem::path& path) { LoadProject(path.str
 std::unique_ptr<Project>& Core::LoadedProject() { return project; }
 void Core::UnloadProject() {
     playing = false;
+    accumulator = 0.0f;
+    interpolationAlpha = 0.0f;
     project.reset();
     assets.reset();
 }
@@ -297,31 +344,26 @@ bool Core::HasLoadedProject() { return project != nullptr; }
 
 std::unique_ptr<Assets>& Core::GetAssets() { return assets; }
 std::unique_ptr<AssetGPUBridge>& Core::GetAssetGPUBridge() { return gpuBridge; }
+std::unique_ptr<GPUReadbackQueue>& Core::GetReadbackQueue() { return readbacks; }
+std::unique_ptr<GPUObjectCaches>& Core::GetGPUObjectCaches() { return gpuCaches; }
 
 void Core::Start() {
-    // TODO get rid of glfwGetTime here!
-    float lastTime = static_cast<float>(glfwGetTime());
-    float currentTime;
+    if (headless) {
+        RunHeadless({});
+        return;
+    }
+
+    auto lastTime = std::chrono::steady_clock::now();
 
     running = true;
     while (running) {
-        // TODO get rid of glfwGetTime here!
-        currentTime = static_cast<float>(glfwGetTime());
-
-        float delta = currentTime - lastTime;
-
-        if (project != nullptr && project->HasOpenScene()) {
-            for (auto [id, attachment] : _attachments) {
-                attachment->BeforeFrame(project.get());
-            }
+        auto currentTime = std::chrono::steady_clock::now();
+        float delta = std::chrono::duration<float>(currentTime - lastTime).count();
 
-            Scene& scene = project->GetOpenScene();
-            scene.ExecuteSystems(playing, delta);
+        unsigned redraws = pendingRedraws.load();
+        while (redraws > 0 && !pendingRedraws.compare_exchange_weak(redraws, redraws - 1)) {}
 
-            for (auto [id, attachment] : _attachments) {
-                attachment->AfterFrame(project.get());
-            }
-        }
+        ExecuteFrame(delta);
 
         ImGuiRender(delta);
 
@@ -329,6 +371,7 @@ void Core::Start() {
 
         input->Step();
         window->PollEvents();
+        WaitForNextFrame(currentTime);
         lastTime = currentTime;
 
         if (window->ShouldClose()) { Stop(); }
@@ -338,6 +381,135 @@ void Core::Stop() {
     running = false;
 }
 
+HeadlessRunStats Core::RunHeadless(const HeadlessRunParams& params) {
+    HeadlessRunStats stats;
+    if (project == nullptr || !project->HasOpenScene()) {
+        DOA_LOG_WARNING("Headless run requested without an open scene, nothing to execute.");
+        return stats;
+    }
+
+    const auto startTime = std::chrono::steady_clock::now();
+    auto lastTime = startTime;
+
+    running = true;
+    while (running && stats.Frames < params.MaxFrames) {
+        auto currentTime = std::chrono::steady_clock::now();
+        float delta = params.FrameDelta.value_or(std::chrono::duration<float>(currentTime - lastTime).count());
+        lastTime = currentTime;
+
+        ExecuteFrame(delta);
+        stats.Frames++;
+
+        if (params.StopCondition && params.StopCondition(*project, stats.Frames)) { Stop(); }
+    }
+    running = false;
+
+    stats.Elapsed = std::chrono::steady_clock::now() - startTime;
+    return stats;
+}
+
+double HeadlessRunStats::FramesPerSecond() const noexcept {
+    double seconds = std::chrono::duration<double>(Elapsed).count();
+    return seconds > 0.0 ? static_cast<double>(Frames) / seconds : 0.0;
+}
+
+void Core::SetFixedTimestep(FixedTimestepSettings settings) noexcept {
+    assert(settings.TickRate > 0.0f);
+    assert(settings.MaxTicksPerFrame > 0);
+    fixedTimestep = settings;
+    accumulator = 0.0f;
+    interpolationAlpha = 0.0f;
+}
+const FixedTimestepSettings& Core::GetFixedTimestep() const noexcept { return fixedTimestep; }
+float Core::GetFixedDelta() const noexcept { return 1.0f / fixedTimestep.TickRate; }
+float Core::GetInterpolationAlpha() const noexcept { return interpolationAlpha; }
+unsigned Core::GetTicksLastFrame() const noexcept { return ticksLastFrame; }
+
+void Core::SetIdleSettings(IdleSettings settings) noexcept {
+    idleSettings = settings;
+    RequestRedraw();
+}
+const IdleSettings& Core::GetIdleSettings() const noexcept { return idleSettings; }
+void Core::RequestRedraw(unsigned frameCount) noexcept {
+    unsigned redraws = pendingRedraws.load();
+    while (redraws < frameCount && !pendingRedraws.compare_exchange_weak(redraws, frameCount)) {}
+    if (window != nullptr && idleSettings.Enabled) {
+        window->PostEmptyEvent();
+    }
+}
+
+void Core::ExecuteFrame(float delta) {
+    ticksLastFrame = 0;
+    if (gpuBridge != nullptr) {
+        gpuBridge->EvictToBudget();
+    }
+    if (readbacks != nullptr) {
+        readbacks->Update();
+    }
+    if (gpuCaches != nullptr) {
+        gpuCaches->Trim();
+    }
+    Graphics::RetireFrame();
+    /* Readbacks complete and retired handles are freed only as frames pass, keep them coming while idle until
+    nothing is in flight, rather than waiting IdleInterval per frame. */
+    if ((readbacks != nullptr && readbacks->PendingCount() > 0) || Graphics::GetRetirementStats().Pending > 0) {
+        RequestRedraw();
+    }
+    if (assets != nullptr) {
+        /* what the GUI of the previous frame queued, before anything of this frame reads the assets */
+        assets->FlushNotifications();
+    }
+    if (project == nullptr || !project->HasOpenScene()) {
+        accumulator = 0.0f;
+        interpolationAlpha = 0.0f;
+        return;
+    }
+
+    for (auto [id, attachment] : _attachments) {
+        attachment->BeforeFrame(project.get());
+    }
+
+    Scene& scene = project->GetOpenScene();
+    const float step = GetFixedDelta();
+    accumulator += delta;
+    while (accumulator >= step && ticksLastFrame < fixedTimestep.MaxTicksPerFrame) {
+        scene.ExecuteSystems(playing, step);
+        accumulator -= step;
+        ticksLastFrame++;
+    }
+    if (accumulator >= step) {
+        /* fell behind by more than MaxTicksPerFrame steps, drop the backlog instead of trying to catch up */
+        accumulator = std::fmod(accumulator, step);
+    }
+    interpolationAlpha = accumulator / step;
+
+    for (auto [id, attachment] : _attachments) {
+        attachment->AfterFrame(project.get());
+    }
+}
+
+void Core::WaitForNextFrame(std::chrono::steady_clock::time_point frameStart) {
+    if (!idleSettings.Enabled || playing) { return; }
+
+    std::chrono::milliseconds minimumInterval{ 0 };
+    if (window->IsMinimized()) {
+        minimumInterval = idleSettings.MinimizedInterval;
+    } else if (!window->HasFocus()) {
+        minimumInterval = idleSettings.UnfocusedInterval;
+    }
+
+    /* events received while waiting may request a redraw, which shortens the wait down to the minimum interval */
+    while (running && !window->ShouldClose()) {
+        std::chrono::milliseconds interval = minimumInterval;
+        if (pendingRedraws.load() == 0) {
+            interval = std::max(interval, idleSettings.IdleInterval);
+        }
+        auto elapsed = std::chrono::steady_clock::now() - frameStart;
+        if (elapsed >= interval) { return; }
+        window->WaitEvents(interval - elapsed);
+    }
+}
+
 void Core::DeleteCore(Core* core) { delete core; }
 void Core::HandleNew() {
     DOA_LOG_FATAL("Memory allocation failed, terminating");
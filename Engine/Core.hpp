@@ -1,7 +1,11 @@
 #pragma once
 
 #include <tuple>
+#include <atomic>
+#include <chrono>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <functional>
 #include <filesystem>
 
@@ -16,6 +20,8 @@
 #include "AssetBridge.hpp"
 
 #include <Engine/Graphics.hpp>
+#include <Engine/GPUObjectCache.hpp>
+#include <Engine/GPUReadbackQueue.hpp>
 
 struct Core;
 struct Resolution;
@@ -23,8 +29,45 @@ struct Resolution;
 using CoreDeleter = std::function<void(Core*)>;
 using CorePtr = std::unique_ptr<Core, CoreDeleter>;
 
+struct HeadlessRunParams {
+    /* The run ends after MaxFrames frames, when StopCondition returns true or when Core::Stop is called. */
+    size_t MaxFrames{ std::numeric_limits<size_t>::max() };
+    std::function<bool(Project& project, size_t frame)> StopCondition{};
+    /* When set, every frame advances the clock by this delta instead of the measured one. Use for reproducible runs. */
+    std::optional<float> FrameDelta{ std::nullopt };
+};
+
+struct HeadlessRunStats {
+    size_t Frames{};
+    std::chrono::nanoseconds Elapsed{};
+
+    double FramesPerSecond() const noexcept;
+};
+
+struct FixedTimestepSettings {
+    /* Scene systems always advance in steps of 1 / TickRate seconds, regardless of the frame rate. */
+    float TickRate{ 60.0f };
+    /* Upper bound of simulation steps per frame. Time that does not fit is dropped to avoid a spiral of death. */
+    unsigned MaxTicksPerFrame{ 5 };
+};
+
+struct IdleSettings {
+    /* When enabled and not playing, a frame is only rendered after input or a RequestRedraw call. In between,
+    the loop sleeps in IWindow::WaitEvents. */
+    bool Enabled{ false };
+    /* A frame is still rendered this often while idle, so periodic work keeps flowing. */
+    std::chrono::milliseconds IdleInterval{ 500 };
+    /* Minimum frame time while the window is not focused, even if redraws are requested. */
+    std::chrono::milliseconds UnfocusedInterval{ 100 };
+    /* Minimum frame time while the window is minimized, even if redraws are requested. */
+    std::chrono::milliseconds MinimizedInterval{ 1000 };
+};
+
 struct Core {
     static const CorePtr& CreateCore(GraphicsBackend gBackend, WindowBackend wBackend, const ContextWindowCreationParams& params);
+    /* A core without a window, input, ImGui or graphics context, running on the None graphics backend.
+    Use for simulation hosts, build agents and benchmarks. Drive it with RunHeadless. */
+    static const CorePtr& CreateHeadlessCore();
     static const CorePtr& GetCore();
     static void DestroyCore();
 
@@ -43,6 +86,7 @@ struct Core {
     bool IsDirect3D11Initialized() const noexcept;
 #endif
 
+    bool IsHeadless() const noexcept;
     bool IsRunning() const;
     void SetPlaying(bool playing);
     bool IsPlaying() const;
@@ -61,20 +105,52 @@ struct Core {
 
     std::unique_ptr<Assets>& GetAssets();
     std::unique_ptr<AssetGPUBridge>& GetAssetGPUBridge();
+    /* Shared by inspectors and capture tools, updated every frame before the scene runs. */
+    std::unique_ptr<GPUReadbackQueue>& GetReadbackQueue();
+    /* Pipelines, samplers and descriptor sets built outside of assets, unused ones are destroyed every frame. */
+    std::unique_ptr<GPUObjectCaches>& GetGPUObjectCaches();
 
     void Start();
     void Stop();
 
+    /* Executes the open scene's systems until params say stop, without rendering or polling events. */
+    HeadlessRunStats RunHeadless(const HeadlessRunParams& params);
+
+    void SetFixedTimestep(FixedTimestepSettings settings) noexcept;
+    const FixedTimestepSettings& GetFixedTimestep() const noexcept;
+    float GetFixedDelta() const noexcept;
+    /* How far rendering is between the last two simulation steps, in [0, 1). Blend previous and current state with it. */
+    float GetInterpolationAlpha() const noexcept;
+    /* Number of simulation steps executed in the last frame. */
+    unsigned GetTicksLastFrame() const noexcept;
+
+    void SetIdleSettings(IdleSettings settings) noexcept;
+    const IdleSettings& GetIdleSettings() const noexcept;
+    /* Asks for at least frameCount more frames to be rendered. Safe to call from any thread. */
+    void RequestRedraw(unsigned frameCount = 1) noexcept;
+
 private:
+    bool headless{ false };
     bool running{ false };
     bool playing{ false };
 
+    FixedTimestepSettings fixedTimestep{};
+    float accumulator{ 0.0f };
+    float interpolationAlpha{ 0.0f };
+    unsigned ticksLastFrame{ 0 };
+
+    static constexpr unsigned INPUT_REDRAW_FRAMES{ 3 }; // ImGui needs a couple of frames to settle after input
+    IdleSettings idleSettings{};
+    std::atomic<unsigned> pendingRedraws{ 0 };
+
     std::unique_ptr<Angel> angel{};
     std::unique_ptr<IWindow> window{};
     std::unique_ptr<Input> input{};
     std::unique_ptr<Project> project{};
     std::unique_ptr<Assets> assets{};
     std::unique_ptr<AssetGPUBridge> gpuBridge{};
+    std::unique_ptr<GPUReadbackQueue> readbacks{};
+    std::unique_ptr<GPUObjectCaches> gpuCaches{};
 
     Core() = default;
     ~Core() = default;
@@ -86,6 +162,9 @@ private:
     static void DeleteCore(Core* core);
     static void HandleNew();
 
+    void ExecuteFrame(float delta);
+    void WaitForNextFrame(std::chrono::steady_clock::time_point frameStart);
+
     /* Core Attachment */
 public:
     struct Attachment : entt::type_list<void(Project*), void(Project*)> {
@@ -31,6 +31,7 @@ GPUBuffer& GPUBuffer::operator=(GPUBuffer&& other) noexcept {
 #endif
     Properties = std::exchange(other.Properties, {});
     SizeBytes = std::exchange(other.SizeBytes, {});
+    std::swap(MappedData, other.MappedData);
     return *this;
 }
 
@@ -40,6 +41,7 @@ bool GPUBuffer::IsWriteableFromCPU() const noexcept { return static_cast<bool>(P
 bool GPUBuffer::IsPersistent() const noexcept       { return static_cast<bool>(Properties & BufferProperties::Persistent);       }
 bool GPUBuffer::IsCoherent() const noexcept         { return static_cast<bool>(Properties & BufferProperties::Coherent);         }
 bool GPUBuffer::IsCPUStorage() const noexcept       { return static_cast<bool>(Properties & BufferProperties::CPUStorage);       }
+size_t GPUBuffer::MemorySize() const noexcept       { return SizeBytes; }
 
 GPUBufferBuilder& GPUBufferBuilder::SetName(std::string_view name) noexcept {
 #ifdef DEBUG
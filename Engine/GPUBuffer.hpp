@@ -15,6 +15,8 @@ struct GPUBuffer {
 #endif
     BufferProperties Properties;
     size_t SizeBytes{};
+    /* Persistent buffers readable or writeable from the CPU are mapped when built and stay mapped until destroyed. */
+    void* MappedData{ nullptr };
 
     bool IsDynamicStorage() const noexcept;
     bool IsReadableFromCPU() const noexcept;
@@ -22,6 +24,7 @@ struct GPUBuffer {
     bool IsPersistent() const noexcept;
     bool IsCoherent() const noexcept;
     bool IsCPUStorage() const noexcept;
+    size_t MemorySize() const noexcept;
 
     ND_GRAPHICS_COPYABLE_MOVEABLE_RESOURCE(GPUBuffer);
 };
@@ -46,6 +49,7 @@ public:
     ND_GRAPHICS_BUILDER_RULE_OF_0(GPUBufferBuilder);
 
 private:
+    friend std::pair<std::optional<GPUBuffer>, std::vector<BufferAllocatorMessage>> Graphics::None::Build(GPUBufferBuilder&) noexcept;
 #ifdef OPENGL_4_6_SUPPORT
     friend std::pair<std::optional<GPUBuffer>, std::vector<BufferAllocatorMessage>> Graphics::OpenGL::Build(GPUBufferBuilder&) noexcept;
 #endif
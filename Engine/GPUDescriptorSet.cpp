@@ -3,6 +3,8 @@
 #include <format>
 #include <cassert>
 
+#include <Utility/TemplateUtilities.hpp>
+
 GPUDescriptorSetBuilder& GPUDescriptorSetBuilder::SetName(std::string_view name) noexcept {
 #ifdef DEBUG
     this->name = name;
@@ -33,4 +35,23 @@ GPUDescriptorSetBuilder& GPUDescriptorSetBuilder::SetCombinedImageSamplerBinding
 
 std::pair<std::optional<GPUDescriptorSet>, std::vector<DescriptorSetAllocatorMessage>> GPUDescriptorSetBuilder::Build() noexcept {
     return Graphics::Builders::Build(*this);
+}
+GPUDescriptorSetBuilder::Key GPUDescriptorSetBuilder::MakeKey() const noexcept {
+    Key key{};
+    for (size_t i = 0; i < MaxDescriptorBinding; i++) {
+        const DescriptorBinding& binding = bindings[i];
+        Key::Binding& keyBinding = key.Bindings[i];
+        keyBinding.BindingSlot = binding.BindingSlot;
+        keyBinding.Type = binding.Descriptor.index();
+        std::visit(overloaded::lambda{
+            [](std::monostate) {},
+            [&keyBinding](const DescriptorBinding::UniformBuffer& descriptor) { keyBinding.Resource = &descriptor.Buffer.get(); },
+            [&keyBinding](const DescriptorBinding::StorageBuffer& descriptor) { keyBinding.Resource = &descriptor.Buffer.get(); },
+            [&keyBinding](const DescriptorBinding::CombinedImageSampler& descriptor) {
+                keyBinding.Resource = &descriptor.Texture.get();
+                keyBinding.Sampler = &descriptor.Sampler.get();
+            }
+        }, binding.Descriptor);
+    }
+    return key;
 }
\ No newline at end of file
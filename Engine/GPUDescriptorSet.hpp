@@ -53,6 +53,22 @@ struct GPUDescriptorSetBuilder {
 
     [[nodiscard]] std::pair<std::optional<GPUDescriptorSet>, std::vector<DescriptorSetAllocatorMessage>> Build() noexcept;
 
+    /* The bindings in the order they were set, resources told apart by address. */
+    struct Key {
+        struct Binding {
+            unsigned BindingSlot{};
+            size_t Type{}; /* index of the DescriptorBinding::Descriptor alternative, 0 for an unused binding */
+            const void* Resource{}; /* the buffer, or the texture of a CombinedImageSampler */
+            const GPUSampler* Sampler{};
+
+            bool operator==(const Binding&) const noexcept = default;
+        };
+        std::array<Binding, MaxDescriptorBinding> Bindings{};
+
+        bool operator==(const Key&) const noexcept = default;
+    };
+    Key MakeKey() const noexcept;
+
 private:
 #ifdef DEBUG
     std::string name{};
@@ -0,0 +1,16 @@
+#include <Engine/GPUFence.hpp>
+
+#include <utility>
+
+GPUFence::~GPUFence() noexcept {
+    Graphics::Destructors::Destruct(*this);
+}
+GPUFence::GPUFence(GPUFence&& other) noexcept {
+    *this = std::move(other);
+}
+GPUFence& GPUFence::operator=(GPUFence&& other) noexcept {
+    std::swap(GLObject, other.GLObject);
+    return *this;
+}
+
+bool GPUFence::IsValid() const noexcept { return GLObject != nullptr; }
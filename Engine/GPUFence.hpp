@@ -0,0 +1,11 @@
+#pragma once
+
+#include <Engine/Graphics.hpp>
+
+struct GPUFence {
+    GLsync GLObject{ nullptr };
+
+    bool IsValid() const noexcept;
+
+    ND_GRAPHICS_MOVE_ONLY_RESOURCE(GPUFence);
+};
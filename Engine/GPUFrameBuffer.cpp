@@ -1,6 +1,7 @@
 #include <Engine/GPUFrameBuffer.hpp>
 
 #include <cassert>
+#include <algorithm>
 
 // RenderBuffer
 GPURenderBuffer::~GPURenderBuffer() noexcept {
@@ -21,6 +22,10 @@ GPURenderBuffer& GPURenderBuffer::operator=(GPURenderBuffer&& other) noexcept {
     return *this;
 }
 
+size_t GPURenderBuffer::MemorySize() const noexcept {
+    return size_t{ Width } * Height * BitsPerPixel(Format) * std::max<size_t>(static_cast<size_t>(Samples), 1) / 8;
+}
+
 GPURenderBufferBuilder& GPURenderBufferBuilder::SetName(std::string_view name) noexcept {
 #ifdef DEBUG
     this->name = name;
@@ -71,6 +76,18 @@ GPUFrameBuffer& GPUFrameBuffer::operator=(GPUFrameBuffer&& other) noexcept {
     return *this;
 }
 
+size_t GPUFrameBuffer::MemorySize() const noexcept {
+    auto sizeOf = [](const std::optional<std::variant<GPUTexture, GPURenderBuffer>>& attachment) -> size_t {
+        if (!attachment.has_value()) { return 0; }
+        return std::visit([](const auto& resource) { return resource.MemorySize(); }, attachment.value());
+    };
+    size_t size = sizeOf(DepthAttachment) + sizeOf(StencilAttachment) + sizeOf(DepthStencilAttachment);
+    for (const auto& attachment : ColorAttachments) {
+        size += sizeOf(attachment);
+    }
+    return size;
+}
+
 GPUFrameBufferBuilder& GPUFrameBufferBuilder::SetName(std::string_view name) noexcept {
 #ifdef DEBUG
     this->name = name;
@@ -22,6 +22,8 @@ struct GPURenderBuffer {
     DataFormat Format{};
     Multisample Samples{};
 
+    size_t MemorySize() const noexcept;
+
     ND_GRAPHICS_MOVE_ONLY_RESOURCE(GPURenderBuffer);
 };
 struct GPURenderBufferBuilder {
@@ -47,6 +49,7 @@ public:
     ND_GRAPHICS_BUILDER_RULE_OF_0(GPURenderBufferBuilder);
 
 private:
+    friend std::pair<std::optional<GPURenderBuffer>, std::vector<RenderBufferAllocatorMessage>> Graphics::None::Build(GPURenderBufferBuilder&) noexcept;
 #ifdef OPENGL_4_6_SUPPORT
     friend std::pair<std::optional<GPURenderBuffer>, std::vector<RenderBufferAllocatorMessage>> Graphics::OpenGL::Build(GPURenderBufferBuilder&) noexcept;
 #endif
@@ -63,6 +66,9 @@ struct GPUFrameBuffer {
     std::optional<std::variant<GPUTexture, GPURenderBuffer>> StencilAttachment{};
     std::optional<std::variant<GPUTexture, GPURenderBuffer>> DepthStencilAttachment{};
 
+    /* Sum of the attachments' sizes. */
+    size_t MemorySize() const noexcept;
+
     ND_GRAPHICS_MOVE_ONLY_RESOURCE(GPUFrameBuffer);
 };
 struct GPUFrameBufferBuilder {
@@ -90,6 +96,7 @@ public:
     ND_GRAPHICS_BUILDER_RULE_OF_0(GPUFrameBufferBuilder);
 
 private:
+    friend std::pair<std::optional<GPUFrameBuffer>, std::vector<FrameBufferAllocatorMessage>> Graphics::None::Build(GPUFrameBufferBuilder&) noexcept;
 #ifdef OPENGL_4_6_SUPPORT
     friend std::pair<std::optional<GPUFrameBuffer>, std::vector<FrameBufferAllocatorMessage>> Graphics::OpenGL::Build(GPUFrameBufferBuilder&) noexcept;
 #endif
@@ -0,0 +1,83 @@
+#include <Engine/GPUObjectCache.hpp>
+
+#include <functional>
+
+static void Combine(size_t& hash, size_t value) noexcept {
+    hash ^= value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+}
+template<typename T>
+static void Combine(size_t& hash, const T& value) noexcept {
+    Combine(hash, std::hash<T>()(value));
+}
+static void Combine(size_t& hash, const Region& region) noexcept {
+    Combine(hash, region.X);
+    Combine(hash, region.Y);
+    Combine(hash, region.Width);
+    Combine(hash, region.Height);
+}
+
+size_t HashOf(const GPUPipelineBuilder::Key& key) noexcept {
+    size_t hash = 0;
+    for (size_t i = 0; i < MaxVertexBufferBinding; i++) {
+        if (key.VertexBuffers[i] == nullptr) { continue; }
+        const GPUVertexAttribLayout& layout = key.VertexLayouts[i];
+        Combine(hash, i);
+        Combine(hash, key.VertexBuffers[i]);
+        Combine(hash, layout.Stride);
+        Combine(hash, layout.InputRate);
+        Combine(hash, layout.AttribCount);
+        for (unsigned a = 0; a < layout.AttribCount; a++) {
+            Combine(hash, layout.Elements[a].Type);
+            Combine(hash, layout.Elements[a].Count);
+            Combine(hash, layout.Elements[a].IsNormalized);
+        }
+    }
+    Combine(hash, key.IndexBuffer);
+    Combine(hash, key.IndexType);
+    Combine(hash, key.Topology);
+    Combine(hash, key.Polygon);
+    Combine(hash, key.IsFaceCullingEnabled);
+    Combine(hash, key.Cull);
+    Combine(hash, key.IsScissorEnabled);
+    Combine(hash, key.Scissor);
+    Combine(hash, key.IsDepthTestEnabled);
+    Combine(hash, key.IsDepthWriteEnabled);
+    Combine(hash, key.DepthFunc);
+    Combine(hash, key.IsDepthClampEnabled);
+    Combine(hash, key.IsMultisampleEnabled);
+    Combine(hash, key.IsBlendEnabled);
+    Combine(hash, key.SourceFactor);
+    Combine(hash, key.DestinationFactor);
+    Combine(hash, key.SourceAlphaFactor);
+    Combine(hash, key.DestinationAlphaFactor);
+    Combine(hash, key.ShaderProgram);
+    return hash;
+}
+size_t HashOf(const GPUSamplerBuilder::Key& key) noexcept {
+    size_t hash = 0;
+    Combine(hash, key.MinFilter);
+    Combine(hash, key.MagFilter);
+    Combine(hash, key.MinLOD);
+    Combine(hash, key.MaxLOD);
+    Combine(hash, key.LODBias);
+    Combine(hash, key.WrapS);
+    Combine(hash, key.WrapT);
+    Combine(hash, key.WrapR);
+    for (float channel : key.BorderColor) { Combine(hash, channel); }
+    Combine(hash, key.CompareMode);
+    Combine(hash, key.CompareFunction);
+    Combine(hash, key.MaxAnisotropy);
+    Combine(hash, key.CubemapSeamless);
+    return hash;
+}
+size_t HashOf(const GPUDescriptorSetBuilder::Key& key) noexcept {
+    size_t hash = 0;
+    for (const auto& binding : key.Bindings) {
+        if (binding.Type == 0) { continue; }
+        Combine(hash, binding.BindingSlot);
+        Combine(hash, binding.Type);
+        Combine(hash, binding.Resource);
+        Combine(hash, binding.Sampler);
+    }
+    return hash;
+}
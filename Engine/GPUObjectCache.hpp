@@ -0,0 +1,98 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <unordered_map>
+
+#include <Engine/GPUTexture.hpp>
+#include <Engine/GPUPipeline.hpp>
+#include <Engine/GPUDescriptorSet.hpp>
+
+size_t HashOf(const GPUPipelineBuilder::Key& key) noexcept;
+size_t HashOf(const GPUSamplerBuilder::Key& key) noexcept;
+size_t HashOf(const GPUDescriptorSetBuilder::Key& key) noexcept;
+
+/* Hash-consed objects of one builder type. Get builds an object only the first time its builder state is asked
+for, every later request with an equal state gets the same handle, so the handle (or its GLObjectID) identifies
+the state and draws can be sorted by it. The name is not part of the state, the first request names the object.
+Keys tell referenced buffers, textures, samplers and programs apart by address: a cached object must not outlive
+what it references, release its handles and Trim before destroying those. Use from the thread owning the graphics
+context only. */
+template<typename Builder>
+struct GPUObjectCache {
+
+    using Key = typename Builder::Key;
+    using Object = typename decltype(std::declval<Builder&>().Build().first)::value_type;
+    using Message = typename decltype(std::declval<Builder&>().Build().second)::value_type;
+    using Handle = std::shared_ptr<const Object>;
+
+    struct Statistics {
+        size_t Hits{ 0 };
+        size_t Misses{ 0 };
+        size_t Entries{ 0 };
+
+        float HitRate() const noexcept { return Hits + Misses == 0 ? 0.0f : static_cast<float>(Hits) / static_cast<float>(Hits + Misses); }
+    };
+
+    GPUObjectCache() noexcept = default;
+    ~GPUObjectCache() noexcept = default;
+    GPUObjectCache(const GPUObjectCache&) = delete;
+    GPUObjectCache(GPUObjectCache&&) = delete;
+    GPUObjectCache& operator=(const GPUObjectCache&) = delete;
+    GPUObjectCache& operator=(GPUObjectCache&&) = delete;
+
+    /* A failed build is not cached, the handle is empty and the messages say why. A hit has no messages. */
+    [[nodiscard]] std::pair<Handle, std::vector<Message>> Get(Builder& builder) noexcept {
+        Key key{ builder.MakeKey() }; // before Build, which may move out of the builder
+        if (auto it = entries.find(key); it != entries.end()) {
+            hits++;
+            return { it->second, {} };
+        }
+
+        misses++;
+        auto [object, messages] = builder.Build();
+        if (!object.has_value()) { return { nullptr, std::move(messages) }; }
+        Handle handle{ std::make_shared<const Object>(std::move(object.value())) };
+        entries.emplace(std::move(key), handle);
+        return { std::move(handle), std::move(messages) };
+    }
+
+    /* Destroys the objects only the cache holds, returns how many. */
+    size_t Trim() noexcept {
+        return std::erase_if(entries, [](const auto& entry) { return entry.second.use_count() == 1; });
+    }
+    /* Forgets every object, those still held elsewhere live on uncached. */
+    void Clear() noexcept { entries.clear(); }
+
+    Statistics GetStatistics() const noexcept { return { .Hits = hits, .Misses = misses, .Entries = entries.size() }; }
+    void ResetStatistics() noexcept { hits = 0; misses = 0; }
+
+private:
+    struct KeyHasher {
+        size_t operator()(const Key& key) const noexcept { return HashOf(key); }
+    };
+
+    std::unordered_map<Key, Handle, KeyHasher> entries{};
+    size_t hits{ 0 };
+    size_t misses{ 0 };
+};
+
+using GPUPipelineCache = GPUObjectCache<GPUPipelineBuilder>;
+using GPUSamplerCache = GPUObjectCache<GPUSamplerBuilder>;
+using GPUDescriptorSetCache = GPUObjectCache<GPUDescriptorSetBuilder>;
+
+/* The caches shared by everything rendering outside of assets. Descriptor sets are declared last so they are
+destroyed first, they reference samplers. */
+struct GPUObjectCaches {
+    GPUPipelineCache Pipelines{};
+    GPUSamplerCache Samplers{};
+    GPUDescriptorSetCache DescriptorSets{};
+
+    void Trim() noexcept {
+        DescriptorSets.Trim();
+        Pipelines.Trim();
+        Samplers.Trim();
+    }
+};
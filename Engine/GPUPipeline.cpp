@@ -23,7 +23,6 @@ GPUPipeline& GPUPipeline::operator=(GPUPipeline&& other) noexcept {
     Polygon = other.Polygon;
     IsFaceCullingEnabled = other.IsFaceCullingEnabled;
     Cull = other.Cull;
-    Viewport = other.Viewport;
     IsScissorEnabled = other.IsScissorEnabled;
     Scissor = other.Scissor;
     IsDepthTestEnabled = other.IsDepthTestEnabled;
@@ -73,10 +72,6 @@ GPUPipelineBuilder& GPUPipelineBuilder::SetCullMode(CullMode cullMode) noexcept
     this->cullMode = cullMode;
     return *this;
 }
-GPUPipelineBuilder& GPUPipelineBuilder::SetViewport(Region viewport) noexcept {
-    this->viewport = viewport;
-    return *this;
-}
 GPUPipelineBuilder& GPUPipelineBuilder::SetScissorTestEnabled(bool enabled) noexcept {
     isScissorEnabled = enabled;
     return *this;
@@ -129,4 +124,32 @@ GPUPipelineBuilder& GPUPipelineBuilder::SetShaderProgram(const GPUShaderProgram&
 
 std::pair<std::optional<GPUPipeline>, std::vector<PipelineAllocatorMessage>> GPUPipelineBuilder::Build() noexcept {
     return Graphics::Builders::Build(*this);
+}
+GPUPipelineBuilder::Key GPUPipelineBuilder::MakeKey() const noexcept {
+    Key key{};
+    for (size_t i = 0; i < MaxVertexBufferBinding; i++) {
+        if (!vertexBuffers[i].has_value()) { continue; }
+        key.VertexBuffers[i] = &vertexBuffers[i]->get();
+        key.VertexLayouts[i] = vertexLayouts[i];
+    }
+    key.IndexBuffer = indexBuffer;
+    key.IndexType = indexType;
+    key.Topology = topology;
+    key.Polygon = polygonMode;
+    key.IsFaceCullingEnabled = isFaceCullingEnabled;
+    key.Cull = cullMode;
+    key.IsScissorEnabled = isScissorEnabled;
+    key.Scissor = scissor;
+    key.IsDepthTestEnabled = isDepthTestEnabled;
+    key.IsDepthWriteEnabled = isDepthWriteEnabled;
+    key.DepthFunc = depthFunction;
+    key.IsDepthClampEnabled = isDepthClampEnabled;
+    key.IsMultisampleEnabled = isMultisampleEnabled;
+    key.IsBlendEnabled = isBlendEnabled;
+    key.SourceFactor = srcRGBFactor;
+    key.DestinationFactor = dstRGBFactor;
+    key.SourceAlphaFactor = srcAlphaFactor;
+    key.DestinationAlphaFactor = dstAlphaFactor;
+    key.ShaderProgram = shaderProgam.has_value() ? &shaderProgam->get() : nullptr;
+    return key;
 }
\ No newline at end of file
@@ -27,7 +27,6 @@ struct GPUPipeline {
 
     bool IsFaceCullingEnabled{};
     CullMode Cull{};
-    Region Viewport{};
 
     bool IsScissorEnabled{};
     Region Scissor{};
@@ -57,7 +56,6 @@ struct GPUPipelineBuilder {
     GPUPipelineBuilder& SetPolygonMode(PolygonMode polygonMode) noexcept;
     GPUPipelineBuilder& SetFaceCullEnabled(bool enabled) noexcept;
     GPUPipelineBuilder& SetCullMode(CullMode cullMode) noexcept;
-    GPUPipelineBuilder& SetViewport(Region region) noexcept;
     GPUPipelineBuilder& SetScissorTestEnabled(bool enabled) noexcept;
     GPUPipelineBuilder& SetScissorRegion(Region scissor) noexcept;
     GPUPipelineBuilder& SetDepthTestEnabled(bool enabled) noexcept;
@@ -78,6 +76,33 @@ struct GPUPipelineBuilder {
     GPUPipelineBuilder& SetIndexBuffer(GPUBuffer&& buffer, DataType indexType = DataType::UnsignedShort) noexcept = delete;
     GPUPipelineBuilder& SetShaderProgram(GPUShaderProgram&& program) noexcept = delete;
 
+    /* Everything Build reads except the name. Buffers and the program are told apart by address, so a key is
+    only meaningful while the resources it points to are alive. */
+    struct Key {
+        std::array<const GPUBuffer*, MaxVertexBufferBinding> VertexBuffers{};
+        std::array<GPUVertexAttribLayout, MaxVertexBufferBinding> VertexLayouts{};
+        const GPUBuffer* IndexBuffer{};
+        DataType IndexType{};
+        TopologyType Topology{};
+        PolygonMode Polygon{};
+        bool IsFaceCullingEnabled{};
+        CullMode Cull{};
+        bool IsScissorEnabled{};
+        Region Scissor{};
+        bool IsDepthTestEnabled{};
+        bool IsDepthWriteEnabled{};
+        DepthFunction DepthFunc{};
+        bool IsDepthClampEnabled{};
+        bool IsMultisampleEnabled{};
+        bool IsBlendEnabled{};
+        BlendFactor SourceFactor{}, DestinationFactor{};
+        BlendFactor SourceAlphaFactor{}, DestinationAlphaFactor{};
+        const GPUShaderProgram* ShaderProgram{};
+
+        bool operator==(const Key&) const noexcept = default;
+    };
+    Key MakeKey() const noexcept;
+
 private:
 #ifdef DEBUG
     std::string name{};
@@ -92,7 +117,6 @@ private:
 
     bool isFaceCullingEnabled{};
     CullMode cullMode{ CullMode::Back };
-    Region viewport{};
 
     bool isScissorEnabled{};
     Region scissor{};
@@ -116,6 +140,7 @@ public:
     ND_GRAPHICS_BUILDER_RULE_OF_0(GPUPipelineBuilder);
 
 private:
+    friend std::pair<std::optional<GPUPipeline>, std::vector<PipelineAllocatorMessage>> Graphics::None::Build(GPUPipelineBuilder&) noexcept;
 #ifdef OPENGL_4_6_SUPPORT
     friend std::pair<std::optional<GPUPipeline>, std::vector<PipelineAllocatorMessage>> Graphics::OpenGL::Build(GPUPipelineBuilder&) noexcept;
 #endif
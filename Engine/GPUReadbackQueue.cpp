@@ -0,0 +1,123 @@
+#include <Engine/GPUReadbackQueue.hpp>
+
+#include <bit>
+#include <limits>
+#include <cassert>
+#include <utility>
+#include <algorithm>
+
+#include <Engine/GPUTexture.hpp>
+#include <Engine/GPUFrameBuffer.hpp>
+
+static size_t SizeOf(const PixelRegion& region) noexcept {
+    return size_t{ region.Width } * region.Height * ReadbackBytesPerPixel(region.Format);
+}
+
+GPUReadbackQueue::Ticket GPUReadbackQueue::Enqueue(const GPUFrameBuffer& source, unsigned colorAttachment, const PixelRegion& region, Callback callback) noexcept {
+    assert(ReadbackBytesPerPixel(region.Format) > 0);
+    GPUBuffer buffer{ AcquireBuffer(SizeOf(region)) };
+    Graphics::ReadPixels(source, colorAttachment, region, buffer);
+    return Submit({ .Region = region, .Buffer = std::move(buffer), .OnComplete = std::move(callback) });
+}
+GPUReadbackQueue::Ticket GPUReadbackQueue::Enqueue(const GPUTexture& source, unsigned level, const PixelRegion& region, Callback callback) noexcept {
+    assert(ReadbackBytesPerPixel(region.Format) > 0);
+    GPUBuffer buffer{ AcquireBuffer(SizeOf(region)) };
+    Graphics::ReadTexturePixels(source, level, region, buffer);
+    return Submit({ .Region = region, .Buffer = std::move(buffer), .OnComplete = std::move(callback) });
+}
+
+void GPUReadbackQueue::Update() noexcept {
+    /* Only what was pending on entry, readbacks enqueued by callbacks wait for the next frame. Copies finish in
+    submission order, so the first unfinished one ends the scan. */
+    size_t count = pending.size();
+    for (size_t i = 0; i < count && Graphics::WaitFence(pending.front().Fence, 0); i++) {
+        Readback readback{ std::move(pending.front()) };
+        pending.pop_front();
+        Complete(std::move(readback));
+    }
+}
+void GPUReadbackQueue::Flush() noexcept {
+    size_t count = pending.size();
+    for (size_t i = 0; i < count; i++) {
+        Readback readback{ std::move(pending.front()) };
+        pending.pop_front();
+        Graphics::WaitFence(readback.Fence, std::numeric_limits<uint64_t>::max());
+        Complete(std::move(readback));
+    }
+}
+
+bool GPUReadbackQueue::IsPending(Ticket ticket) const noexcept {
+    return std::ranges::find(pending, ticket.ID, &Readback::ID) != pending.end();
+}
+bool GPUReadbackQueue::IsComplete(Ticket ticket) const noexcept {
+    return std::ranges::find(completed, ticket.ID, &Readback::ID) != completed.end();
+}
+RawDataView GPUReadbackQueue::Data(Ticket ticket) const noexcept {
+    auto it = std::ranges::find(completed, ticket.ID, &Readback::ID);
+    assert(it != completed.end() && "Readback is not complete, or was released!");
+    assert(it->Buffer.MappedData != nullptr);
+    return { static_cast<const std::byte*>(it->Buffer.MappedData), SizeOf(it->Region) };
+}
+void GPUReadbackQueue::Release(Ticket ticket) noexcept {
+    if (auto it = std::ranges::find(completed, ticket.ID, &Readback::ID); it != completed.end()) {
+        RecycleBuffer(std::move(it->Buffer));
+        completed.erase(it);
+    } else if (auto it = std::ranges::find(pending, ticket.ID, &Readback::ID); it != pending.end()) {
+        pending.erase(it); // the copy may still be running, let the buffer retire instead of reusing it
+    }
+}
+
+size_t GPUReadbackQueue::PendingCount() const noexcept { return pending.size(); }
+size_t GPUReadbackQueue::CompletedCount() const noexcept { return completed.size(); }
+size_t GPUReadbackQueue::FreeBufferCount() const noexcept { return free.size(); }
+size_t GPUReadbackQueue::AllocationCount() const noexcept { return allocationCount; }
+
+GPUReadbackQueue::Ticket GPUReadbackQueue::Submit(Readback&& readback) noexcept {
+    readback.ID = nextID++;
+    readback.Fence = Graphics::InsertFence();
+    Ticket ticket{ readback.ID };
+    pending.push_back(std::move(readback));
+    return ticket;
+}
+void GPUReadbackQueue::Complete(Readback&& readback) noexcept {
+    readback.Fence = {};
+    if (!readback.OnComplete) {
+        completed.push_back(std::move(readback));
+        return;
+    }
+    assert(readback.Buffer.MappedData != nullptr);
+    readback.OnComplete({ static_cast<const std::byte*>(readback.Buffer.MappedData), SizeOf(readback.Region) }, readback.Region);
+    RecycleBuffer(std::move(readback.Buffer));
+}
+
+GPUBuffer GPUReadbackQueue::AcquireBuffer(size_t sizeBytes) noexcept {
+    /* The smallest free buffer that fits. New buffers are rounded up to a power of two, so regions of similar
+    sizes share buffers. */
+    auto best = free.end();
+    for (auto it = free.begin(); it != free.end(); ++it) {
+        if (it->SizeBytes >= sizeBytes && (best == free.end() || it->SizeBytes < best->SizeBytes)) { best = it; }
+    }
+    if (best != free.end()) {
+        GPUBuffer buffer{ std::move(*best) };
+        free.erase(best);
+        return buffer;
+    }
+
+    allocationCount++;
+    using enum BufferProperties;
+    GPUBufferBuilder builder;
+    auto&& [buffer, messages] = builder
+        .SetName("Readback Buffer")
+        .SetProperties(ReadableFromCPU | Persistent | Coherent)
+        .SetStorage(std::bit_ceil(std::max(sizeBytes, MIN_BUFFER_SIZE)), nullptr)
+        .Build();
+    assert(buffer.has_value());
+    return std::move(buffer.value());
+}
+void GPUReadbackQueue::RecycleBuffer(GPUBuffer&& buffer) noexcept {
+    free.push_back(std::move(buffer));
+    if (free.size() > MAX_FREE_BUFFERS) {
+        /* Drop the smallest, the large ones are the expensive ones to make again. */
+        free.erase(std::ranges::min_element(free, {}, &GPUBuffer::SizeBytes));
+    }
+}
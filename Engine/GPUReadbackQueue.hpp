@@ -0,0 +1,83 @@
+#pragma once
+
+#include <deque>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include <Engine/Graphics.hpp>
+#include <Engine/DataTypes.hpp>
+#include <Engine/GPUBuffer.hpp>
+#include <Engine/GPUFence.hpp>
+
+struct GPUTexture;
+struct GPUFrameBuffer;
+
+/* Reads pixels back from the GPU without stalling it. Enqueue records a copy of a region into a persistently
+mapped buffer from a pool and fences it, Update polls the fences without waiting and completes the readbacks
+whose copies have finished, usually a frame or two later. A completed readback is handed to its callback and
+its buffer recycled right after, one without a callback is kept until its owner calls Release. Idle buffers
+beyond MAX_FREE_BUFFERS are destroyed. Use from the thread owning the graphics context only. */
+struct GPUReadbackQueue {
+
+    static constexpr size_t MIN_BUFFER_SIZE{ 64 * 1024 };
+    static constexpr size_t MAX_FREE_BUFFERS{ 8 };
+
+    struct Ticket {
+        uint64_t ID{ 0 };
+
+        bool IsValid() const noexcept { return ID != 0; }
+        bool operator==(const Ticket&) const noexcept = default;
+    };
+
+    /* pixels are mapped memory, valid only during the call. Rows are tightly packed, bottom row first. */
+    using Callback = std::function<void(RawDataView pixels, const PixelRegion& region)>;
+
+    GPUReadbackQueue() noexcept = default;
+    ~GPUReadbackQueue() noexcept = default;
+    GPUReadbackQueue(const GPUReadbackQueue&) = delete;
+    GPUReadbackQueue(GPUReadbackQueue&&) = delete;
+    GPUReadbackQueue& operator=(const GPUReadbackQueue&) = delete;
+    GPUReadbackQueue& operator=(GPUReadbackQueue&&) = delete;
+
+    Ticket Enqueue(const GPUFrameBuffer& source, unsigned colorAttachment, const PixelRegion& region, Callback callback = {}) noexcept;
+    Ticket Enqueue(const GPUTexture& source, unsigned level, const PixelRegion& region, Callback callback = {}) noexcept;
+
+    /* Completes the readbacks whose copies have finished, in the order they were enqueued. Call once a frame. */
+    void Update() noexcept;
+    /* Waits for every pending readback and completes it. */
+    void Flush() noexcept;
+
+    bool IsPending(Ticket ticket) const noexcept;
+    bool IsComplete(Ticket ticket) const noexcept;
+    /* The pixels of a completed readback without a callback, valid until Release. */
+    RawDataView Data(Ticket ticket) const noexcept;
+    /* Gives the buffer of a readback back to the pool, dropping the readback if it is still pending. */
+    void Release(Ticket ticket) noexcept;
+
+    size_t PendingCount() const noexcept;
+    size_t CompletedCount() const noexcept;
+    size_t FreeBufferCount() const noexcept;
+    size_t AllocationCount() const noexcept;
+
+private:
+    struct Readback {
+        uint64_t ID{};
+        PixelRegion Region{};
+        GPUBuffer Buffer;
+        GPUFence Fence;
+        Callback OnComplete{};
+    };
+
+    std::deque<Readback> pending{};
+    std::vector<Readback> completed{};
+    std::vector<GPUBuffer> free{};
+    uint64_t nextID{ 1 };
+    size_t allocationCount{ 0 };
+
+    Ticket Submit(Readback&& readback) noexcept;
+    void Complete(Readback&& readback) noexcept;
+    GPUBuffer AcquireBuffer(size_t sizeBytes) noexcept;
+    void RecycleBuffer(GPUBuffer&& buffer) noexcept;
+};
@@ -0,0 +1,128 @@
+#include <Engine/GPURenderTargetPool.hpp>
+
+#include <cassert>
+#include <utility>
+#include <algorithm>
+
+static unsigned RoundUpToBucket(unsigned value) noexcept {
+    constexpr unsigned step = GPURenderTargetPool::BUCKET_STEP;
+    return std::max((value + step - 1) / step, 1u) * step;
+}
+
+Resolution GPURenderTargetPool::BucketOf(Resolution size) noexcept {
+    return { RoundUpToBucket(size.Width), RoundUpToBucket(size.Height) };
+}
+
+GPUFrameBuffer GPURenderTargetPool::Acquire(const Description& description, Resolution extent, std::string_view name) noexcept {
+    assert(BucketOf(extent) == extent);
+    auto it = std::ranges::find_if(free, [&](const FreeTarget& target) { return target.Key == description && target.Extent == extent; });
+    if (it != free.end()) {
+        GPUFrameBuffer frameBuffer{ std::move(it->FrameBuffer) };
+        free.erase(it);
+        reuseCount++;
+        return frameBuffer;
+    }
+    allocationCount++;
+    return Build(description, extent, name);
+}
+void GPURenderTargetPool::Release(const Description& description, Resolution extent, GPUFrameBuffer&& frameBuffer, Clock::time_point now) noexcept {
+    free.emplace_back(description, extent, std::move(frameBuffer), now);
+}
+void GPURenderTargetPool::Trim(Clock::time_point now) noexcept {
+    std::erase_if(free, [now](const FreeTarget& target) { return now - target.ReleasedAt >= IDLE_TIMEOUT; });
+}
+
+size_t GPURenderTargetPool::FreeCount() const noexcept { return free.size(); }
+size_t GPURenderTargetPool::AllocationCount() const noexcept { return allocationCount; }
+size_t GPURenderTargetPool::ReuseCount() const noexcept { return reuseCount; }
+
+GPUFrameBuffer GPURenderTargetPool::Build(const Description& description, Resolution extent, std::string_view name) noexcept {
+    GPUFrameBufferBuilder fbBuilder;
+    fbBuilder.SetName(name);
+
+    if (description.SampledColor) {
+        GPUTextureBuilder tBuilder;
+        auto&& color = tBuilder
+            .SetWidth(extent.Width)
+            .SetHeight(extent.Height)
+            .SetData(description.ColorFormat, {})
+            .SetSamples(description.Samples)
+            .Build().first;
+        assert(color.has_value());
+        fbBuilder.AttachColorTexture(std::move(color.value()), 0);
+    } else {
+        GPURenderBufferBuilder rbBuilder;
+        auto&& color = rbBuilder
+            .SetLayout(extent.Width, extent.Height, description.ColorFormat)
+            .SetSamples(description.Samples)
+            .Build().first;
+        assert(color.has_value());
+        fbBuilder.AttachColorRenderBuffer(std::move(color.value()), 0);
+    }
+
+    if (description.DepthStencilFormat.has_value()) {
+        GPURenderBufferBuilder rbBuilder;
+        auto&& depthStencil = rbBuilder
+            .SetLayout(extent.Width, extent.Height, description.DepthStencilFormat.value())
+            .SetSamples(description.Samples)
+            .Build().first;
+        assert(depthStencil.has_value());
+        fbBuilder.AttachDepthStencilRenderBuffer(std::move(depthStencil.value()));
+    }
+
+    auto&& fb = fbBuilder.Build().first;
+    assert(fb.has_value());
+    return std::move(fb.value());
+}
+
+GPUPooledRenderTarget::GPUPooledRenderTarget(GPURenderTargetPool& pool, const GPURenderTargetPool::Description& description, std::string_view name) noexcept :
+    pool(pool),
+    description(description),
+    name(name) {}
+GPUPooledRenderTarget::~GPUPooledRenderTarget() noexcept {
+    if (frameBuffer.has_value()) {
+        pool.Release(description, extent, std::move(frameBuffer.value()));
+    }
+}
+
+bool GPUPooledRenderTarget::Resize(Resolution size, GPURenderTargetPool::Clock::time_point now) noexcept {
+    this->size = size;
+    Resolution bucket = GPURenderTargetPool::BucketOf(size);
+
+    if (!frameBuffer.has_value() || bucket.Width > extent.Width || bucket.Height > extent.Height) {
+        Reacquire(bucket, now);
+        return true;
+    }
+    if (bucket == extent) {
+        shrinkBucket.reset();
+        return false;
+    }
+    if (shrinkBucket != bucket) { // smaller, (re)start the timer whenever the smaller bucket changes
+        shrinkBucket = bucket;
+        shrinkSince = now;
+        return false;
+    }
+    if (now - shrinkSince < SHRINK_DELAY) { return false; }
+    Reacquire(bucket, now);
+    return true;
+}
+
+const GPUFrameBuffer& GPUPooledRenderTarget::FrameBuffer() const noexcept {
+    assert(frameBuffer.has_value());
+    return frameBuffer.value();
+}
+GPUFrameBuffer& GPUPooledRenderTarget::FrameBuffer() noexcept {
+    assert(frameBuffer.has_value());
+    return frameBuffer.value();
+}
+Resolution GPUPooledRenderTarget::Size() const noexcept { return size; }
+Resolution GPUPooledRenderTarget::Extent() const noexcept { return extent; }
+
+void GPUPooledRenderTarget::Reacquire(Resolution bucket, GPURenderTargetPool::Clock::time_point now) noexcept {
+    if (frameBuffer.has_value()) {
+        pool.Release(description, extent, std::move(frameBuffer.value()), now);
+    }
+    frameBuffer = pool.Acquire(description, bucket, name);
+    extent = bucket;
+    shrinkBucket.reset();
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+#include <Engine/Graphics.hpp>
+#include <Engine/Resolution.hpp>
+#include <Engine/GPUFrameBuffer.hpp>
+
+/* Frame buffers allocated in size buckets, BUCKET_STEP pixels apart in each dimension, and shared by
+(description, bucket). A target is rendered to in its bottom-left sub-rectangle of the size actually needed,
+so any size change within a bucket keeps the target. Released targets wait in the pool for reuse and are
+destroyed by Trim once unused for IDLE_TIMEOUT. */
+struct GPURenderTargetPool {
+
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr unsigned BUCKET_STEP{ 128 };
+    static constexpr std::chrono::milliseconds IDLE_TIMEOUT{ 5000 };
+
+    struct Description {
+        DataFormat ColorFormat{ DataFormat::RGBA8 };
+        std::optional<DataFormat> DepthStencilFormat{};
+        Multisample Samples{ Multisample::None };
+        /* Color is a texture if sampled, a render buffer otherwise. */
+        bool SampledColor{ false };
+
+        bool operator==(const Description&) const noexcept = default;
+    };
+
+    GPURenderTargetPool() noexcept = default;
+    ~GPURenderTargetPool() noexcept = default;
+    GPURenderTargetPool(const GPURenderTargetPool&) = delete;
+    GPURenderTargetPool(GPURenderTargetPool&&) noexcept = default;
+    GPURenderTargetPool& operator=(const GPURenderTargetPool&) = delete;
+    GPURenderTargetPool& operator=(GPURenderTargetPool&&) noexcept = default;
+
+    static Resolution BucketOf(Resolution size) noexcept;
+
+    /* Returns a frame buffer of exactly extent, which must be a bucket, reusing a released one if possible. */
+    GPUFrameBuffer Acquire(const Description& description, Resolution extent, std::string_view name = "Pooled Render Target") noexcept;
+    void Release(const Description& description, Resolution extent, GPUFrameBuffer&& frameBuffer, Clock::time_point now = Clock::now()) noexcept;
+    void Trim(Clock::time_point now = Clock::now()) noexcept;
+
+    size_t FreeCount() const noexcept;
+    size_t AllocationCount() const noexcept;
+    size_t ReuseCount() const noexcept;
+
+private:
+    struct FreeTarget {
+        Description Key{};
+        Resolution Extent{};
+        GPUFrameBuffer FrameBuffer;
+        Clock::time_point ReleasedAt{};
+    };
+
+    std::vector<FreeTarget> free{};
+    size_t allocationCount{ 0 };
+    size_t reuseCount{ 0 };
+
+    static GPUFrameBuffer Build(const Description& description, Resolution extent, std::string_view name) noexcept;
+};
+
+/* A pooled render target that follows a changing size with hysteresis. Growing past the current bucket swaps
+the target at once, a smaller bucket is only switched to after the size has stayed in it for SHRINK_DELAY. */
+struct GPUPooledRenderTarget {
+
+    static constexpr std::chrono::milliseconds SHRINK_DELAY{ 1000 };
+
+    GPUPooledRenderTarget(GPURenderTargetPool& pool, const GPURenderTargetPool::Description& description, std::string_view name) noexcept;
+    ~GPUPooledRenderTarget() noexcept;
+    GPUPooledRenderTarget(const GPUPooledRenderTarget&) = delete;
+    GPUPooledRenderTarget(GPUPooledRenderTarget&&) = delete;
+    GPUPooledRenderTarget& operator=(const GPUPooledRenderTarget&) = delete;
+    GPUPooledRenderTarget& operator=(GPUPooledRenderTarget&&) = delete;
+
+    /* Returns true if FrameBuffer() changed. */
+    bool Resize(Resolution size, GPURenderTargetPool::Clock::time_point now = GPURenderTargetPool::Clock::now()) noexcept;
+
+    const GPUFrameBuffer& FrameBuffer() const noexcept;
+    GPUFrameBuffer& FrameBuffer() noexcept;
+    /* The size rendered to, the bottom-left sub-rectangle of Extent(). */
+    Resolution Size() const noexcept;
+    /* The size allocated. */
+    Resolution Extent() const noexcept;
+
+private:
+    GPURenderTargetPool& pool;
+    GPURenderTargetPool::Description description;
+    std::string name;
+    std::optional<GPUFrameBuffer> frameBuffer{};
+    Resolution size{};
+    Resolution extent{};
+    std::optional<Resolution> shrinkBucket{};
+    GPURenderTargetPool::Clock::time_point shrinkSince{};
+
+    void Reacquire(Resolution bucket, GPURenderTargetPool::Clock::time_point now) noexcept;
+};
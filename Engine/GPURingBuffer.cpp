@@ -0,0 +1,75 @@
+#include <Engine/GPURingBuffer.hpp>
+
+#include <cassert>
+#include <utility>
+#include <algorithm>
+
+#include <Engine/Log.hpp>
+
+static size_t AlignUp(size_t value, size_t alignment) noexcept {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+GPURingBuffer::GPURingBuffer(size_t regionSizeBytes, std::string_view name) noexcept :
+    name(name),
+    alignment(Graphics::UniformBufferOffsetAlignment()) {
+    Reallocate(AlignUp(std::max<size_t>(regionSizeBytes, 1), alignment));
+}
+
+void GPURingBuffer::BeginFrame() noexcept {
+    region = (region + 1) % FRAMES_IN_FLIGHT;
+    head = 0;
+
+    GPUFence& fence = fences[region];
+    if (!fence.IsValid()) { return; }
+    if (!Graphics::WaitFence(fence, 0)) {
+        stallCount++;
+        Graphics::WaitFence(fence, UINT64_MAX);
+    }
+    fence = {};
+}
+
+GPURingBuffer::Allocation GPURingBuffer::Allocate(size_t sizeBytes) noexcept {
+    size_t alignedSize = AlignUp(sizeBytes, alignment);
+    if (head + alignedSize > regionSize) {
+        Reallocate(AlignUp(std::max(regionSize * 2, head + alignedSize), alignment));
+    }
+    assert(buffer.MappedData != nullptr);
+
+    size_t offset = region * regionSize + head;
+    head += alignedSize;
+    return { static_cast<std::byte*>(buffer.MappedData) + offset, offset, sizeBytes };
+}
+
+void GPURingBuffer::EndFrame() noexcept {
+    fences[region] = Graphics::InsertFence();
+}
+
+const GPUBuffer& GPURingBuffer::Buffer() const noexcept { return buffer; }
+
+size_t GPURingBuffer::RegionSize() const noexcept { return regionSize; }
+size_t GPURingBuffer::RegionUsage() const noexcept { return head; }
+uint64_t GPURingBuffer::StallCount() const noexcept { return stallCount; }
+uint64_t GPURingBuffer::GrowCount() const noexcept { return growCount; }
+
+void GPURingBuffer::Reallocate(size_t newRegionSize) noexcept {
+    if (regionSize != 0) {
+        growCount++;
+        DOA_LOG_INFO("%s grew from %zu to %zu bytes per frame.", name.c_str(), regionSize, newRegionSize);
+    }
+
+    GPUBufferBuilder builder;
+    auto&& [newBuffer, messages] = builder
+        .SetName(name)
+        .SetProperties(BufferProperties::WriteableFromCPU | BufferProperties::Persistent | BufferProperties::Coherent)
+        .SetStorage(newRegionSize * FRAMES_IN_FLIGHT, nullptr)
+        .Build();
+    assert(newBuffer.has_value());
+
+    // Draws recorded earlier this frame keep reading the old buffer, the driver holds on to it until they retire.
+    // The fresh buffer has no pending GPU work, so every fence of the old one is moot. head is kept, leaving the
+    // bytes already used this frame unused in the new buffer too, so RegionUsage keeps measuring the whole frame.
+    buffer = std::move(newBuffer.value());
+    fences = {};
+    regionSize = newRegionSize;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include <Engine/GPUFence.hpp>
+#include <Engine/GPUBuffer.hpp>
+
+/* Streams per-draw data through one persistently mapped, coherent buffer split into FRAMES_IN_FLIGHT regions.
+A frame sub-allocates from its own region and fences it in EndFrame, BeginFrame waits on the fence of the region
+it is about to reuse, which by then is FRAMES_IN_FLIGHT - 1 frames old and almost always signaled already.
+A region that runs out of space is grown mid-frame by replacing the buffer, draws already recorded keep reading
+the old buffer which the driver releases once they retire, so growing never waits on the GPU either. */
+struct GPURingBuffer {
+
+    static constexpr size_t FRAMES_IN_FLIGHT{ 3 };
+
+    struct Allocation {
+        void* Data{ nullptr };
+        size_t OffsetBytes{};
+        size_t SizeBytes{};
+    };
+
+    GPURingBuffer() noexcept = default;
+    explicit GPURingBuffer(size_t regionSizeBytes, std::string_view name = "Ring Buffer") noexcept;
+    ~GPURingBuffer() noexcept = default;
+    GPURingBuffer(const GPURingBuffer&) = delete;
+    GPURingBuffer(GPURingBuffer&&) noexcept = default;
+    GPURingBuffer& operator=(const GPURingBuffer&) = delete;
+    GPURingBuffer& operator=(GPURingBuffer&&) noexcept = default;
+
+    void BeginFrame() noexcept;
+    /* Returns memory aligned for use as a uniform buffer range of Buffer(). Fill it before the next Allocate,
+    which may grow the ring and leave Data dangling. */
+    Allocation Allocate(size_t sizeBytes) noexcept;
+    void EndFrame() noexcept;
+
+    /* The buffer may change when Allocate grows the ring, bind it after allocating. */
+    const GPUBuffer& Buffer() const noexcept;
+
+    size_t RegionSize() const noexcept;
+    size_t RegionUsage() const noexcept;
+    /* Number of BeginFrame calls that had to block because the GPU had not finished the region yet. */
+    uint64_t StallCount() const noexcept;
+    uint64_t GrowCount() const noexcept;
+
+private:
+    std::string name{};
+    GPUBuffer buffer{};
+    std::array<GPUFence, FRAMES_IN_FLIGHT> fences{};
+    size_t regionSize{ 0 };
+    size_t alignment{ 1 };
+    size_t region{ 0 };
+    size_t head{ 0 };
+    uint64_t stallCount{ 0 };
+    uint64_t growCount{ 0 };
+
+    void Reallocate(size_t newRegionSize) noexcept;
+};
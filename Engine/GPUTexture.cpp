@@ -83,6 +83,23 @@ GPUSamplerBuilder& GPUSamplerBuilder::SetCubemapSeamless(bool seamless) noexcept
 std::pair<std::optional<GPUSampler>, std::vector<SamplerAllocatorMessage>> GPUSamplerBuilder::Build() noexcept {
     return Graphics::Builders::Build(*this);
 }
+GPUSamplerBuilder::Key GPUSamplerBuilder::MakeKey() const noexcept {
+    return {
+        .MinFilter = minFilter,
+        .MagFilter = magFilter,
+        .MinLOD = minLOD,
+        .MaxLOD = maxLOD,
+        .LODBias = LODBias,
+        .WrapS = wrapS,
+        .WrapT = wrapT,
+        .WrapR = wrapR,
+        .BorderColor = borderColor,
+        .CompareMode = compareMode,
+        .CompareFunction = compareFunction,
+        .MaxAnisotropy = maxAnisotropy,
+        .CubemapSeamless = cubemapSeamless
+    };
+}
 
 // Texture
 GPUTexture::~GPUTexture() noexcept {
@@ -105,6 +122,21 @@ GPUTexture& GPUTexture::operator=(GPUTexture&& other) noexcept {
 }
 
 bool GPUTexture::IsMultisampled() const noexcept { return Samples != Multisample::None; }
+size_t GPUTexture::MemorySize() const noexcept {
+    size_t width = Width, height = std::max(Height, 1u), depth = std::max(Depth, 1u);
+    size_t texelBits = BitsPerPixel(Format) * std::max<size_t>(static_cast<size_t>(Samples), 1);
+    if (IsMultisampled()) { return width * height * depth * texelBits / 8; } // Multisampled textures have no mipmaps.
+
+    size_t bits = 0;
+    while (true) {
+        bits += width * height * depth * texelBits;
+        if (width <= 1 && height <= 1 && depth <= 1) { break; }
+        width = std::max<size_t>(width / 2, 1);
+        height = std::max<size_t>(height / 2, 1);
+        depth = std::max<size_t>(depth / 2, 1);
+    }
+    return bits / 8;
+}
 GPUTexture::operator void* () const { return reinterpret_cast<void*>(static_cast<uint64_t>(GLObjectID)); }
 
 GPUTextureBuilder& GPUTextureBuilder::SetName(std::string_view name) noexcept {
@@ -36,6 +36,26 @@ struct GPUSamplerBuilder {
     GPUSamplerBuilder& SetCubemapSeamless(bool seamless) noexcept;
     [[nodiscard]] std::pair<std::optional<GPUSampler>, std::vector<SamplerAllocatorMessage>> Build() noexcept;
 
+    /* Everything Build reads except the name, two builders with equal keys build equal samplers. */
+    struct Key {
+        TextureMinificationMode MinFilter{};
+        TextureMagnificationMode MagFilter{};
+        float MinLOD{};
+        float MaxLOD{};
+        float LODBias{};
+        TextureWrappingMode WrapS{};
+        TextureWrappingMode WrapT{};
+        TextureWrappingMode WrapR{};
+        std::array<float, 4> BorderColor{};
+        TextureCompareMode CompareMode{};
+        TextureCompareFunction CompareFunction{};
+        float MaxAnisotropy{};
+        bool CubemapSeamless{};
+
+        bool operator==(const Key&) const noexcept = default;
+    };
+    Key MakeKey() const noexcept;
+
 private:
 #ifdef DEBUG
     std::string name{};
@@ -77,6 +97,8 @@ struct GPUTexture {
     Multisample Samples{};
 
     bool IsMultisampled() const noexcept;
+    /* Estimated bytes of storage, every mip level included. */
+    size_t MemorySize() const noexcept;
     operator void* () const;
 
     ND_GRAPHICS_MOVE_ONLY_RESOURCE(GPUTexture);
@@ -105,6 +127,7 @@ public:
     ND_GRAPHICS_BUILDER_RULE_OF_0(GPUTextureBuilder);
 
 private:
+    friend std::pair<std::optional<GPUTexture>, std::vector<TextureAllocatorMessage>> Graphics::None::Build(GPUTextureBuilder&) noexcept;
 #ifdef OPENGL_4_6_SUPPORT
     friend std::pair<std::optional<GPUTexture>, std::vector<TextureAllocatorMessage>> Graphics::OpenGL::Build(GPUTextureBuilder&) noexcept;
 #endif
@@ -22,6 +22,14 @@ void GPUVertexAttribLayout::Define<double_t>(unsigned count, bool isNormalized)
     Stride += count * size;
 }
 
+template<>
+void GPUVertexAttribLayout::Define<Half>(unsigned count, bool isNormalized) {
+    static unsigned size{ sizeof(Half) };
+    Elements[AttribCount++] = { GL_HALF_FLOAT, count, isNormalized };
+    Offsets[AttribCount] = Offsets[AttribCount - 1] + count * size;
+    Stride += count * size;
+}
+
 template<>
 void GPUVertexAttribLayout::Define<int8_t>(unsigned count, bool isNormalized) {
     static unsigned size{ sizeof(int8_t) };
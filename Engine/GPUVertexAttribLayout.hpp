@@ -6,6 +6,7 @@
 #include <utility>
 
 #include <Engine/Log.hpp>
+#include <Engine/Half.hpp>
 #include <Engine/Graphics.hpp>
 
 struct GPUVertexAttribLayout {
@@ -14,6 +15,8 @@ struct GPUVertexAttribLayout {
         unsigned Type{};
         unsigned Count{};
         bool IsNormalized{};
+
+        bool operator==(const Element&) const noexcept = default;
     };
 
     unsigned Stride{};
@@ -25,6 +28,8 @@ struct GPUVertexAttribLayout {
     template<typename T>
     void Define([[maybe_unused]] unsigned count, [[maybe_unused]] bool isNormalized = false) { DOA_LOG_FATAL("Unsupported Vertex attrib!"); std::unreachable(); }
 
+    bool operator==(const GPUVertexAttribLayout&) const noexcept = default;
+
     ND_GRAPHICS_COPYABLE_MOVEABLE_RESOURCE(GPUVertexAttribLayout);
 
 private:
@@ -36,6 +41,8 @@ void GPUVertexAttribLayout::Define<float_t>(unsigned count, bool isNormalized);
 template<>
 void GPUVertexAttribLayout::Define<double_t>(unsigned count, bool isNormalized);
 template<>
+void GPUVertexAttribLayout::Define<Half>(unsigned count, bool isNormalized);
+template<>
 void GPUVertexAttribLayout::Define<int8_t>(unsigned count, bool isNormalized);
 template<>
 void GPUVertexAttribLayout::Define<uint8_t>(unsigned count, bool isNormalized);
@@ -1,7 +1,11 @@
 ﻿#include <Engine/Graphics.hpp>
 
+#include <deque>
+#include <mutex>
+#include <vector>
 #include <cassert>
 #include <utility>
+#include <variant>
 #include <algorithm>
 #include <functional>
 
@@ -15,6 +19,7 @@
 #include <Engine/GPUFrameBuffer.hpp>
 #include <Engine/GPUPipeline.hpp>
 #include <Engine/GPUDescriptorSet.hpp>
+#include <Engine/GPUFence.hpp>
 
 namespace {
     GraphicsBackend currentBackend = static_cast<GraphicsBackend>(-1);
@@ -30,8 +35,17 @@ namespace {
     std::function<void(const GPUFrameBuffer&, GPUFrameBuffer&)> blitStencil;
     std::function<void(const GPUFrameBuffer&, GPUFrameBuffer&)> blitDepthStencil;
 
+    std::function<void(const GPUFrameBuffer&, unsigned, const PixelRegion&, GPUBuffer&, size_t)> readPixels;
+    std::function<void(const GPUTexture&, unsigned, const PixelRegion&, GPUBuffer&, size_t)> readTexturePixels;
+
     std::function<void(int, int)> render;
     std::function<void(int, int, int)> renderInstanced;
+    std::function<void(const GPUBuffer&, size_t)> renderIndirect;
+    std::function<void(const GPUBuffer&, int, size_t, size_t)> renderMultiIndirect;
+
+    std::function<void(unsigned, unsigned, unsigned)> dispatch;
+    std::function<void(const GPUBuffer&, size_t)> dispatchIndirect;
+    std::function<void(BarrierBits)> barrier;
 
     std::function<void(const GPUFrameBuffer&)> setRenderTarget;
     std::function<void(const GPUFrameBuffer&, std::span<unsigned>)> setRenderTargetPartial;
@@ -42,8 +56,15 @@ namespace {
     std::function<void(const GPUFrameBuffer&, std::array<float, 4>, float, int)> clearRenderTarget;
 
     std::function<void(const GPUPipeline&)> bindPipeline;
+    bool boundPipelineIsIndexed{ false }; /* picks the argument layout indirect draws are checked against */
+    std::function<void(const Region&)> setViewport;
 
     std::function<void(const GPUDescriptorSet&)> bindDescriptorSet;
+    std::function<void(unsigned, const GPUBuffer&, size_t, size_t)> bindUniformBufferRange;
+    std::function<size_t()> uniformBufferOffsetAlignment;
+
+    std::function<GPUFence()> insertFence;
+    std::function<bool(const GPUFence&, uint64_t)> waitFence;
 
     std::function<std::pair<std::optional<GPUBuffer>,        std::vector<BufferAllocatorMessage>>       (GPUBufferBuilder&)>        buildBuffer;
     std::function<std::pair<std::optional<GPUDescriptorSet>, std::vector<DescriptorSetAllocatorMessage>>(GPUDescriptorSetBuilder&)> buildDescriptorSet;
@@ -64,10 +85,66 @@ namespace {
     std::function<void(GPUShaderProgram&)> destroyShaderProgram;
     std::function<void(GPUSampler&)>       destroySampler;
     std::function<void(GPUTexture&)>       destroyTexture;
+    std::function<void(GPUFence&)>         destroyFence;
+
+    /* Resources whose destructor ran, waiting for the frames that might still use them to complete. Heap allocated
+    and never freed, resources with static storage are destroyed after this file's statics and still retire here. */
+    struct RetiredResources {
+        using Resource = std::variant<GPUBuffer, GPUTexture, GPUFrameBuffer, GPUShaderProgram>;
+        struct Entry {
+            Resource Object;
+            uint64_t Frame{};
+        };
+
+        std::mutex Mutex{};
+        std::deque<Entry> Queue{};
+        uint64_t Frame{ 0 };
+        size_t DestructionBudget{ Graphics::DEFAULT_DESTRUCTION_BUDGET };
+        size_t DestroyedLastFrame{ 0 };
+        std::vector<Resource> Expired{}; /* only touched by the thread calling RetireFrame */
+    };
+    RetiredResources& Retired() noexcept {
+        static RetiredResources* retired{ new RetiredResources };
+        return *retired;
+    }
+    /* Set while retired resources are destroyed, their destructors (and their attachments') must not retire again. */
+    thread_local bool destroyImmediately{ false };
+
+    /* Moved-from and never built resources hold nothing, Destruct drops them without calling the backend, so
+    releasing them needs no context on any thread. */
+    bool HoldsHandle(const GPUBuffer& buffer) noexcept { return buffer.GLObjectID != 0 || buffer.MappedData != nullptr; }
+    bool HoldsHandle(const GPUTexture& texture) noexcept { return texture.GLObjectID != 0; }
+    bool HoldsHandle(const GPUShaderProgram& program) noexcept { return program.GLObjectID != 0; }
+    bool HoldsHandle(const GPUFrameBuffer& framebuffer) noexcept {
+        auto holds = [](const std::optional<std::variant<GPUTexture, GPURenderBuffer>>& attachment) {
+            return attachment.has_value() && std::visit([](const auto& resource) { return resource.GLObjectID != 0; }, attachment.value());
+        };
+        return framebuffer.GLObjectID != 0 ||
+            holds(framebuffer.DepthAttachment) || holds(framebuffer.StencilAttachment) || holds(framebuffer.DepthStencilAttachment) ||
+            std::ranges::any_of(framebuffer.ColorAttachments, holds);
+    }
+
+    /* Moves resource, which holds a handle, into the retirement queue, leaving it empty. Returns false if it must
+    be destroyed now. */
+    template<typename T>
+    bool Retire(T& resource) noexcept {
+        if (destroyImmediately) { return false; }
+        RetiredResources& retired = Retired();
+        std::lock_guard lock{ retired.Mutex };
+        retired.Queue.emplace_back(RetiredResources::Resource{ std::in_place_type<T>, std::move(resource) }, retired.Frame);
+        return true;
+    }
+    void DestroyExpired(RetiredResources& retired) noexcept {
+        destroyImmediately = true;
+        retired.Expired.clear();
+        destroyImmediately = false;
+    }
 }
 
 void Graphics::ChangeGraphicsBackend(GraphicsBackend backend) noexcept {
+    FlushRetired(); /* retired handles belong to the outgoing backend */
     currentBackend = backend;
+    boundPipelineIsIndexed = false;
     using enum GraphicsBackend;
     if (backend == None) {
         DOA_LOG_WARNING("Graphics backend set to None. No rendering will be performed.");
@@ -83,11 +160,20 @@ void Graphics::ChangeGraphicsBackend(GraphicsBackend backend) noexcept {
         blitStencil      = Graphics::None::BlitStencil;
         blitDepthStencil = Graphics::None::BlitDepthStencil;
 
-        render          = Graphics::None::Render;
-        renderInstanced = Graphics::None::RenderInstanced;
+        readPixels        = Graphics::None::ReadPixels;
+        readTexturePixels = Graphics::None::ReadTexturePixels;
 
-        setRenderTarget          = static_cast<void(*)(const GPUFrameBuffer&)>                     (Graphics::OpenGL::SetRenderTarget);
-        setRenderTargetPartial   = static_cast<void(*)(const GPUFrameBuffer&, std::span<unsigned>)>(Graphics::OpenGL::SetRenderTarget);
+        render              = Graphics::None::Render;
+        renderInstanced     = Graphics::None::RenderInstanced;
+        renderIndirect      = Graphics::None::RenderIndirect;
+        renderMultiIndirect = Graphics::None::RenderMultiIndirect;
+
+        dispatch         = Graphics::None::Dispatch;
+        dispatchIndirect = Graphics::None::DispatchIndirect;
+        barrier          = Graphics::None::Barrier;
+
+        setRenderTarget          = static_cast<void(*)(const GPUFrameBuffer&)>                     (Graphics::None::SetRenderTarget);
+        setRenderTargetPartial   = static_cast<void(*)(const GPUFrameBuffer&, std::span<unsigned>)>(Graphics::None::SetRenderTarget);
         clearRenderTargetColor   = Graphics::None::ClearRenderTargetColor;
         clearRenderTargetColors  = Graphics::None::ClearRenderTargetColors;
         clearRenderTargetDepth   = Graphics::None::ClearRenderTargetDepth;
@@ -95,8 +181,14 @@ void Graphics::ChangeGraphicsBackend(GraphicsBackend backend) noexcept {
         clearRenderTarget        = Graphics::None::ClearRenderTarget;
 
         bindPipeline = Graphics::None::BindPipeline;
+        setViewport  = Graphics::None::SetViewport;
+
+        bindDescriptorSet            = Graphics::None::BindDescriptorSet;
+        bindUniformBufferRange       = Graphics::None::BindUniformBufferRange;
+        uniformBufferOffsetAlignment = Graphics::None::UniformBufferOffsetAlignment;
 
-        bindDescriptorSet = Graphics::None::BindDescriptorSet;
+        insertFence = Graphics::None::InsertFence;
+        waitFence   = Graphics::None::WaitFence;
 
         buildBuffer        = static_cast<std::pair<std::optional<GPUBuffer>,        std::vector<BufferAllocatorMessage>>(*)       (GPUBufferBuilder&)>       (Graphics::None::Build);
         buildDescriptorSet = static_cast<std::pair<std::optional<GPUDescriptorSet>, std::vector<DescriptorSetAllocatorMessage>>(*)(GPUDescriptorSetBuilder&)>(Graphics::None::Build);
@@ -117,6 +209,7 @@ void Graphics::ChangeGraphicsBackend(GraphicsBackend backend) noexcept {
         destroyShaderProgram = static_cast<void(*)(GPUShaderProgram&)>(Graphics::None::Destruct);
         destroySampler       = static_cast<void(*)(GPUSampler&)>      (Graphics::None::Destruct);
         destroyTexture       = static_cast<void(*)(GPUTexture&)>      (Graphics::None::Destruct);
+        destroyFence         = static_cast<void(*)(GPUFence&)>        (Graphics::None::Destruct);
     } else if (backend == Software) {
         std::unreachable(); /* not implemented yet */
     }
@@ -139,8 +232,17 @@ void Graphics::ChangeGraphicsBackend(GraphicsBackend backend) noexcept {
         blitStencil      = Graphics::OpenGL::BlitStencil;
         blitDepthStencil = Graphics::OpenGL::BlitDepthStencil;
 
-        render          = Graphics::OpenGL::Render;
-        renderInstanced = Graphics::OpenGL::RenderInstanced;
+        readPixels        = Graphics::OpenGL::ReadPixels;
+        readTexturePixels = Graphics::OpenGL::ReadTexturePixels;
+
+        render              = Graphics::OpenGL::Render;
+        renderInstanced     = Graphics::OpenGL::RenderInstanced;
+        renderIndirect      = Graphics::OpenGL::RenderIndirect;
+        renderMultiIndirect = Graphics::OpenGL::RenderMultiIndirect;
+
+        dispatch         = Graphics::OpenGL::Dispatch;
+        dispatchIndirect = Graphics::OpenGL::DispatchIndirect;
+        barrier          = Graphics::OpenGL::Barrier;
 
         setRenderTarget          = static_cast<void(*)(const GPUFrameBuffer&)>                     (Graphics::OpenGL::SetRenderTarget);
         setRenderTargetPartial   = static_cast<void(*)(const GPUFrameBuffer&, std::span<unsigned>)>(Graphics::OpenGL::SetRenderTarget);
@@ -151,8 +253,14 @@ void Graphics::ChangeGraphicsBackend(GraphicsBackend backend) noexcept {
         clearRenderTarget        = Graphics::OpenGL::ClearRenderTarget;
 
         bindPipeline = Graphics::OpenGL::BindPipeline;
+        setViewport  = Graphics::OpenGL::SetViewport;
 
-        bindDescriptorSet = Graphics::OpenGL::BindDescriptorSet;
+        bindDescriptorSet            = Graphics::OpenGL::BindDescriptorSet;
+        bindUniformBufferRange       = Graphics::OpenGL::BindUniformBufferRange;
+        uniformBufferOffsetAlignment = Graphics::OpenGL::UniformBufferOffsetAlignment;
+
+        insertFence = Graphics::OpenGL::InsertFence;
+        waitFence   = Graphics::OpenGL::WaitFence;
 
         buildBuffer        = static_cast<std::pair<std::optional<GPUBuffer>,        std::vector<BufferAllocatorMessage>>(*)       (GPUBufferBuilder&)>       (Graphics::OpenGL::Build);
         buildDescriptorSet = static_cast<std::pair<std::optional<GPUDescriptorSet>, std::vector<DescriptorSetAllocatorMessage>>(*)(GPUDescriptorSetBuilder&)>(Graphics::OpenGL::Build);
@@ -173,6 +281,7 @@ void Graphics::ChangeGraphicsBackend(GraphicsBackend backend) noexcept {
         destroyShaderProgram = static_cast<void(*)(GPUShaderProgram&)>(Graphics::OpenGL::Destruct);
         destroySampler       = static_cast<void(*)(GPUSampler&)>      (Graphics::OpenGL::Destruct);
         destroyTexture       = static_cast<void(*)(GPUTexture&)>      (Graphics::OpenGL::Destruct);
+        destroyFence         = static_cast<void(*)(GPUFence&)>        (Graphics::OpenGL::Destruct);
     }
 #endif
 #ifdef OPENGL_3_3_SUPPORT
@@ -249,6 +358,14 @@ void Graphics::BlitDepthStencil(const GPUFrameBuffer& source, GPUFrameBuffer& de
     assert(blitDepthStencil && "Did you forget to call Graphics::ChangeGraphicsBackend()?");
     blitDepthStencil(source, destination);
 }
+void Graphics::ReadPixels(const GPUFrameBuffer& source, unsigned colorAttachment, const PixelRegion& region, GPUBuffer& destination, size_t offsetBytes) noexcept {
+    assert(readPixels && "Did you forget to call Graphics::ChangeGraphicsBackend()?");
+    readPixels(source, colorAttachment, region, destination, offsetBytes);
+}
+void Graphics::ReadTexturePixels(const GPUTexture& source, unsigned level, const PixelRegion& region, GPUBuffer& destination, size_t offsetBytes) noexcept {
+    assert(readTexturePixels && "Did you forget to call Graphics::ChangeGraphicsBackend()?");
+    readTexturePixels(source, level, region, destination, offsetBytes);
+}
 
 void Graphics::Render(int count, int first) noexcept {
     assert(render && "Did you forget to call Graphics::ChangeGraphicsBackend()?");
@@ -258,6 +375,31 @@ void Graphics::RenderInstanced(int instanceCount, int count, int first) noexcept
     assert(renderInstanced && "Did you forget to call Graphics::ChangeGraphicsBackend()?");
     renderInstanced(instanceCount, count, first);
 }
+void Graphics::RenderIndirect(const GPUBuffer& arguments, size_t offsetBytes) noexcept {
+    assert(renderIndirect && "Did you forget to call Graphics::ChangeGraphicsBackend()?");
+    assert(AreIndirectArgumentsInRange(arguments, IndirectRenderArgumentsSize(), offsetBytes));
+    renderIndirect(arguments, offsetBytes);
+}
+void Graphics::RenderMultiIndirect(const GPUBuffer& arguments, int drawCount, size_t offsetBytes, size_t strideBytes) noexcept {
+    assert(renderMultiIndirect && "Did you forget to call Graphics::ChangeGraphicsBackend()?");
+    assert(AreIndirectArgumentsInRange(arguments, IndirectRenderArgumentsSize(), offsetBytes, drawCount, strideBytes));
+    renderMultiIndirect(arguments, drawCount, offsetBytes, strideBytes);
+}
+
+void Graphics::Dispatch(unsigned groupsX, unsigned groupsY, unsigned groupsZ) noexcept {
+    assert(dispatch && "Did you forget to call Graphics::ChangeGraphicsBackend()?");
+    assert(groupsX > 0 && groupsY > 0 && groupsZ > 0);
+    dispatch(groupsX, groupsY, groupsZ);
+}
+void Graphics::DispatchIndirect(const GPUBuffer& arguments, size_t offsetBytes) noexcept {
+    assert(dispatchIndirect && "Did you forget to call Graphics::ChangeGraphicsBackend()?");
+    assert(AreIndirectArgumentsInRange(arguments, sizeof(IndirectDispatchArguments), offsetBytes));
+    dispatchIndirect(arguments, offsetBytes);
+}
+void Graphics::Barrier(BarrierBits barriers) noexcept {
+    assert(barrier && "Did you forget to call Graphics::ChangeGraphicsBackend()?");
+    barrier(barriers);
+}
 
 void Graphics::SetRenderTarget(const GPUFrameBuffer& renderTarget) noexcept {
     assert(setRenderTarget && "Did you forget to call Graphics::ChangeGraphicsBackend()?");
@@ -290,14 +432,39 @@ void Graphics::ClearRenderTarget(const GPUFrameBuffer& renderTarget, std::array<
 
 void Graphics::BindPipeline(const GPUPipeline& pipeline) noexcept {
     assert(bindPipeline && "Did you forget to call Graphics::ChangeGraphicsBackend()?");
+    boundPipelineIsIndexed = pipeline.IndexBuffer != nullptr;
     bindPipeline(pipeline);
 }
+void Graphics::SetViewport(const Region& viewport) noexcept {
+    assert(setViewport && "Did you forget to call Graphics::ChangeGraphicsBackend()?");
+    setViewport(viewport);
+}
 
 void Graphics::BindDescriptorSet(const GPUDescriptorSet& descriptorSet) noexcept {
     assert(bindDescriptorSet && "Did you forget to call Graphics::ChangeGraphicsBackend()?");
     bindDescriptorSet(descriptorSet);
 }
 
+void Graphics::BindUniformBufferRange(unsigned binding, const GPUBuffer& buffer, size_t offsetBytes, size_t sizeBytes) noexcept {
+    assert(bindUniformBufferRange && "Did you forget to call Graphics::ChangeGraphicsBackend()?");
+    assert(offsetBytes % UniformBufferOffsetAlignment() == 0);
+    assert(offsetBytes + sizeBytes <= buffer.SizeBytes);
+    bindUniformBufferRange(binding, buffer, offsetBytes, sizeBytes);
+}
+size_t Graphics::UniformBufferOffsetAlignment() noexcept {
+    assert(uniformBufferOffsetAlignment && "Did you forget to call Graphics::ChangeGraphicsBackend()?");
+    return uniformBufferOffsetAlignment();
+}
+
+GPUFence Graphics::InsertFence() noexcept {
+    assert(insertFence && "Did you forget to call Graphics::ChangeGraphicsBackend()?");
+    return insertFence();
+}
+bool Graphics::WaitFence(const GPUFence& fence, uint64_t timeoutNanoseconds) noexcept {
+    assert(waitFence && "Did you forget to call Graphics::ChangeGraphicsBackend()?");
+    return waitFence(fence, timeoutNanoseconds);
+}
+
 std::pair<std::optional<::GPUBuffer>, std::vector<BufferAllocatorMessage>> Graphics::Builders::Build(GPUBufferBuilder& builder) noexcept {
     assert(buildBuffer && "Did you forget to call Graphics::ChangeGraphicsBackend()?");
     return buildBuffer(builder);
@@ -336,6 +503,7 @@ std::pair<std::optional<::GPUTexture>, std::vector<TextureAllocatorMessage>> Gra
 }
 
 void Graphics::Destructors::Destruct(GPUBuffer& buffer) noexcept {
+    if (!HoldsHandle(buffer) || Retire(buffer)) { return; }
     destroyBuffer(buffer);
 }
 void Graphics::Destructors::Destruct(GPUDescriptorSet& set) noexcept {
@@ -345,6 +513,7 @@ void Graphics::Destructors::Destruct(GPURenderBuffer& renderbuffer) noexcept {
     destroyRenderBuffer(renderbuffer);
 }
 void Graphics::Destructors::Destruct(GPUFrameBuffer& framebuffer) noexcept {
+    if (!HoldsHandle(framebuffer) || Retire(framebuffer)) { return; }
     destroyFrameBuffer(framebuffer);
 }
 void Graphics::Destructors::Destruct(GPUPipeline& pipeline) noexcept {
@@ -354,14 +523,67 @@ void Graphics::Destructors::Destruct(GPUShader& shader) noexcept {
     destroyShader(shader);
 }
 void Graphics::Destructors::Destruct(GPUShaderProgram& program) noexcept {
+    if (!HoldsHandle(program) || Retire(program)) { return; }
     destroyShaderProgram(program);
 }
 void Graphics::Destructors::Destruct(GPUSampler& sampler) noexcept {
     destroySampler(sampler);
 }
 void Graphics::Destructors::Destruct(GPUTexture& texture) noexcept {
+    if (!HoldsHandle(texture) || Retire(texture)) { return; }
     destroyTexture(texture);
 }
+void Graphics::Destructors::Destruct(GPUFence& fence) noexcept {
+    destroyFence(fence);
+}
+
+void Graphics::RetireFrame() noexcept {
+    RetiredResources& retired = Retired();
+    {
+        std::lock_guard lock{ retired.Mutex };
+        while (!retired.Queue.empty() &&
+               retired.Expired.size() < retired.DestructionBudget &&
+               retired.Queue.front().Frame + RETIREMENT_DELAY <= retired.Frame) {
+            retired.Expired.push_back(std::move(retired.Queue.front().Object));
+            retired.Queue.pop_front();
+        }
+        retired.DestroyedLastFrame = retired.Expired.size();
+        retired.Frame++;
+    }
+    DestroyExpired(retired);
+}
+void Graphics::FlushRetired() noexcept {
+    RetiredResources& retired = Retired();
+    {
+        std::lock_guard lock{ retired.Mutex };
+        for (auto& entry : retired.Queue) {
+            retired.Expired.push_back(std::move(entry.Object));
+        }
+        retired.Queue.clear();
+    }
+    DestroyExpired(retired);
+}
+void Graphics::SetDestructionBudget(size_t budget) noexcept {
+    assert(budget > 0);
+    RetiredResources& retired = Retired();
+    std::lock_guard lock{ retired.Mutex };
+    retired.DestructionBudget = budget;
+}
+Graphics::RetirementStats Graphics::GetRetirementStats() noexcept {
+    RetiredResources& retired = Retired();
+    std::lock_guard lock{ retired.Mutex };
+    return { retired.Queue.size(), retired.DestroyedLastFrame, retired.DestructionBudget };
+}
+
+size_t Graphics::IndirectRenderArgumentsSize() noexcept {
+    return boundPipelineIsIndexed ? sizeof(IndirectIndexedRenderArguments) : sizeof(IndirectRenderArguments);
+}
+bool Graphics::AreIndirectArgumentsInRange(const GPUBuffer& arguments, size_t argumentsBytes, size_t offsetBytes, int count, size_t strideBytes) noexcept {
+    if (count < 0 || offsetBytes % 4 != 0 || strideBytes % 4 != 0) { return false; }
+    if (count == 0) { return true; }
+    size_t lastOffsetBytes = offsetBytes + static_cast<size_t>(count - 1) * std::max(strideBytes, argumentsBytes);
+    return lastOffsetBytes + argumentsBytes <= arguments.SizeBytes;
+}
 
 std::ostream& operator<<(std::ostream& os, GraphicsBackend backend)       { return os << ToString(backend);  }
 std::ostream& operator<<(std::ostream& os, BufferProperties property)     { return os << ToString(property); }
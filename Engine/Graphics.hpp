@@ -24,6 +24,7 @@ struct GPUFrameBuffer;   struct GPUFrameBufferBuilder;
 struct GPURenderBuffer;  struct GPURenderBufferBuilder;
 struct GPUShaderProgram; struct GPUShaderProgramBuilder;
 struct GPUDescriptorSet; struct GPUDescriptorSetBuilder;
+struct GPUFence;
 
 #pragma region Graphics Messages
 using BufferAllocatorMessage = std::string;
@@ -123,6 +124,26 @@ constexpr BufferProperties operator |(const BufferProperties lhs, enum BufferPro
     return static_cast<BufferProperties>(static_cast<uint32_t>(lhs) | static_cast<uint32_t>(rhs));
 }
 
+/* What a Barrier makes writes of earlier shader invocations (compute or image/storage writes) visible to. */
+enum class BarrierBits : uint32_t {
+    VertexAttribArray = (1 << 0),
+    ElementArray = (1 << 1),
+    Uniform = (1 << 2),
+    TextureFetch = (1 << 3),
+    ShaderImageAccess = (1 << 4),
+    Command = (1 << 5), /* indirect arguments */
+    BufferUpdate = (1 << 6),
+    FrameBuffer = (1 << 7),
+    ShaderStorage = (1 << 8),
+    All = 0x1FF
+};
+constexpr BarrierBits operator &(const BarrierBits lhs, const BarrierBits rhs) {
+    return static_cast<BarrierBits>(static_cast<uint32_t>(lhs) & static_cast<uint32_t>(rhs));
+}
+constexpr BarrierBits operator |(const BarrierBits lhs, const BarrierBits rhs) {
+    return static_cast<BarrierBits>(static_cast<uint32_t>(lhs) | static_cast<uint32_t>(rhs));
+}
+
 enum class ShaderType {
     Vertex,
     TessellationControl,
@@ -320,6 +341,37 @@ enum class InputRate {
 };
 #pragma endregion
 
+/* Layouts of the arguments read by the indirect calls, tightly packed 32-bit fields, as the GPU reads them. */
+struct IndirectRenderArguments {
+    uint32_t Count{};
+    uint32_t InstanceCount{ 1 };
+    uint32_t First{};
+    uint32_t BaseInstance{};
+};
+struct IndirectIndexedRenderArguments {
+    uint32_t Count{};
+    uint32_t InstanceCount{ 1 };
+    uint32_t FirstIndex{};
+    int32_t BaseVertex{};
+    uint32_t BaseInstance{};
+};
+struct IndirectDispatchArguments {
+    uint32_t GroupsX{ 1 };
+    uint32_t GroupsY{ 1 };
+    uint32_t GroupsZ{ 1 };
+};
+
+/* A rectangle of pixels to read back, origin bottom-left, and the layout its pixels are tightly packed in. */
+struct PixelRegion {
+    int X{ 0 };
+    int Y{ 0 };
+    unsigned Width{ 1 };
+    unsigned Height{ 1 };
+    DataFormat Format{ DataFormat::RGBA8 };
+
+    bool operator==(const PixelRegion&) const noexcept = default;
+};
+
 #define GRAPHICS_FUNCTIONS(base, builders, destructors)                                                                                                                         \
 namespace base {                                                                                                                                                                \
     void BufferSubData(GPUBuffer& buffer, RawDataView dataView, size_t offsetBytes = 0uLL) noexcept;                                                                            \
@@ -333,9 +385,19 @@ namespace base {
     void BlitDepth(const GPUFrameBuffer& source, GPUFrameBuffer& destination) noexcept;                                                                                         \
     void BlitStencil(const GPUFrameBuffer& source, GPUFrameBuffer& destination) noexcept;                                                                                       \
     void BlitDepthStencil(const GPUFrameBuffer& source, GPUFrameBuffer& destination) noexcept;                                                                                  \
+    /* Packs region of a color attachment or texture level into destination at offsetBytes. Ordered with later commands, fence it before reading on the CPU. */                 \
+    void ReadPixels(const GPUFrameBuffer& source, unsigned colorAttachment, const PixelRegion& region, GPUBuffer& destination, size_t offsetBytes = 0uLL) noexcept;             \
+    void ReadTexturePixels(const GPUTexture& source, unsigned level, const PixelRegion& region, GPUBuffer& destination, size_t offsetBytes = 0uLL) noexcept;                    \
                                                                                                                                                                                 \
     void Render(int count, int first = 0) noexcept;                                                                                                                             \
     void RenderInstanced(int instanceCount, int count, int first = 0) noexcept;                                                                                                 \
+    /* Indirect draws read IndirectRenderArguments, or IndirectIndexedRenderArguments if the pipeline has an index buffer. */                                                   \
+    void RenderIndirect(const GPUBuffer& arguments, size_t offsetBytes = 0uLL) noexcept;                                                                                        \
+    void RenderMultiIndirect(const GPUBuffer& arguments, int drawCount, size_t offsetBytes = 0uLL, size_t strideBytes = 0uLL) noexcept;                                         \
+                                                                                                                                                                                \
+    void Dispatch(unsigned groupsX, unsigned groupsY = 1, unsigned groupsZ = 1) noexcept;                                                                                       \
+    void DispatchIndirect(const GPUBuffer& arguments, size_t offsetBytes = 0uLL) noexcept;                                                                                      \
+    void Barrier(BarrierBits barriers) noexcept;                                                                                                                                \
                                                                                                                                                                                 \
     void SetRenderTarget(const GPUFrameBuffer& renderTarget) noexcept;                                                                                                          \
     void SetRenderTarget(const GPUFrameBuffer& renderTarget, std::span<unsigned> targets) noexcept;                                                                             \
@@ -346,8 +408,15 @@ namespace base {
     void ClearRenderTarget(const GPUFrameBuffer& renderTarget, std::array<float, 4> color = { 0, 0, 0, 0 }, float depth = 1, int stencil = 0) noexcept;                         \
                                                                                                                                                                                 \
     void BindPipeline(const GPUPipeline& pipeline) noexcept;                                                                                                                    \
+    /* Dynamic state, not part of the pipeline, so one pipeline serves every render target size. */                                                                             \
+    void SetViewport(const Region& viewport) noexcept;                                                                                                                          \
                                                                                                                                                                                 \
     void BindDescriptorSet(const GPUDescriptorSet& descriptorSet) noexcept;                                                                                                     \
+    void BindUniformBufferRange(unsigned binding, const GPUBuffer& buffer, size_t offsetBytes, size_t sizeBytes) noexcept;                                                      \
+    size_t UniformBufferOffsetAlignment() noexcept;                                                                                                                             \
+                                                                                                                                                                                \
+    [[nodiscard]] GPUFence InsertFence() noexcept;                                                                                                                              \
+    bool WaitFence(const GPUFence& fence, uint64_t timeoutNanoseconds) noexcept;                                                                                                \
 }                                                                                                                                                                               \
 namespace builders {                                                                                                                                                            \
     [[nodiscard]] std::pair<std::optional<GPUBuffer>,        std::vector<BufferAllocatorMessage>>        Build(GPUBufferBuilder& builder) noexcept;                             \
@@ -370,10 +439,36 @@ namespace destructors {
     void Destruct(GPUShaderProgram& program) noexcept;                                                                                                                          \
     void Destruct(GPUSampler& sampler) noexcept;                                                                                                                                \
     void Destruct(GPUTexture& texture) noexcept;                                                                                                                                \
+    void Destruct(GPUFence& fence) noexcept;                                                                                                                                    \
 }
 
 namespace Graphics {
     void ChangeGraphicsBackend(GraphicsBackend backend) noexcept;
+
+    /* Buffers, textures, frame buffers and shader programs are not destroyed by their destructors. Their handles
+    are retired instead and destroyed by RetireFrame RETIREMENT_DELAY frames later, when commands still referencing
+    them have completed. RetireFrame destroys at most the destruction budget many per call, so mass deletes are
+    spread over frames instead of stalling one. Retiring is thread safe, destroying is done on the calling thread
+    of RetireFrame, which must own the context. */
+    constexpr uint64_t RETIREMENT_DELAY{ 3 };
+    constexpr size_t DEFAULT_DESTRUCTION_BUDGET{ 64 };
+
+    struct RetirementStats {
+        size_t Pending{ 0 };
+        size_t DestroyedLastFrame{ 0 };
+        size_t DestructionBudget{ DEFAULT_DESTRUCTION_BUDGET };
+    };
+
+    void RetireFrame() noexcept;
+    void FlushRetired() noexcept;
+    void SetDestructionBudget(size_t budget) noexcept;
+    RetirementStats GetRetirementStats() noexcept;
+
+    /* Size of the arguments an indirect draw reads with the bound pipeline. */
+    size_t IndirectRenderArgumentsSize() noexcept;
+    /* Whether count arguments of argumentsBytes each, strideBytes apart (0 is tightly packed) from offsetBytes on,
+    are 4 byte aligned and lie within arguments. Indirect calls assert it. */
+    bool AreIndirectArgumentsInRange(const GPUBuffer& arguments, size_t argumentsBytes, size_t offsetBytes, int count = 1, size_t strideBytes = 0uLL) noexcept;
 }
 
 GRAPHICS_FUNCTIONS(Graphics, Graphics::Builders, Graphics::Destructors)
@@ -600,6 +695,151 @@ constexpr std::string_view ToString(DataFormat format) {
     }
     std::unreachable();
 }
+/* Storage bits of one texel, as the format is laid out in memory. Drivers may pad some formats (RGB8, DEPTH24),
+use this for budgeting, not for addressing. */
+constexpr size_t BitsPerPixel(DataFormat format) noexcept {
+    using enum DataFormat;
+    switch (format) {
+    case R3G3B2:
+    case RGBA2:
+    case R8:
+    case R8_SNORM:
+    case R8UI:
+    case R8I:
+    case STENCIL8:           return 8;
+    case STENCIL1:           return 1;
+    case STENCIL4:           return 4;
+    case RGB4:               return 12;
+    case RGB5:               return 15;
+    case RG8:
+    case RG8_SNORM:
+    case RG8UI:
+    case RG8I:
+    case R16:
+    case R16F:
+    case R16_SNORM:
+    case R16UI:
+    case R16I:
+    case DEPTH16:
+    case STENCIL16:
+    case RGB5A1:
+    case RGB565:
+    case RGBA4:              return 16;
+    case RGB8:
+    case RGB8_SNORM:
+    case RGB8UI:
+    case RGB8I:
+    case SRGB8:
+    case DEPTH24:            return 24;
+    case RGB10:              return 30;
+    case RGBA8:
+    case RGBA8_SNORM:
+    case RGBA8UI:
+    case RGBA8I:
+    case SRGBA8:
+    case RG16:
+    case RG16F:
+    case RG16_SNORM:
+    case RG16UI:
+    case RG16I:
+    case R32F:
+    case R32UI:
+    case R32I:
+    case DEPTH32:
+    case DEPTH32F:
+    case DEPTH24_STENCIL8:
+    case RGB10A2:
+    case RGB10A2UI:
+    case R11FG11FB10F:
+    case RGB9E5:             return 32;
+    case RGB12:              return 36;
+    case DEPTH32F_STENCIL8:  return 40;
+    case RGB16:
+    case RGB16F:
+    case RGB16_SNORM:
+    case RGB16UI:
+    case RGB16I:
+    case RGBA12:             return 48;
+    case RGBA16:
+    case RGBA16F:
+    case RGBA16_SNORM:
+    case RGBA16UI:
+    case RGBA16I:
+    case RG32F:
+    case RG32UI:
+    case RG32I:              return 64;
+    case RGB32F:
+    case RGB32UI:
+    case RGB32I:             return 96;
+    case RGBA32F:
+    case RGBA32UI:
+    case RGBA32I:            return 128;
+    }
+    std::unreachable();
+}
+/* Bytes of one pixel read back packed as format, 0 if format has no packed layout to be read back in. */
+constexpr size_t ReadbackBytesPerPixel(DataFormat format) noexcept {
+    using enum DataFormat;
+    switch (format) {
+    case R8:
+    case R8_SNORM:
+    case R8UI:
+    case R8I:
+    case STENCIL8:           return 1;
+    case RG8:
+    case RG8_SNORM:
+    case RG8UI:
+    case RG8I:
+    case R16:
+    case R16F:
+    case R16_SNORM:
+    case R16UI:
+    case R16I:
+    case DEPTH16:            return 2;
+    case RGB8:
+    case RGB8_SNORM:
+    case RGB8UI:
+    case RGB8I:
+    case SRGB8:              return 3;
+    case RGBA8:
+    case RGBA8_SNORM:
+    case RGBA8UI:
+    case RGBA8I:
+    case SRGBA8:
+    case RG16:
+    case RG16F:
+    case RG16_SNORM:
+    case RG16UI:
+    case RG16I:
+    case R32F:
+    case R32UI:
+    case R32I:
+    case DEPTH24:
+    case DEPTH32:
+    case DEPTH32F:
+    case DEPTH24_STENCIL8:   return 4;
+    case RGB16:
+    case RGB16F:
+    case RGB16_SNORM:
+    case RGB16UI:
+    case RGB16I:             return 6;
+    case RGBA16:
+    case RGBA16F:
+    case RGBA16_SNORM:
+    case RGBA16UI:
+    case RGBA16I:
+    case RG32F:
+    case RG32UI:
+    case RG32I:              return 8;
+    case RGB32F:
+    case RGB32UI:
+    case RGB32I:             return 12;
+    case RGBA32F:
+    case RGBA32UI:
+    case RGBA32I:            return 16;
+    default:                 return 0;
+    }
+}
 constexpr std::string_view ToString(TopologyType t) noexcept {
     using enum TopologyType;
     switch (t) {
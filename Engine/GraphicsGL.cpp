@@ -18,6 +18,7 @@
 #include <Engine/GPUPipeline.hpp>
 #include <Engine/GPUFrameBuffer.hpp>
 #include <Engine/GPUDescriptorSet.hpp>
+#include <Engine/GPUFence.hpp>
 
 #ifdef DEBUG
 #include <debugbreak.h>
@@ -375,6 +376,30 @@ void Graphics::OpenGL::BlitDepthStencil(const GPUFrameBuffer& source, GPUFrameBu
         GL_NEAREST
     );
 }
+void Graphics::OpenGL::ReadPixels(const GPUFrameBuffer& source, unsigned colorAttachment, const PixelRegion& region, GPUBuffer& destination, size_t offsetBytes) noexcept {
+    assert(ReadbackBytesPerPixel(region.Format) > 0);
+    assert(offsetBytes + size_t{ region.Width } * region.Height * ReadbackBytesPerPixel(region.Format) <= destination.SizeBytes);
+    glNamedFramebufferReadBuffer(source.GLObjectID, source.GLObjectID == 0 ? GL_BACK : GL_COLOR_ATTACHMENT0 + colorAttachment);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, source.GLObjectID);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, destination.GLObjectID);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(region.X, region.Y, region.Width, region.Height, ToGLPixelFormat(region.Format), ToGLPixelType(region.Format), reinterpret_cast<void*>(offsetBytes));
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+void Graphics::OpenGL::ReadTexturePixels(const GPUTexture& source, unsigned level, const PixelRegion& region, GPUBuffer& destination, size_t offsetBytes) noexcept {
+    assert(ReadbackBytesPerPixel(region.Format) > 0);
+    assert(!source.IsMultisampled()); // Resolve multisampled textures first, they can't be read directly.
+    assert(offsetBytes + size_t{ region.Width } * region.Height * ReadbackBytesPerPixel(region.Format) <= destination.SizeBytes);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, destination.GLObjectID);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glGetTextureSubImage(
+        source.GLObjectID, level,
+        region.X, region.Y, 0, region.Width, region.Height, 1,
+        ToGLPixelFormat(region.Format), ToGLPixelType(region.Format),
+        static_cast<GLsizei>(destination.SizeBytes - offsetBytes), reinterpret_cast<void*>(offsetBytes)
+    );
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
 
 void Graphics::OpenGL::Render(int count, int first) noexcept {
     const GPUPipeline& pipeline = currentPipeline->get();
@@ -392,6 +417,54 @@ void Graphics::OpenGL::RenderInstanced(int instanceCount, int count, int first)
         glDrawArraysInstanced(ToGLTopology(pipeline.Topology), first, count, instanceCount);
     }
 }
+void Graphics::OpenGL::RenderIndirect(const GPUBuffer& arguments, size_t offsetBytes) noexcept {
+    const GPUPipeline& pipeline = currentPipeline->get();
+    const void* offset = reinterpret_cast<const void*>(offsetBytes);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, arguments.GLObjectID);
+    if (pipeline.IndexBuffer) {
+        glDrawElementsIndirect(ToGLTopology(pipeline.Topology), ToGLDataType(pipeline.IndexType), offset);
+    } else {
+        glDrawArraysIndirect(ToGLTopology(pipeline.Topology), offset);
+    }
+}
+void Graphics::OpenGL::RenderMultiIndirect(const GPUBuffer& arguments, int drawCount, size_t offsetBytes, size_t strideBytes) noexcept {
+    const GPUPipeline& pipeline = currentPipeline->get();
+    const void* offset = reinterpret_cast<const void*>(offsetBytes);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, arguments.GLObjectID);
+    if (pipeline.IndexBuffer) {
+        glMultiDrawElementsIndirect(ToGLTopology(pipeline.Topology), ToGLDataType(pipeline.IndexType), offset, drawCount, static_cast<GLsizei>(strideBytes));
+    } else {
+        glMultiDrawArraysIndirect(ToGLTopology(pipeline.Topology), offset, drawCount, static_cast<GLsizei>(strideBytes));
+    }
+}
+
+void Graphics::OpenGL::Dispatch(unsigned groupsX, unsigned groupsY, unsigned groupsZ) noexcept {
+    assert(currentPipeline.has_value()); // bind a pipeline whose program has a compute stage first
+    glDispatchCompute(groupsX, groupsY, groupsZ);
+}
+void Graphics::OpenGL::DispatchIndirect(const GPUBuffer& arguments, size_t offsetBytes) noexcept {
+    assert(currentPipeline.has_value());
+    glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, arguments.GLObjectID);
+    glDispatchComputeIndirect(static_cast<GLintptr>(offsetBytes));
+}
+void Graphics::OpenGL::Barrier(BarrierBits barriers) noexcept {
+    if (barriers == BarrierBits::All) {
+        glMemoryBarrier(GL_ALL_BARRIER_BITS);
+        return;
+    }
+    auto has = [barriers](BarrierBits bit) { return static_cast<bool>(barriers & bit); };
+    GLbitfield bits = 0;
+    if (has(BarrierBits::VertexAttribArray)) { bits |= GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT;  }
+    if (has(BarrierBits::ElementArray))      { bits |= GL_ELEMENT_ARRAY_BARRIER_BIT;        }
+    if (has(BarrierBits::Uniform))           { bits |= GL_UNIFORM_BARRIER_BIT;              }
+    if (has(BarrierBits::TextureFetch))      { bits |= GL_TEXTURE_FETCH_BARRIER_BIT;        }
+    if (has(BarrierBits::ShaderImageAccess)) { bits |= GL_SHADER_IMAGE_ACCESS_BARRIER_BIT;  }
+    if (has(BarrierBits::Command))           { bits |= GL_COMMAND_BARRIER_BIT;              }
+    if (has(BarrierBits::BufferUpdate))      { bits |= GL_BUFFER_UPDATE_BARRIER_BIT;        }
+    if (has(BarrierBits::FrameBuffer))       { bits |= GL_FRAMEBUFFER_BARRIER_BIT;          }
+    if (has(BarrierBits::ShaderStorage))     { bits |= GL_SHADER_STORAGE_BARRIER_BIT;       }
+    glMemoryBarrier(bits);
+}
 
 void Graphics::OpenGL::SetRenderTarget(const GPUFrameBuffer& renderTarget) noexcept {
     if (renderTarget.GLObjectID != 0) {
@@ -456,7 +529,6 @@ void Graphics::OpenGL::BindPipeline(const GPUPipeline& pipeline) noexcept {
     glPolygonMode(GL_FRONT_AND_BACK, ToGLPolygonMode(pipeline.Polygon));
     pipeline.IsFaceCullingEnabled ? glEnable(GL_CULL_FACE) : glDisable(GL_CULL_FACE);
     glCullFace(ToGLCullMode(pipeline.Cull));
-    glViewport(pipeline.Viewport.X, pipeline.Viewport.Y, pipeline.Viewport.Width, pipeline.Viewport.Height);
 
     pipeline.IsScissorEnabled ? glEnable(GL_SCISSOR_TEST) : glDisable(GL_SCISSOR_TEST);
     glScissor(pipeline.Scissor.X, pipeline.Scissor.Y, pipeline.Scissor.Width, pipeline.Scissor.Height);
@@ -480,6 +552,9 @@ void Graphics::OpenGL::BindPipeline(const GPUPipeline& pipeline) noexcept {
     glUseProgram(pipeline.ShaderProgram->get().GLObjectID);
     glBindVertexArray(pipeline.GLObjectID);
 }
+void Graphics::OpenGL::SetViewport(const Region& viewport) noexcept {
+    glViewport(viewport.X, viewport.Y, viewport.Width, viewport.Height);
+}
 
 void Graphics::OpenGL::BindDescriptorSet(const GPUDescriptorSet& descriptorSet) noexcept {
     for (const DescriptorBinding& binding : descriptorSet.Bindings) {
@@ -501,12 +576,42 @@ void Graphics::OpenGL::BindDescriptorSet(const GPUDescriptorSet& descriptorSet)
     }
 }
 
+void Graphics::OpenGL::BindUniformBufferRange(unsigned binding, const GPUBuffer& buffer, size_t offsetBytes, size_t sizeBytes) noexcept {
+    glBindBufferRange(GL_UNIFORM_BUFFER, binding, buffer.GLObjectID, offsetBytes, sizeBytes);
+}
+size_t Graphics::OpenGL::UniformBufferOffsetAlignment() noexcept {
+    static const size_t alignment = [] {
+        GLint value;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &value);
+        return static_cast<size_t>(value);
+    }();
+    return alignment;
+}
+
+GPUFence Graphics::OpenGL::InsertFence() noexcept {
+    GPUFence fence;
+    fence.GLObject = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    return fence;
+}
+bool Graphics::OpenGL::WaitFence(const GPUFence& fence, uint64_t timeoutNanoseconds) noexcept {
+    if (!fence.IsValid()) { return true; }
+    GLenum result = glClientWaitSync(fence.GLObject, GL_SYNC_FLUSH_COMMANDS_BIT, timeoutNanoseconds);
+    return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+}
+
 std::pair<std::optional<::GPUBuffer>, std::vector<BufferAllocatorMessage>> Graphics::OpenGL::Build(GPUBufferBuilder& builder) noexcept {
     GLuint buffer;
     glCreateBuffers(1, &buffer);
 
     glNamedBufferStorage(buffer, builder.size, builder.data, ToGLBufferFlags(builder.properties));
 
+    void* mappedData{ nullptr };
+    using enum BufferProperties;
+    if (static_cast<bool>(builder.properties & Persistent) && static_cast<bool>(builder.properties & (ReadableFromCPU | WriteableFromCPU))) {
+        GLbitfield access = ToGLBufferFlags(builder.properties) & (GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+        mappedData = glMapNamedBufferRange(buffer, 0, builder.size, access);
+    }
+
     std::optional<GPUBuffer> gpuBuffer{ std::nullopt };
     gpuBuffer.emplace();
     gpuBuffer->GLObjectID = buffer;
@@ -515,6 +620,7 @@ std::pair<std::optional<::GPUBuffer>, std::vector<BufferAllocatorMessage>> Graph
 #endif
     gpuBuffer->Properties = builder.properties;
     gpuBuffer->SizeBytes = builder.size;
+    gpuBuffer->MappedData = mappedData;
 
     return { std::move(gpuBuffer), {} };
 }
@@ -681,12 +787,14 @@ std::pair<std::optional<::GPUPipeline>, std::vector<PipelineAllocatorMessage>> G
             if (elem.Count == 0) { continue; }
 
             glEnableVertexArrayAttrib(vertexArray, attribIndex);
-            if (elem.Type == GL_INT ||
+            // Normalized integers (unorm8 colors, snorm16 normals...) are read as floats, the rest stay integers.
+            if (!elem.IsNormalized && (
+                elem.Type == GL_INT ||
                 elem.Type == GL_BYTE ||
                 elem.Type == GL_SHORT ||
                 elem.Type == GL_UNSIGNED_INT ||
                 elem.Type == GL_UNSIGNED_BYTE ||
-                elem.Type == GL_UNSIGNED_SHORT) {
+                elem.Type == GL_UNSIGNED_SHORT)) {
                 glVertexArrayAttribIFormat(vertexArray, attribIndex, elem.Count, elem.Type, layout.Offsets[i]);
             } else if (elem.Type == GL_DOUBLE) {
                 glVertexArrayAttribLFormat(vertexArray, attribIndex, elem.Count, elem.Type, layout.Offsets[i]);
@@ -716,7 +824,6 @@ std::pair<std::optional<::GPUPipeline>, std::vector<PipelineAllocatorMessage>> G
     gpuPipeline->IsFaceCullingEnabled = builder.isFaceCullingEnabled;
     gpuPipeline->Cull = builder.cullMode;
     gpuPipeline->Polygon = builder.polygonMode;
-    gpuPipeline->Viewport = builder.viewport;
     gpuPipeline->IsScissorEnabled = builder.isScissorEnabled;
     gpuPipeline->Scissor = builder.scissor;
     gpuPipeline->IsDepthTestEnabled = builder.isDepthTestEnabled;
@@ -950,6 +1057,9 @@ void Graphics::OpenGL::Destruct(GPUSampler& sampler) noexcept {
 void Graphics::OpenGL::Destruct(GPUTexture& texture) noexcept {
     glDeleteTextures(1, &texture.GLObjectID);
 }
+void Graphics::OpenGL::Destruct(GPUFence& fence) noexcept {
+    glDeleteSync(fence.GLObject);
+}
 
 #ifdef DEBUG
 static void MessageCallback(GLenum source, GLenum type, GLuint id, GLenum severity, [[maybe_unused]] GLsizei length, const GLchar* message, [[maybe_unused]] const void* user_param) {
@@ -251,6 +251,118 @@ constexpr GLenum ToGLBaseFormat(DataFormat format) {
     }
     std::unreachable();
 }
+/* Client format of pixels read back as format, integer formats are read unnormalized. Only formats with a ReadbackBytesPerPixel. */
+constexpr GLenum ToGLPixelFormat(DataFormat format) noexcept {
+    using enum DataFormat;
+    switch (format) {
+    case R8UI:
+    case R16UI:
+    case R32UI:
+    case R8I:
+    case R16I:
+    case R32I:
+        return GL_RED_INTEGER;
+    case RG8UI:
+    case RG16UI:
+    case RG32UI:
+    case RG8I:
+    case RG16I:
+    case RG32I:
+        return GL_RG_INTEGER;
+    case RGB8UI:
+    case RGB16UI:
+    case RGB32UI:
+    case RGB8I:
+    case RGB16I:
+    case RGB32I:
+        return GL_RGB_INTEGER;
+    case RGBA8UI:
+    case RGBA16UI:
+    case RGBA32UI:
+    case RGBA8I:
+    case RGBA16I:
+    case RGBA32I:
+        return GL_RGBA_INTEGER;
+    case SRGB8:
+        return GL_RGB;
+    case SRGBA8:
+        return GL_RGBA;
+    default:
+        return ToGLBaseFormat(format);
+    }
+}
+constexpr GLenum ToGLPixelType(DataFormat format) noexcept {
+    using enum DataFormat;
+    switch (format) {
+    case R8:
+    case RG8:
+    case RGB8:
+    case RGBA8:
+    case R8UI:
+    case RG8UI:
+    case RGB8UI:
+    case RGBA8UI:
+    case SRGB8:
+    case SRGBA8:
+    case STENCIL8:
+        return GL_UNSIGNED_BYTE;
+    case R8_SNORM:
+    case RG8_SNORM:
+    case RGB8_SNORM:
+    case RGBA8_SNORM:
+    case R8I:
+    case RG8I:
+    case RGB8I:
+    case RGBA8I:
+        return GL_BYTE;
+    case R16:
+    case RG16:
+    case RGB16:
+    case RGBA16:
+    case R16UI:
+    case RG16UI:
+    case RGB16UI:
+    case RGBA16UI:
+    case DEPTH16:
+        return GL_UNSIGNED_SHORT;
+    case R16_SNORM:
+    case RG16_SNORM:
+    case RGB16_SNORM:
+    case RGBA16_SNORM:
+    case R16I:
+    case RG16I:
+    case RGB16I:
+    case RGBA16I:
+        return GL_SHORT;
+    case R16F:
+    case RG16F:
+    case RGB16F:
+    case RGBA16F:
+        return GL_HALF_FLOAT;
+    case R32F:
+    case RG32F:
+    case RGB32F:
+    case RGBA32F:
+    case DEPTH32F:
+        return GL_FLOAT;
+    case R32UI:
+    case RG32UI:
+    case RGB32UI:
+    case RGBA32UI:
+    case DEPTH24:
+    case DEPTH32:
+        return GL_UNSIGNED_INT;
+    case R32I:
+    case RG32I:
+    case RGB32I:
+    case RGBA32I:
+        return GL_INT;
+    case DEPTH24_STENCIL8:
+        return GL_UNSIGNED_INT_24_8;
+    default:
+        std::unreachable();
+    }
+}
 constexpr GLenum ToGLTopology(TopologyType t) noexcept {
     using enum TopologyType;
     switch (t) {
@@ -8,6 +8,11 @@
 #include <Engine/GPUPipeline.hpp>
 #include <Engine/GPUFrameBuffer.hpp>
 #include <Engine/GPUDescriptorSet.hpp>
+#include <Engine/GPUFence.hpp>
+
+#include <new>
+#include <vector>
+#include <cstddef>
 
 #ifdef _MSC_VER  // Check if compiling with Visual C++
 #pragma warning(disable : 4100) // disable warning C4100: 'parameter': unreferenced formal parameter
@@ -15,6 +20,15 @@
 #pragma GCC diagnostic ignored "-Wunused-parameter" // ignore -Wunused-parameter warning
 #endif
 
+namespace {
+    bool recording{ false };
+    std::vector<Graphics::None::RecordedCommand> recordedCommands;
+
+    void Record(Graphics::None::RecordedCommand&& command) noexcept {
+        if (recording) { recordedCommands.push_back(std::move(command)); }
+    }
+}
+
 void Graphics::None::BufferSubData(GPUBuffer& buffer, size_t sizeBytes, NonOwningPointerToConstRawData data, size_t offsetBytes) noexcept {}
 void Graphics::None::GetBufferSubData(const GPUBuffer& buffer, RawDataWriteableView dataView, size_t offsetBytes) noexcept {}
 void Graphics::None::CopyBufferSubData(const GPUBuffer& readBuffer, GPUBuffer& writeBuffer, size_t sizeBytesToCopy, size_t readOffsetBytes, size_t writeOffsetBytes) noexcept {}
@@ -25,9 +39,31 @@ void Graphics::None::BlitColor(const GPUFrameBuffer& source, GPUFrameBuffer& des
 void Graphics::None::BlitDepth(const GPUFrameBuffer& source, GPUFrameBuffer& destination) noexcept {}
 void Graphics::None::BlitStencil(const GPUFrameBuffer& source, GPUFrameBuffer& destination) noexcept {}
 void Graphics::None::BlitDepthStencil(const GPUFrameBuffer& source, GPUFrameBuffer& destination) noexcept {}
+void Graphics::None::ReadPixels(const GPUFrameBuffer& source, unsigned colorAttachment, const PixelRegion& region, GPUBuffer& destination, size_t offsetBytes) noexcept {}
+void Graphics::None::ReadTexturePixels(const GPUTexture& source, unsigned level, const PixelRegion& region, GPUBuffer& destination, size_t offsetBytes) noexcept {}
 
 void Graphics::None::Render(int count, int first) noexcept {}
 void Graphics::None::RenderInstanced(int instanceCount, int count, int first) noexcept {}
+void Graphics::None::RenderIndirect(const GPUBuffer& arguments, size_t offsetBytes) noexcept {
+    Record({ .Type = RecordedCommand::Kind::RenderIndirect, .Arguments = &arguments, .OffsetBytes = offsetBytes, .DrawCount = 1 });
+}
+void Graphics::None::RenderMultiIndirect(const GPUBuffer& arguments, int drawCount, size_t offsetBytes, size_t strideBytes) noexcept {
+    Record({ .Type = RecordedCommand::Kind::RenderMultiIndirect, .Arguments = &arguments, .OffsetBytes = offsetBytes, .DrawCount = drawCount, .StrideBytes = strideBytes });
+}
+
+void Graphics::None::Dispatch(unsigned groupsX, unsigned groupsY, unsigned groupsZ) noexcept {
+    Record({ .Type = RecordedCommand::Kind::Dispatch, .GroupsX = groupsX, .GroupsY = groupsY, .GroupsZ = groupsZ });
+}
+void Graphics::None::DispatchIndirect(const GPUBuffer& arguments, size_t offsetBytes) noexcept {
+    Record({ .Type = RecordedCommand::Kind::DispatchIndirect, .Arguments = &arguments, .OffsetBytes = offsetBytes });
+}
+void Graphics::None::Barrier(BarrierBits barriers) noexcept {
+    Record({ .Type = RecordedCommand::Kind::Barrier, .Barriers = barriers });
+}
+
+void Graphics::None::SetCommandRecording(bool enabled) noexcept { recording = enabled; }
+const std::vector<Graphics::None::RecordedCommand>& Graphics::None::RecordedCommands() noexcept { return recordedCommands; }
+void Graphics::None::ClearRecordedCommands() noexcept { recordedCommands.clear(); }
 
 void Graphics::None::SetRenderTarget(const GPUFrameBuffer& renderTarget) noexcept {}
 void Graphics::None::SetRenderTarget(const GPUFrameBuffer& renderTarget, std::span<unsigned> targets) noexcept {}
@@ -38,23 +74,82 @@ void Graphics::None::ClearRenderTargetStencil(const GPUFrameBuffer& renderTarget
 void Graphics::None::ClearRenderTarget(const GPUFrameBuffer& renderTarget, std::array<float, 4> color, float depth, int stencil) noexcept {}
 
 void Graphics::None::BindPipeline(const GPUPipeline& pipeline) noexcept {}
+void Graphics::None::SetViewport(const Region& viewport) noexcept {
+    Record({ .Type = RecordedCommand::Kind::Viewport, .Viewport = viewport });
+}
 
 void Graphics::None::BindDescriptorSet(const GPUDescriptorSet& descriptorSet) noexcept {}
+void Graphics::None::BindUniformBufferRange(unsigned binding, const GPUBuffer& buffer, size_t offsetBytes, size_t sizeBytes) noexcept {}
+size_t Graphics::None::UniformBufferOffsetAlignment() noexcept { return 256; }
+
+GPUFence Graphics::None::InsertFence() noexcept { return {}; }
+bool Graphics::None::WaitFence(const GPUFence& fence, uint64_t timeoutNanoseconds) noexcept { return true; }
 
 std::pair<std::optional<GPUBuffer>, std::vector<BufferAllocatorMessage>> Graphics::None::Build(GPUBufferBuilder& builder) noexcept {
-    return { {{}}, { "You're using no-op graphics backend.", "This object will not function as desired." } };
+    std::optional<GPUBuffer> gpuBuffer{ std::nullopt };
+    gpuBuffer.emplace();
+    gpuBuffer->Properties = builder.properties;
+    gpuBuffer->SizeBytes = builder.size;
+    // Mapped buffers get plain memory, so code streaming through a mapping runs unchanged without a GPU.
+    if (gpuBuffer->IsPersistent() && (gpuBuffer->IsReadableFromCPU() || gpuBuffer->IsWriteableFromCPU())) {
+        gpuBuffer->MappedData = new (std::nothrow) std::byte[builder.size]{};
+    }
+    std::vector<BufferAllocatorMessage> messages{ "You're using no-op graphics backend.", "This object will not function as desired." };
+    return { std::move(gpuBuffer), std::move(messages) };
 }
 std::pair<std::optional<GPUDescriptorSet>, std::vector<DescriptorSetAllocatorMessage>> Graphics::None::Build(GPUDescriptorSetBuilder& builder) noexcept {
     return { {{}}, { "You're using no-op graphics backend.", "This object will not function as desired." } };
 }
 std::pair<std::optional<GPURenderBuffer>, std::vector<RenderBufferAllocatorMessage>> Graphics::None::Build(GPURenderBufferBuilder& builder) noexcept {
-    return { {{}}, { "You're using no-op graphics backend.", "This object will not function as desired." } };
+    std::optional<GPURenderBuffer> gpuRenderBuffer{ std::nullopt };
+    gpuRenderBuffer.emplace();
+    gpuRenderBuffer->Width = builder.width;
+    gpuRenderBuffer->Height = builder.height;
+    gpuRenderBuffer->Format = builder.format;
+    gpuRenderBuffer->Samples = builder.samples;
+    std::vector<RenderBufferAllocatorMessage> messages{ "You're using no-op graphics backend.", "This object will not function as desired." };
+    return { std::move(gpuRenderBuffer), std::move(messages) };
 }
 std::pair<std::optional<GPUFrameBuffer>, std::vector<FrameBufferAllocatorMessage>> Graphics::None::Build(GPUFrameBufferBuilder& builder) noexcept {
-    return { {{}}, { "You're using no-op graphics backend.", "This object will not function as desired." } };
+    std::optional<GPUFrameBuffer> gpuFrameBuffer{ std::nullopt };
+    gpuFrameBuffer.emplace();
+    gpuFrameBuffer->ColorAttachments = std::move(builder.colorAttachments);
+    gpuFrameBuffer->DepthAttachment = std::move(builder.depthAttachment);
+    gpuFrameBuffer->StencilAttachment = std::move(builder.stencilAttachment);
+    gpuFrameBuffer->DepthStencilAttachment = std::move(builder.depthStencilAttachment);
+    std::vector<FrameBufferAllocatorMessage> messages{ "You're using no-op graphics backend.", "This object will not function as desired." };
+    return { std::move(gpuFrameBuffer), std::move(messages) };
 }
 std::pair<std::optional<GPUPipeline>, std::vector<PipelineAllocatorMessage>> Graphics::None::Build(GPUPipelineBuilder& builder) noexcept {
-    return { {{}}, { "You're using no-op graphics backend.", "This object will not function as desired." } };
+    // The state is kept, front end checks such as the indirect argument layout read it.
+    std::optional<GPUPipeline> gpuPipeline{ std::nullopt };
+    gpuPipeline.emplace();
+#ifdef DEBUG
+    gpuPipeline->Name = std::move(builder.name);
+#endif
+    gpuPipeline->VertexBuffers = std::move(builder.vertexBuffers);
+    gpuPipeline->VertexLayouts = std::move(builder.vertexLayouts);
+    gpuPipeline->IndexBuffer = builder.indexBuffer;
+    gpuPipeline->IndexType = builder.indexType;
+    gpuPipeline->Topology = builder.topology;
+    gpuPipeline->IsFaceCullingEnabled = builder.isFaceCullingEnabled;
+    gpuPipeline->Cull = builder.cullMode;
+    gpuPipeline->Polygon = builder.polygonMode;
+    gpuPipeline->IsScissorEnabled = builder.isScissorEnabled;
+    gpuPipeline->Scissor = builder.scissor;
+    gpuPipeline->IsDepthTestEnabled = builder.isDepthTestEnabled;
+    gpuPipeline->IsDepthWriteEnabled = builder.isDepthWriteEnabled;
+    gpuPipeline->DepthFunc = builder.depthFunction;
+    gpuPipeline->IsDepthClampEnabled = builder.isDepthClampEnabled;
+    gpuPipeline->IsMultisampleEnabled = builder.isMultisampleEnabled;
+    gpuPipeline->IsBlendEnabled = builder.isBlendEnabled;
+    gpuPipeline->SourceFactor = builder.srcRGBFactor;
+    gpuPipeline->DestinationFactor = builder.dstRGBFactor;
+    gpuPipeline->SourceAlphaFactor = builder.srcAlphaFactor;
+    gpuPipeline->DestinationAlphaFactor = builder.dstAlphaFactor;
+    gpuPipeline->ShaderProgram = builder.shaderProgam;
+    std::vector<PipelineAllocatorMessage> messages{ "You're using no-op graphics backend.", "This object will not function as desired." };
+    return { std::move(gpuPipeline), std::move(messages) };
 }
 std::pair<std::optional<GPUShader>, std::vector<ShaderCompilerMessage>> Graphics::None::Build(GPUShaderBuilder& builder) noexcept {
     return { {{}}, {{ 0, ShaderCompilerMessage::Type::Info, "You're using no-op graphics backend.", }, { 0, ShaderCompilerMessage::Type::Info, "This object will not function as desired.", }}};
@@ -66,10 +161,23 @@ std::pair<std::optional<GPUSampler>, std::vector<SamplerAllocatorMessage>> Graph
     return { {{}}, { "You're using no-op graphics backend.", "This object will not function as desired." } };
 }
 std::pair<std::optional<GPUTexture>, std::vector<TextureAllocatorMessage>> Graphics::None::Build(GPUTextureBuilder& builder) noexcept {
-    return { {{}}, { "You're using no-op graphics backend.", "This object will not function as desired." } };
+    // Dimensions are kept so memory accounting behaves the same as on a real backend.
+    std::optional<GPUTexture> gpuTexture{ std::nullopt };
+    gpuTexture.emplace();
+    gpuTexture->Width = builder.width;
+    gpuTexture->Height = builder.height;
+    gpuTexture->Depth = builder.depth;
+    gpuTexture->Format = builder.format;
+    gpuTexture->Samples = builder.samples;
+    std::vector<TextureAllocatorMessage> messages{ "You're using no-op graphics backend.", "This object will not function as desired." };
+    return { std::move(gpuTexture), std::move(messages) };
 }
 
-void Graphics::None::Destruct(GPUBuffer& buffer) noexcept {}
+void Graphics::None::Destruct(GPUBuffer& buffer) noexcept {
+    if (buffer.GLObjectID == 0) {
+        delete[] static_cast<std::byte*>(buffer.MappedData);
+    }
+}
 void Graphics::None::Destruct(GPUDescriptorSet& set) noexcept {}
 void Graphics::None::Destruct(GPURenderBuffer& renderbuffer) noexcept {}
 void Graphics::None::Destruct(GPUFrameBuffer& framebuffer) noexcept {}
@@ -78,6 +186,7 @@ void Graphics::None::Destruct(GPUShader& shader) noexcept {}
 void Graphics::None::Destruct(GPUShaderProgram& program) noexcept {}
 void Graphics::None::Destruct(GPUSampler& sampler) noexcept {}
 void Graphics::None::Destruct(GPUTexture& texture) noexcept {}
+void Graphics::None::Destruct(GPUFence& fence) noexcept {}
 
 #ifdef _MSC_VER
 #pragma warning(default : 4100) // re-enable warning C4100
@@ -1 +1,36 @@
-#pragma once
\ No newline at end of file
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+#include <Engine/Region.hpp>
+#include <Engine/Graphics.hpp>
+
+namespace Graphics::None {
+    /* The no-op backend draws nothing, but while recording is on it keeps the compute and indirect work and the
+    viewports it is given, so headless code can check what it would have submitted. Off by default, nothing
+    accumulates then. */
+    struct RecordedCommand {
+        enum class Kind {
+            RenderIndirect,
+            RenderMultiIndirect,
+            Dispatch,
+            DispatchIndirect,
+            Barrier,
+            Viewport
+        };
+
+        Kind Type{};
+        const GPUBuffer* Arguments{ nullptr };
+        size_t OffsetBytes{ 0 };
+        int DrawCount{ 0 };
+        size_t StrideBytes{ 0 };
+        unsigned GroupsX{ 0 }, GroupsY{ 0 }, GroupsZ{ 0 };
+        BarrierBits Barriers{};
+        Region Viewport{};
+    };
+
+    void SetCommandRecording(bool enabled) noexcept;
+    const std::vector<RecordedCommand>& RecordedCommands() noexcept;
+    void ClearRecordedCommands() noexcept;
+}
@@ -0,0 +1,51 @@
+#include <Engine/Half.hpp>
+
+#include <bit>
+#include <cmath>
+
+Half Half::FromFloat(float value) noexcept {
+    const uint32_t bits{ std::bit_cast<uint32_t>(value) };
+    const uint32_t sign{ (bits >> 16) & 0x8000u };
+    const uint32_t exponent{ (bits >> 23) & 0xFFu };
+    uint32_t mantissa{ bits & 0x7FFFFFu };
+
+    if (exponent == 0xFFu) { // infinity stays infinity, nan stays (quiet) nan
+        return { static_cast<uint16_t>(sign | 0x7C00u | (mantissa != 0 ? 0x200u : 0u)) };
+    }
+    const int rebiased{ static_cast<int>(exponent) - 127 + 15 };
+    if (rebiased >= 0x1F) {
+        return { static_cast<uint16_t>(sign | 0x7C00u) };
+    }
+    if (rebiased <= 0) { // subnormal half, or zero
+        if (rebiased < -10) {
+            return { static_cast<uint16_t>(sign) };
+        }
+        mantissa |= 0x800000u;
+        const int shift{ 14 - rebiased };
+        uint32_t half{ mantissa >> shift };
+        const uint32_t remainder{ mantissa & ((1u << shift) - 1u) };
+        const uint32_t halfway{ 1u << (shift - 1) };
+        half += static_cast<uint32_t>(remainder > halfway || (remainder == halfway && (half & 1u)));
+        return { static_cast<uint16_t>(sign | half) };
+    }
+    uint32_t half{ (static_cast<uint32_t>(rebiased) << 10) | (mantissa >> 13) };
+    const uint32_t remainder{ mantissa & 0x1FFFu };
+    // a carry out of the mantissa bumps the exponent, which is exactly the rounded value (up to infinity)
+    half += static_cast<uint32_t>(remainder > 0x1000u || (remainder == 0x1000u && (half & 1u)));
+    return { static_cast<uint16_t>(sign | half) };
+}
+
+float Half::ToFloat() const noexcept {
+    const uint32_t sign{ static_cast<uint32_t>(Bits & 0x8000u) << 16 };
+    const uint32_t exponent{ (Bits >> 10) & 0x1Fu };
+    const uint32_t mantissa{ Bits & 0x3FFu };
+
+    if (exponent == 0x1Fu) {
+        return std::bit_cast<float>(sign | 0x7F800000u | (mantissa << 13));
+    }
+    if (exponent == 0) {
+        const float magnitude{ std::ldexp(static_cast<float>(mantissa), -24) };
+        return sign ? -magnitude : magnitude;
+    }
+    return std::bit_cast<float>(sign | ((exponent + 112u) << 23) | (mantissa << 13));
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+/* IEEE 754 binary16, storage only. Conversions round to nearest even, out of range values become infinity. */
+struct Half {
+    uint16_t Bits{};
+
+    static Half FromFloat(float value) noexcept;
+    float ToFloat() const noexcept;
+
+    bool operator==(const Half&) const noexcept = default;
+};
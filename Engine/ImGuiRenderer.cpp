@@ -1,11 +1,19 @@
 #include <Engine/ImGuiRenderer.hpp>
 
+#include <array>
+#include <format>
 #include <vector>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
 #include <utility>
 #include <algorithm>
+#include <filesystem>
 
 #include <imgui.h>
 #include <imgui_impl_glfw.h>
+#include <GLFW/glfw3.h>
 #ifdef SDL_SUPPORT
 #include <imgui_impl_sdl2.h>
 #endif
@@ -22,6 +30,7 @@
 #include <imgui_impl_dx11.h>
 #endif
 
+#include <Engine/Log.hpp>
 #include <Engine/Core.hpp>
 #include <Engine/Graphics.hpp>
 #include <Engine/WindowGLFW.hpp>
@@ -35,6 +44,352 @@ static IWindow* window;
 void (*ImGuiPlatformCreateWindow)(ImGuiViewport* vp);
 WindowIconPack ImGuiWindowIcons{};
 
+namespace {
+    /* The fonts of the editor and the launcher, in atlas order. Merged fonts add their glyphs to the font before them. */
+    struct FontSource {
+        const char* Path;
+        float Size;
+        bool Merge;
+        const ImWchar* Ranges;
+    };
+    constexpr ImWchar ICONS_RANGES[]{ ICON_MIN_FA, ICON_MAX_FA, 0 };
+    constexpr std::array<FontSource, 4> FONT_SOURCES{ {
+        { "Fonts/OpenSans-Regular.ttf",   18.0f, false, ICONS_RANGES_TURKISH },
+        { "Fonts/FA6/fa-regular-400.ttf", 16.0f, true,  ICONS_RANGES         },
+        { "Fonts/OpenSans-Bold.ttf",      18.0f, false, ICONS_RANGES_TURKISH },
+        { "Fonts/FA6/fa-solid-900.ttf",   16.0f, true,  ICONS_RANGES         },
+    } };
+    constexpr int DEFAULT_FONT{ 1 }; /* index into the atlas fonts, merged sources don't count */
+
+    /* Pixels per window coordinate, glyphs are rasterized this much denser so text stays sharp on high DPI screens. */
+    float FramebufferScale(IWindow& window) {
+        if (window.GetPlatformBackend() != WindowBackend::GLFW) { return 1.0f; }
+        GLFWwindow* glfwWindow = std::any_cast<GLFWwindow*>(window.GetPlatformWindowPointer());
+        int width{}, height{}, framebufferWidth{}, framebufferHeight{};
+        glfwGetWindowSize(glfwWindow, &width, &height);
+        glfwGetFramebufferSize(glfwWindow, &framebufferWidth, &framebufferHeight);
+        if (width <= 0 || framebufferWidth <= 0) { return 1.0f; }
+        return static_cast<float>(framebufferWidth) / static_cast<float>(width);
+    }
+
+#if IMGUI_VERSION_NUM < 19200
+    /* Rasterizing the fonts is most of ImGui's start up. The built atlas and glyph tables are cached on disk,
+    keyed by the font files, the sources above and the rasterizer density, and loaded straight into the atlas.
+    The cache fills in atlas internals that ImGui 1.92 replaced, from then on fonts are rasterized on demand and
+    always built the regular way. */
+    float fontDensity{ 0.0f }; /* the rasterizer density of the atlas in use */
+
+    constexpr const char* const FONT_CACHE_PATH{ "Cache" };
+    constexpr uint32_t FONT_CACHE_MAGIC{ 0x41464E44 }; /* "NDFA" */
+    constexpr uint32_t FONT_CACHE_VERSION{ 1 };
+
+    constexpr uint64_t FNV_OFFSET_BASIS{ 0xcbf29ce484222325ull };
+    constexpr uint64_t FNV_PRIME{ 0x100000001b3ull };
+    uint64_t HashBytes(uint64_t hash, const void* data, size_t size) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash ^= bytes[i];
+            hash *= FNV_PRIME;
+        }
+        return hash;
+    }
+
+    std::string ReadFile(const std::filesystem::path& path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) { return {}; }
+        std::stringstream ss;
+        ss << file.rdbuf();
+        return ss.str();
+    }
+
+    template<typename T>
+    void Write(std::ofstream& out, const T& value) { out.write(reinterpret_cast<const char*>(&value), sizeof(T)); }
+    template<typename T>
+    bool Read(std::ifstream& in, T& value) { return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T))); }
+
+    uint64_t HashFontSources(float density) {
+        uint64_t hash = FNV_OFFSET_BASIS;
+        const int imguiVersion = IMGUI_VERSION_NUM;
+        hash = HashBytes(hash, &FONT_CACHE_VERSION, sizeof(FONT_CACHE_VERSION));
+        hash = HashBytes(hash, &imguiVersion, sizeof(imguiVersion));
+        hash = HashBytes(hash, &density, sizeof(density));
+        for (const FontSource& source : FONT_SOURCES) {
+            std::string file = ReadFile(source.Path);
+            hash = HashBytes(hash, source.Path, std::strlen(source.Path) + 1);
+            hash = HashBytes(hash, file.data(), file.size());
+            hash = HashBytes(hash, &source.Size, sizeof(source.Size));
+            hash = HashBytes(hash, &source.Merge, sizeof(source.Merge));
+            for (const ImWchar* range = source.Ranges; *range != 0; range++) {
+                hash = HashBytes(hash, range, sizeof(ImWchar));
+            }
+        }
+        return hash;
+    }
+
+    struct CachedGlyph {
+        uint32_t Codepoint;
+        uint8_t Visible;
+        uint8_t Colored;
+        float AdvanceX;
+        float X0, Y0, X1, Y1;
+        float U0, V0, U1, V1;
+    };
+    struct CachedFont {
+        float FontSize;
+        float Ascent;
+        float Descent;
+        ImWchar FallbackChar;
+        ImWchar EllipsisChar;
+        int FirstConfig;
+        int ConfigCount;
+    };
+    struct CachedConfig {
+        char Name[40];
+        float SizePixels;
+        ImWchar EllipsisChar;
+        uint8_t MergeMode;
+        uint8_t PixelSnapH;
+        int DstFont;
+    };
+    struct CachedRect {
+        uint16_t X, Y, Width, Height;
+    };
+    struct CachedTexture {
+        int Width;
+        int Height;
+        ImVec2 UvScale;
+        ImVec2 UvWhitePixel;
+        ImVec4 UvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];
+        int PackIdMouseCursors;
+        int PackIdLines;
+    };
+
+    bool LoadFontAtlasFromCache(ImFontAtlas& atlas, const std::filesystem::path& cacheFile, uint64_t sourcesHash, float density) {
+        std::ifstream in(cacheFile, std::ios::binary);
+        if (!in) { return false; }
+
+        uint32_t magic{}, version{}, configCount{}, fontCount{}, rectCount{};
+        uint64_t hash{};
+        if (!Read(in, magic) || magic != FONT_CACHE_MAGIC) { return false; }
+        if (!Read(in, version) || version != FONT_CACHE_VERSION) { return false; }
+        if (!Read(in, hash) || hash != sourcesHash) { return false; }
+
+        CachedTexture texture{};
+        if (!Read(in, texture) || texture.Width <= 0 || texture.Height <= 0) { return false; }
+        std::vector<unsigned char> pixels(size_t(texture.Width) * texture.Height);
+        if (!in.read(reinterpret_cast<char*>(pixels.data()), pixels.size())) { return false; }
+
+        if (!Read(in, configCount) || configCount != FONT_SOURCES.size()) { return false; }
+        std::vector<CachedConfig> configs(configCount);
+        for (auto& config : configs) {
+            if (!Read(in, config)) { return false; }
+        }
+
+        if (!Read(in, fontCount)) { return false; }
+        std::vector<CachedFont> fonts(fontCount);
+        std::vector<std::vector<CachedGlyph>> glyphs(fontCount);
+        for (uint32_t i = 0; i < fontCount; i++) {
+            uint32_t glyphCount{};
+            if (!Read(in, fonts[i]) || !Read(in, glyphCount)) { return false; }
+            if (fonts[i].FirstConfig < 0 || fonts[i].ConfigCount <= 0 || size_t(fonts[i].FirstConfig) + fonts[i].ConfigCount > configCount) { return false; }
+            glyphs[i].resize(glyphCount);
+            if (!in.read(reinterpret_cast<char*>(glyphs[i].data()), glyphCount * sizeof(CachedGlyph))) { return false; }
+        }
+        for (const auto& config : configs) {
+            if (config.DstFont < 0 || uint32_t(config.DstFont) >= fontCount) { return false; }
+        }
+        if (fontCount <= DEFAULT_FONT) { return false; }
+
+        if (!Read(in, rectCount)) { return false; }
+        std::vector<CachedRect> rects(rectCount);
+        if (!in.read(reinterpret_cast<char*>(rects.data()), rectCount * sizeof(CachedRect))) { return false; }
+
+        /* Everything is read, nothing below can fail. Rebuild what ImFontAtlas::Build would have produced. */
+        atlas.Clear();
+        for (uint32_t i = 0; i < configCount; i++) {
+            ImFontConfig config;
+            config.FontData = nullptr;
+            config.FontDataOwnedByAtlas = false;
+            config.SizePixels = configs[i].SizePixels;
+            config.GlyphRanges = FONT_SOURCES[i].Ranges;
+            config.MergeMode = configs[i].MergeMode != 0;
+            config.PixelSnapH = configs[i].PixelSnapH != 0;
+            config.EllipsisChar = configs[i].EllipsisChar;
+            config.RasterizerDensity = density;
+            std::memcpy(config.Name, configs[i].Name, sizeof(config.Name));
+            config.Name[sizeof(config.Name) - 1] = '\0';
+            atlas.ConfigData.push_back(config);
+        }
+        for (uint32_t i = 0; i < fontCount; i++) {
+            ImFont* font = IM_NEW(ImFont);
+            atlas.Fonts.push_back(font);
+            font->FontSize = fonts[i].FontSize;
+            font->Ascent = fonts[i].Ascent;
+            font->Descent = fonts[i].Descent;
+            font->FallbackChar = fonts[i].FallbackChar;
+            font->EllipsisChar = fonts[i].EllipsisChar;
+            font->ContainerAtlas = &atlas;
+            font->ConfigData = &atlas.ConfigData[fonts[i].FirstConfig];
+            font->ConfigDataCount = static_cast<short>(fonts[i].ConfigCount);
+            font->Glyphs.reserve(static_cast<int>(glyphs[i].size()));
+            for (const CachedGlyph& cached : glyphs[i]) {
+                ImFontGlyph glyph{};
+                glyph.Codepoint = cached.Codepoint;
+                glyph.Visible = cached.Visible;
+                glyph.Colored = cached.Colored;
+                glyph.AdvanceX = cached.AdvanceX;
+                glyph.X0 = cached.X0; glyph.Y0 = cached.Y0; glyph.X1 = cached.X1; glyph.Y1 = cached.Y1;
+                glyph.U0 = cached.U0; glyph.V0 = cached.V0; glyph.U1 = cached.U1; glyph.V1 = cached.V1;
+                font->Glyphs.push_back(glyph);
+            }
+        }
+        for (uint32_t i = 0; i < configCount; i++) {
+            atlas.ConfigData[i].DstFont = atlas.Fonts[configs[i].DstFont];
+        }
+        atlas.CustomRects.resize(static_cast<int>(rectCount));
+        for (uint32_t i = 0; i < rectCount; i++) {
+            atlas.CustomRects[i] = ImFontAtlasCustomRect{};
+            atlas.CustomRects[i].X = rects[i].X;
+            atlas.CustomRects[i].Y = rects[i].Y;
+            atlas.CustomRects[i].Width = rects[i].Width;
+            atlas.CustomRects[i].Height = rects[i].Height;
+        }
+        atlas.PackIdMouseCursors = texture.PackIdMouseCursors;
+        atlas.PackIdLines = texture.PackIdLines;
+
+        atlas.TexWidth = texture.Width;
+        atlas.TexHeight = texture.Height;
+        atlas.TexUvScale = texture.UvScale;
+        atlas.TexUvWhitePixel = texture.UvWhitePixel;
+        std::memcpy(atlas.TexUvLines, texture.UvLines, sizeof(atlas.TexUvLines));
+        atlas.TexPixelsAlpha8 = static_cast<unsigned char*>(IM_ALLOC(pixels.size()));
+        std::memcpy(atlas.TexPixelsAlpha8, pixels.data(), pixels.size());
+
+        for (ImFont* font : atlas.Fonts) {
+            font->BuildLookupTable();
+        }
+        atlas.TexReady = true;
+        return true;
+    }
+
+    void SaveFontAtlasToCache(ImFontAtlas& atlas, const std::filesystem::path& cacheFile, uint64_t sourcesHash) {
+        unsigned char* pixels{ nullptr };
+        int width{}, height{};
+        atlas.GetTexDataAsAlpha8(&pixels, &width, &height);
+        if (pixels == nullptr) { return; }
+
+        std::error_code ec;
+        std::filesystem::create_directories(cacheFile.parent_path(), ec);
+        std::ofstream out(cacheFile, std::ios::binary | std::ios::trunc);
+        if (ec || !out) {
+            DOA_LOG_WARNING("Could not write font atlas cache: %s", cacheFile.string().c_str());
+            return;
+        }
+
+        Write(out, FONT_CACHE_MAGIC);
+        Write(out, FONT_CACHE_VERSION);
+        Write(out, sourcesHash);
+
+        CachedTexture texture{};
+        texture.Width = width;
+        texture.Height = height;
+        texture.UvScale = atlas.TexUvScale;
+        texture.UvWhitePixel = atlas.TexUvWhitePixel;
+        std::memcpy(texture.UvLines, atlas.TexUvLines, sizeof(texture.UvLines));
+        texture.PackIdMouseCursors = atlas.PackIdMouseCursors;
+        texture.PackIdLines = atlas.PackIdLines;
+        Write(out, texture);
+        out.write(reinterpret_cast<const char*>(pixels), std::streamsize(width) * height);
+
+        auto fontIndex = [&atlas](ImFont* font) { return static_cast<int>(atlas.Fonts.index_from_ptr(atlas.Fonts.find(font))); };
+        Write(out, static_cast<uint32_t>(atlas.ConfigData.Size));
+        for (const ImFontConfig& config : atlas.ConfigData) {
+            CachedConfig cached{};
+            std::memcpy(cached.Name, config.Name, sizeof(cached.Name));
+            cached.SizePixels = config.SizePixels;
+            cached.EllipsisChar = config.EllipsisChar;
+            cached.MergeMode = config.MergeMode;
+            cached.PixelSnapH = config.PixelSnapH;
+            cached.DstFont = fontIndex(config.DstFont);
+            Write(out, cached);
+        }
+
+        Write(out, static_cast<uint32_t>(atlas.Fonts.Size));
+        for (const ImFont* font : atlas.Fonts) {
+            Write(out, CachedFont{
+                .FontSize = font->FontSize,
+                .Ascent = font->Ascent,
+                .Descent = font->Descent,
+                .FallbackChar = font->FallbackChar,
+                .EllipsisChar = font->EllipsisChar,
+                .FirstConfig = static_cast<int>(font->ConfigData - atlas.ConfigData.Data),
+                .ConfigCount = font->ConfigDataCount
+            });
+            Write(out, static_cast<uint32_t>(font->Glyphs.Size));
+            for (const ImFontGlyph& glyph : font->Glyphs) {
+                Write(out, CachedGlyph{
+                    .Codepoint = glyph.Codepoint,
+                    .Visible = static_cast<uint8_t>(glyph.Visible),
+                    .Colored = static_cast<uint8_t>(glyph.Colored),
+                    .AdvanceX = glyph.AdvanceX,
+                    .X0 = glyph.X0, .Y0 = glyph.Y0, .X1 = glyph.X1, .Y1 = glyph.Y1,
+                    .U0 = glyph.U0, .V0 = glyph.V0, .U1 = glyph.U1, .V1 = glyph.V1
+                });
+            }
+        }
+
+        Write(out, static_cast<uint32_t>(atlas.CustomRects.Size));
+        for (const ImFontAtlasCustomRect& rect : atlas.CustomRects) {
+            Write(out, CachedRect{ rect.X, rect.Y, rect.Width, rect.Height });
+        }
+    }
+
+#endif
+
+    void AddFonts(ImGuiIO& io, float density) {
+        io.Fonts->Clear();
+        for (const FontSource& source : FONT_SOURCES) {
+            ImFontConfig config;
+            config.MergeMode = source.Merge;
+            config.PixelSnapH = source.Merge;
+            config.RasterizerDensity = density;
+            io.Fonts->AddFontFromFileTTF(source.Path, source.Size, &config, source.Ranges);
+        }
+    }
+
+    void LoadFonts(ImGuiIO& io, float density) {
+#if IMGUI_VERSION_NUM < 19200
+        fontDensity = density;
+        const uint64_t sourcesHash = HashFontSources(density);
+        const std::filesystem::path cacheFile = std::filesystem::path(FONT_CACHE_PATH) / std::format("imgui_fonts_{:016x}.bin", sourcesHash);
+        if (!LoadFontAtlasFromCache(*io.Fonts, cacheFile, sourcesHash, density)) {
+            AddFonts(io, density);
+            io.Fonts->Build();
+            SaveFontAtlasToCache(*io.Fonts, cacheFile, sourcesHash);
+        }
+#else
+        AddFonts(io, density);
+#endif
+        io.FontDefault = io.Fonts->Fonts[DEFAULT_FONT];
+    }
+
+#if IMGUI_VERSION_NUM < 19200
+    /* The atlas is rasterized for one density, moving the window to a screen of another rebuilds it (from the
+    cache if that density was seen before) and uploads it again. Called before the backends start a frame.
+    Only the OpenGL backend re-uploads for now, the others keep the density the window started on. */
+    void UpdateFontDensity(IWindow& window) {
+#if defined(OPENGL_4_6_SUPPORT) || defined(OPENGL_3_3_SUPPORT)
+        if (!window.IsOpenGLContextWindow()) { return; }
+        const float density = FramebufferScale(window);
+        if (density == fontDensity) { return; }
+        LoadFonts(ImGui::GetIO(), density);
+        ImGui_ImplOpenGL3_DestroyFontsTexture();
+        ImGui_ImplOpenGL3_CreateFontsTexture();
+#endif
+    }
+#endif
+}
+
 ImGuiContext* ImGuiInit(IWindow& window) {
     if (context != nullptr) { return context; }
 
@@ -53,17 +408,7 @@ ImGuiContext* ImGuiInit(IWindow& window) {
 
     io.ConfigWindowsMoveFromTitleBarOnly = true;
 
-    // merge in icons from Font Awesome
-    static const ImWchar icons_ranges[] = { ICON_MIN_FA, ICON_MAX_FA, 0 };
-    ImFontConfig icons_config;
-    icons_config.MergeMode = true;
-    icons_config.PixelSnapH = true;
-
-    io.Fonts->AddFontFromFileTTF("Fonts/OpenSans-Regular.ttf", 18.0f, nullptr, ICONS_RANGES_TURKISH);
-    io.Fonts->AddFontFromFileTTF("Fonts/FA6/fa-regular-400.ttf", 16.0f, &icons_config, icons_ranges);
-    io.FontDefault = io.Fonts->AddFontFromFileTTF("Fonts/OpenSans-Bold.ttf", 18.0f, nullptr, ICONS_RANGES_TURKISH);
-    io.Fonts->AddFontFromFileTTF("Fonts/FA6/fa-solid-900.ttf", 16.0f, &icons_config, icons_ranges);
-
+    LoadFonts(io, FramebufferScale(window));
 
     switch (window.GetPlatformBackend()) {
     using enum WindowBackend;
@@ -204,6 +549,9 @@ void ImGuiSetUpWindowIcons(WindowIconPack icons) {
 }
 
 void ImGuiRender(float delta) {
+#if IMGUI_VERSION_NUM < 19200
+    UpdateFontDensity(*window);
+#endif
     if (window->IsSoftwareRendererContextWindow()) {
         // TODO implement for software
         assert(false);
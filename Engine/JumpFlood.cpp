@@ -0,0 +1,126 @@
+#include <Engine/JumpFlood.hpp>
+
+#include <bit>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <algorithm>
+
+#include <Engine/Region.hpp>
+#include <Engine/Graphics.hpp>
+#include <Engine/GPUFrameBuffer.hpp>
+#include <Engine/GPURenderTargetPool.hpp>
+
+namespace {
+    const GPURenderTargetPool::Description SEED_TARGET{ .ColorFormat = DataFormat::RG32F, .SampledColor = true };
+
+    /* Shared by the passes of one AddPasses call, they execute after it returns. */
+    struct FloodState {
+        JumpFlood::Draws Draws{};
+        std::vector<unsigned> Steps{};
+        std::vector<RenderGraph::Resource> Seeds{};
+    };
+
+    void BindTarget(GPUFrameBuffer& frameBuffer, Resolution size) noexcept {
+        std::array<unsigned, 1> colorAttachment{ 0 };
+        Graphics::SetRenderTarget(frameBuffer, colorAttachment);
+        Graphics::SetViewport({ 0, 0, size.Width, size.Height });
+    }
+}
+
+std::vector<unsigned> JumpFlood::FloodSteps(float width, Resolution size) noexcept {
+    /* Steps k, k/2, ..., 1 carry a seed up to 2k - 1 pixels, far enough for every pixel the outline covers. The
+    halving alone can settle a pixel on a farther seed when the nearer one only arrives through a pixel that had
+    already settled elsewhere, a step 2 and a step 1 pass more catch those. */
+    unsigned longest = std::max(size.Width, size.Height);
+    unsigned reach = static_cast<unsigned>(std::ceil(std::clamp(width, 0.0f, MAX_WIDTH) + 0.5f));
+    reach = std::min(reach, longest > 0 ? longest - 1 : 0);
+
+    std::vector<unsigned> steps;
+    if (reach == 0) { return steps; }
+    for (unsigned step = std::bit_ceil((reach + 2) / 2); step > 0; step /= 2) {
+        steps.push_back(step);
+    }
+    if (steps.front() > 1) {
+        steps.push_back(2);
+        steps.push_back(1);
+    }
+    return steps;
+}
+std::vector<glm::vec2> JumpFlood::Seed(std::span<const uint8_t> mask, Resolution size) {
+    std::vector<glm::vec2> seeds(size_t{ size.Width } * size.Height, glm::vec2{ NO_SEED });
+    for (unsigned y = 0; y < size.Height; y++) {
+        for (unsigned x = 0; x < size.Width; x++) {
+            size_t i = size_t{ y } * size.Width + x;
+            if (mask[i] != 0) { seeds[i] = { static_cast<float>(x), static_cast<float>(y) }; }
+        }
+    }
+    return seeds;
+}
+void JumpFlood::Flood(std::span<const glm::vec2> source, std::span<glm::vec2> destination, Resolution size, unsigned step) noexcept {
+    const int width = static_cast<int>(size.Width);
+    const int height = static_cast<int>(size.Height);
+    const int stride = static_cast<int>(step);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            glm::vec2 best{ NO_SEED };
+            float bestDistance = std::numeric_limits<float>::max();
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    int nx = x + dx * stride;
+                    int ny = y + dy * stride;
+                    if (nx < 0 || ny < 0 || nx >= width || ny >= height) { continue; }
+                    glm::vec2 candidate = source[static_cast<size_t>(ny) * width + nx];
+                    if (candidate.x < 0.0f) { continue; }
+                    glm::vec2 offset = candidate - glm::vec2(x, y);
+                    float candidateDistance = glm::dot(offset, offset);
+                    if (candidateDistance < bestDistance) {
+                        best = candidate;
+                        bestDistance = candidateDistance;
+                    }
+                }
+            }
+            destination[static_cast<size_t>(y) * width + x] = best;
+        }
+    }
+}
+float JumpFlood::Coverage(glm::vec2 seed, glm::ivec2 pixel, float width) noexcept {
+    if (seed.x < 0.0f) { return 0.0f; }
+    float nearestDistance = glm::length(seed - glm::vec2(pixel));
+    if (nearestDistance < 0.5f) { return 0.0f; }
+    return std::clamp(std::clamp(width, 0.0f, MAX_WIDTH) + 0.5f - nearestDistance, 0.0f, 1.0f);
+}
+
+void JumpFlood::AddPasses(RenderGraph& graph, RenderGraph::Resource target, Resolution size, float width, Draws draws) {
+    if (size.Width == 0 || size.Height == 0) { return; }
+    auto state = std::make_shared<FloodState>(std::move(draws), FloodSteps(width, size));
+
+    graph.AddPass("Outline Mask", [&](RenderGraph::PassBuilder& builder) {
+        state->Seeds.push_back(builder.Write(builder.Create("Outline Seeds", SEED_TARGET, size)));
+    }, [state, size](RenderGraph::PassContext& context) {
+        GPUFrameBuffer& frameBuffer = context.FrameBuffer(state->Seeds.front());
+        BindTarget(frameBuffer, size);
+        Graphics::ClearRenderTargetColor(frameBuffer, { NO_SEED, NO_SEED, 0.0f, 0.0f });
+        state->Draws.Mask();
+    });
+
+    for (size_t i = 0; i < state->Steps.size(); i++) {
+        graph.AddPass("Outline Flood", [&](RenderGraph::PassBuilder& builder) {
+            builder.Read(state->Seeds.back());
+            state->Seeds.push_back(builder.Write(builder.Create("Outline Seeds", SEED_TARGET, size)));
+        }, [state, i, size](RenderGraph::PassContext& context) {
+            BindTarget(context.FrameBuffer(state->Seeds[i + 1]), size);
+            state->Draws.Flood(context.Texture(state->Seeds[i]), context.Size(state->Seeds[i]), state->Steps[i]);
+        });
+    }
+
+    graph.AddPass("Outline Composite", [&](RenderGraph::PassBuilder& builder) {
+        builder.Read(state->Seeds.back());
+        builder.Write(target);
+    }, [state, target, size](RenderGraph::PassContext& context) {
+        BindTarget(context.FrameBuffer(target), size);
+        state->Draws.Composite(context.Texture(state->Seeds.back()), context.Size(state->Seeds.back()));
+        Graphics::SetRenderTarget({});
+    });
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <span>
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+#include <glm/glm.hpp>
+
+#include <Engine/Resolution.hpp>
+#include <Engine/GPUTexture.hpp>
+#include <Engine/RenderGraph.hpp>
+
+/* Screen-space outlines with a jump flood, at a cost independent of how many objects are outlined.
+The mask pass rasterizes the objects into a seed target holding, for every covered pixel, its own coordinates
+and NO_SEED elsewhere. Every flood pass lets each pixel take the nearest seed among its 3x3 neighbours step
+pixels away, the step halving from pass to pass down to 1, after which each pixel within reach of the objects
+knows its nearest covered pixel, two passes more with steps 2 and 1 correcting the few pixels the halving got
+wrong. The flood only has to reach the outline width, so it takes about log2(width) + 2 passes and never more
+than log2 of the target width + 2. The composite pass blends the outline over the target
+wherever the nearest seed is within the width, leaving covered pixels alone.
+Seed, Flood and Coverage run the same passes on the CPU, pixel for pixel what the shaders compute, for backends
+that cannot run the passes and to check the shaders against. */
+namespace JumpFlood {
+
+    constexpr float MAX_WIDTH{ 64.0f };
+    constexpr float NO_SEED{ -1.0f };
+
+    /* Step of every flood pass, halving from the largest down to 1, then 2 and 1 again. */
+    std::vector<unsigned> FloodSteps(float width, Resolution size) noexcept;
+    /* The mask pass: seeds of the covered (non-zero) pixels of a row-major mask. */
+    std::vector<glm::vec2> Seed(std::span<const uint8_t> mask, Resolution size);
+    /* One flood pass from source into destination, both row-major seeds of size. */
+    void Flood(std::span<const glm::vec2> source, std::span<glm::vec2> destination, Resolution size, unsigned step) noexcept;
+    /* The composite pass: opacity of the outline at pixel, given the seed the flood left there. */
+    float Coverage(glm::vec2 seed, glm::ivec2 pixel, float width) noexcept;
+
+    /* What the passes draw. Each is called with its render target bound and the viewport set to the outlined
+    size, the mask target is cleared to NO_SEED beforehand. */
+    struct Draws {
+        std::function<void()> Mask{};
+        std::function<void(const GPUTexture& seeds, Resolution size, unsigned step)> Flood{};
+        std::function<void(const GPUTexture& seeds, Resolution size)> Composite{};
+    };
+
+    /* Adds the mask, flood and composite passes outlining into the size sized corner of target. The passes are
+    the same however many objects Mask draws, FloodSteps(width, size) flood passes between the other two. */
+    void AddPasses(RenderGraph& graph, RenderGraph::Resource target, Resolution size, float width, Draws draws);
+}
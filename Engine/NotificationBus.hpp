@@ -0,0 +1,120 @@
+#pragma once
+
+#include <tuple>
+#include <vector>
+#include <utility>
+#include <functional>
+
+#include <eventpp/callbacklist.h>
+
+/* Typed notifications, without RTTI. Every event type has its own listener list, so an event only reaches the
+listeners of its type and a listener receives the event struct itself, there is no source to cast nor message to
+compare. Publish delivers immediately. Enqueue defers delivery until Flush, which delivers queued events type by
+type (in the order of Events) and in queueing order within a type. Queues keep their capacity, once warmed up
+neither Publish nor Enqueue/Flush allocate. Single threaded, listeners and events belong to the main thread. */
+template<typename... Events>
+struct NotificationBus {
+
+    struct Policies {
+        using Threading = eventpp::SingleThreading;
+    };
+    template<typename E>
+    using ListenerList = eventpp::CallbackList<void(const E&), Policies>;
+    template<typename E>
+    using Listener = std::function<void(const E&)>;
+    template<typename E>
+    using Handle = typename ListenerList<E>::Handle;
+
+    NotificationBus() noexcept = default;
+    ~NotificationBus() noexcept = default;
+    NotificationBus(const NotificationBus&) = delete;
+    NotificationBus(NotificationBus&& other) noexcept;
+    NotificationBus& operator=(const NotificationBus&) = delete;
+    NotificationBus& operator=(NotificationBus&& other) noexcept;
+
+    template<typename E>
+    Handle<E> Subscribe(Listener<E> listener);
+    template<typename E>
+    bool Unsubscribe(const Handle<E>& handle);
+    template<typename E>
+    bool HasListeners() const noexcept;
+
+    template<typename E>
+    void Publish(const E& event) const;
+    template<typename E>
+    void Enqueue(E&& event);
+    template<typename E>
+    bool IsQueued() const noexcept;
+    void Flush();
+
+private:
+    template<typename E>
+    struct Queue {
+        std::vector<E> Pending{};
+        std::vector<E> InFlight{};
+    };
+
+    mutable std::tuple<ListenerList<Events>...> listeners{};
+    std::tuple<Queue<Events>...> queues{};
+
+    template<typename E>
+    void FlushQueue();
+};
+
+template<typename... Events>
+NotificationBus<Events...>::NotificationBus(NotificationBus&& other) noexcept :
+    listeners(std::exchange(other.listeners, {})),
+    queues(std::exchange(other.queues, {})) {}
+template<typename... Events>
+NotificationBus<Events...>& NotificationBus<Events...>::operator=(NotificationBus&& other) noexcept {
+    listeners = std::exchange(other.listeners, {});
+    queues = std::exchange(other.queues, {});
+    return *this;
+}
+
+template<typename... Events>
+template<typename E>
+typename NotificationBus<Events...>::template Handle<E> NotificationBus<Events...>::Subscribe(Listener<E> listener) {
+    return std::get<ListenerList<E>>(listeners).append(std::move(listener));
+}
+template<typename... Events>
+template<typename E>
+bool NotificationBus<Events...>::Unsubscribe(const Handle<E>& handle) {
+    return std::get<ListenerList<E>>(listeners).remove(handle);
+}
+template<typename... Events>
+template<typename E>
+bool NotificationBus<Events...>::HasListeners() const noexcept {
+    return !std::get<ListenerList<E>>(listeners).empty();
+}
+
+template<typename... Events>
+template<typename E>
+void NotificationBus<Events...>::Publish(const E& event) const {
+    std::get<ListenerList<E>>(listeners)(event);
+}
+template<typename... Events>
+template<typename E>
+void NotificationBus<Events...>::Enqueue(E&& event) {
+    std::get<Queue<std::remove_cvref_t<E>>>(queues).Pending.push_back(std::forward<E>(event));
+}
+template<typename... Events>
+template<typename E>
+bool NotificationBus<Events...>::IsQueued() const noexcept {
+    return !std::get<Queue<E>>(queues).Pending.empty();
+}
+template<typename... Events>
+void NotificationBus<Events...>::Flush() {
+    (FlushQueue<Events>(), ...);
+}
+template<typename... Events>
+template<typename E>
+void NotificationBus<Events...>::FlushQueue() {
+    // Events enqueued by listeners during the flush are delivered by the next flush.
+    Queue<E>& queue = std::get<Queue<E>>(queues);
+    std::swap(queue.Pending, queue.InFlight);
+    for (const E& event : queue.InFlight) {
+        Publish(event);
+    }
+    queue.InFlight.clear();
+}
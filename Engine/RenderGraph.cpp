@@ -0,0 +1,265 @@
+#include <Engine/RenderGraph.hpp>
+
+#include <array>
+#include <cassert>
+#include <utility>
+#include <algorithm>
+
+#include <Engine/Graphics.hpp>
+
+static bool IsWrite(RenderGraph::Access access) noexcept {
+    return access == RenderGraph::Access::RenderTarget || access == RenderGraph::Access::CopyDestination;
+}
+
+RenderGraph::PassBuilder::PassBuilder(RenderGraph& graph, uint32_t pass) noexcept :
+    graph(graph),
+    pass(pass) {}
+
+RenderGraph::Resource RenderGraph::PassBuilder::Create(std::string_view name, const GPURenderTargetPool::Description& description, Resolution size) noexcept {
+    return { graph.AddResource({
+        .Name = std::string(name),
+        .Description = description,
+        .Size = size,
+        .Extent = GPURenderTargetPool::BucketOf(size)
+    }) };
+}
+RenderGraph::Resource RenderGraph::PassBuilder::Read(Resource resource) noexcept {
+    assert(resource.Index < graph.resources.size());
+    graph.passes[pass].Accesses.emplace_back(resource.Index, Access::Sampled);
+    return resource;
+}
+RenderGraph::Resource RenderGraph::PassBuilder::Write(Resource resource) noexcept {
+    assert(resource.Index < graph.resources.size());
+    graph.passes[pass].Accesses.emplace_back(resource.Index, Access::RenderTarget);
+    return resource;
+}
+void RenderGraph::PassBuilder::HasSideEffects() noexcept {
+    graph.passes[pass].SideEffects = true;
+}
+
+RenderGraph::PassContext::PassContext(RenderGraph& graph) noexcept :
+    graph(graph) {}
+
+GPUFrameBuffer& RenderGraph::PassContext::FrameBuffer(Resource resource) noexcept {
+    assert(resource.Index < graph.resources.size());
+    return graph.FrameBufferOf(resource.Index);
+}
+const GPUTexture& RenderGraph::PassContext::Texture(Resource resource) noexcept {
+    assert(resource.Index < graph.resources.size());
+    const ResourceNode& node = graph.resources[resource.Index];
+    const GPUFrameBuffer& frameBuffer = graph.FrameBufferOf(node.Resolved != NONE ? node.Resolved : resource.Index);
+    assert(frameBuffer.ColorAttachments[0].has_value());
+    assert(std::holds_alternative<GPUTexture>(frameBuffer.ColorAttachments[0].value())); // Sampled resources must have SampledColor!
+    return std::get<GPUTexture>(frameBuffer.ColorAttachments[0].value());
+}
+Resolution RenderGraph::PassContext::Size(Resource resource) const noexcept {
+    assert(resource.Index < graph.resources.size());
+    return graph.resources[resource.Index].Size;
+}
+
+RenderGraph::RenderGraph(GPURenderTargetPool& pool) noexcept :
+    pool(pool) {}
+
+RenderGraph::Resource RenderGraph::Import(std::string_view name, GPUFrameBuffer& frameBuffer, Resolution size) noexcept {
+    return { AddResource({
+        .Name = std::string(name),
+        .Size = size,
+        .Extent = size,
+        .Imported = &frameBuffer
+    }) };
+}
+void RenderGraph::AddPass(std::string_view name, const SetupFunction& setup, ExecuteFunction execute) {
+    compiled = false;
+    passes.push_back({ .Name = std::string(name), .Run = std::move(execute) });
+    PassBuilder builder{ *this, static_cast<uint32_t>(passes.size() - 1) };
+    setup(builder);
+}
+void RenderGraph::AddBlitPass(std::string_view name, Resource source, Resource destination) {
+    assert(source.Index < resources.size());
+    assert(destination.Index < resources.size());
+    compiled = false;
+    passes.push_back({
+        .Name = std::string(name),
+        .Accesses = { { source.Index, Access::CopySource }, { destination.Index, Access::CopyDestination } },
+        .Blit = true
+    });
+}
+
+void RenderGraph::Compile() {
+    statistics = { .Passes = passes.size() };
+    for (auto& resource : resources) {
+        resource.FirstUse = NONE;
+        resource.LastUse = NONE;
+        resource.Physical = NONE;
+    }
+
+    Cull();
+    ScheduleSteps();
+    Alias();
+
+    statistics.CulledPasses = static_cast<size_t>(std::ranges::count_if(passes, &PassNode::Culled));
+    compiled = true;
+}
+void RenderGraph::Execute() {
+    assert(compiled && "Did you forget to call RenderGraph::Compile()?");
+
+    for (auto& target : physicalTargets) {
+        target.FrameBuffer = pool.Acquire(target.Description, target.Extent, "Render Graph Target");
+    }
+
+    PassContext context{ *this };
+    std::array<unsigned, 1> colorAttachment{ 0 };
+    for (const Step& step : steps) {
+        switch (step.Type) {
+        case Step::Kind::Pass: {
+            PassNode& pass = passes[step.Index];
+            if (pass.Blit) {
+                Graphics::BlitColor(FrameBufferOf(pass.Accesses[0].first), FrameBufferOf(pass.Accesses[1].first), 0, colorAttachment);
+            } else if (pass.Run) {
+                pass.Run(context);
+            }
+            break;
+        }
+        case Step::Kind::Resolve:
+            Graphics::BlitColor(FrameBufferOf(step.Index), FrameBufferOf(resources[step.Index].Resolved), 0, colorAttachment);
+            break;
+        case Step::Kind::Barrier:
+            /* OpenGL orders render target writes and copies before later reads of the same target on its own,
+            there is nothing to issue. Backends with explicit synchronization consume these. */
+            break;
+        }
+    }
+
+    for (auto& target : physicalTargets) {
+        pool.Release(target.Description, target.Extent, std::move(target.FrameBuffer.value()));
+        target.FrameBuffer.reset();
+    }
+}
+void RenderGraph::Reset() noexcept {
+    resources.clear();
+    passes.clear();
+    steps.clear();
+    statistics = {};
+    compiled = false;
+}
+
+bool RenderGraph::IsCulled(std::string_view passName) const noexcept {
+    auto it = std::ranges::find(passes, passName, &PassNode::Name);
+    return it != passes.end() && it->Culled;
+}
+const RenderGraph::Statistics& RenderGraph::GetStatistics() const noexcept { return statistics; }
+
+uint32_t RenderGraph::AddResource(ResourceNode&& resource) noexcept {
+    resources.push_back(std::move(resource));
+    return static_cast<uint32_t>(resources.size() - 1);
+}
+
+void RenderGraph::Cull() noexcept {
+    /* Walk backwards from the outputs, a pass is kept if it writes something a kept pass (or the outside) reads. */
+    std::vector<bool> needed(resources.size(), false);
+    for (size_t i = 0; i < resources.size(); i++) {
+        needed[i] = resources[i].Imported != nullptr;
+    }
+    for (auto it = passes.rbegin(); it != passes.rend(); ++it) {
+        PassNode& pass = *it;
+        bool writesNeeded = std::ranges::any_of(pass.Accesses, [&needed](const auto& access) { return IsWrite(access.second) && needed[access.first]; });
+        pass.Culled = !pass.SideEffects && !writesNeeded;
+        if (pass.Culled) { continue; }
+        for (const auto& [resource, access] : pass.Accesses) {
+            if (!IsWrite(access)) { needed[resource] = true; }
+        }
+    }
+}
+
+void RenderGraph::ScheduleSteps() noexcept {
+    steps.clear();
+    std::vector<std::optional<Access>> states(resources.size());
+    std::vector<bool> resolvedIsCurrent(resources.size(), false);
+
+    for (uint32_t p = 0; p < passes.size(); p++) {
+        PassNode& pass = passes[p];
+        if (pass.Culled) { continue; }
+
+        for (const auto& [resource, access] : pass.Accesses) {
+            bool needsResolve = access == Access::Sampled && resources[resource].Description.Samples != Multisample::None && resources[resource].Imported == nullptr;
+            if (!needsResolve) {
+                Transition(states, resource, access);
+                Use(resource, p);
+                if (IsWrite(access)) { resolvedIsCurrent[resource] = false; }
+                continue;
+            }
+
+            if (resources[resource].Resolved == NONE) {
+                const ResourceNode& multisampled = resources[resource];
+                uint32_t resolved = AddResource({
+                    .Name = multisampled.Name + " (Resolved)",
+                    .Description = { .ColorFormat = multisampled.Description.ColorFormat, .SampledColor = true },
+                    .Size = multisampled.Size,
+                    .Extent = multisampled.Extent
+                });
+                resources[resource].Resolved = resolved;
+                states.resize(resources.size());
+                resolvedIsCurrent.resize(resources.size(), false);
+            }
+            uint32_t resolved = resources[resource].Resolved;
+            if (!resolvedIsCurrent[resource]) {
+                Transition(states, resource, Access::CopySource);
+                Transition(states, resolved, Access::CopyDestination);
+                steps.push_back({ .Type = Step::Kind::Resolve, .Index = resource });
+                statistics.Resolves++;
+                resolvedIsCurrent[resource] = true;
+                Use(resource, p);
+            }
+            Transition(states, resolved, Access::Sampled);
+            Use(resolved, p);
+        }
+        steps.push_back({ .Type = Step::Kind::Pass, .Index = p });
+    }
+}
+
+void RenderGraph::Alias() noexcept {
+    /* Greedy interval assignment: in order of first use, take a matching target whose last user already ran. */
+    std::vector<uint32_t> transients;
+    for (uint32_t i = 0; i < resources.size(); i++) {
+        if (resources[i].Imported == nullptr && resources[i].FirstUse != NONE) { transients.push_back(i); }
+    }
+    std::ranges::stable_sort(transients, {}, [this](uint32_t i) { return resources[i].FirstUse; });
+
+    physicalTargets.clear();
+    for (uint32_t i : transients) {
+        ResourceNode& resource = resources[i];
+        auto it = std::ranges::find_if(physicalTargets, [&resource](const PhysicalTarget& target) {
+            return target.Description == resource.Description && target.Extent == resource.Extent && target.LastUse < resource.FirstUse;
+        });
+        if (it == physicalTargets.end()) {
+            physicalTargets.push_back({ .Description = resource.Description, .Extent = resource.Extent });
+            it = physicalTargets.end() - 1;
+        }
+        it->LastUse = resource.LastUse;
+        resource.Physical = static_cast<uint32_t>(it - physicalTargets.begin());
+    }
+
+    statistics.TransientResources = transients.size();
+    statistics.PhysicalTargets = physicalTargets.size();
+}
+
+void RenderGraph::Transition(std::vector<std::optional<Access>>& states, uint32_t resource, Access access) noexcept {
+    std::optional<Access>& state = states[resource];
+    if (state.has_value() && state.value() != access) {
+        steps.push_back({ .Type = Step::Kind::Barrier, .Index = resource, .From = state.value(), .To = access });
+        statistics.Barriers++;
+    }
+    state = access;
+}
+void RenderGraph::Use(uint32_t resource, uint32_t position) noexcept {
+    ResourceNode& node = resources[resource];
+    node.FirstUse = std::min(node.FirstUse, position);
+    node.LastUse = node.LastUse == NONE ? position : std::max(node.LastUse, position);
+}
+
+GPUFrameBuffer& RenderGraph::FrameBufferOf(uint32_t resource) noexcept {
+    ResourceNode& node = resources[resource];
+    if (node.Imported != nullptr) { return *node.Imported; }
+    assert(node.Physical != NONE && physicalTargets[node.Physical].FrameBuffer.has_value());
+    return physicalTargets[node.Physical].FrameBuffer.value();
+}
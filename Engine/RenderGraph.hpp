@@ -0,0 +1,158 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <functional>
+#include <string_view>
+
+#include <Engine/Resolution.hpp>
+#include <Engine/GPUFrameBuffer.hpp>
+#include <Engine/GPURenderTargetPool.hpp>
+
+/* The passes of a frame and the render targets they use, rebuilt every frame.
+Passes are added in execution order and declare what they read and write. Compile culls passes whose results
+nobody reads, computes the lifetime of every transient target and aliases transients with disjoint lifetimes
+onto the same physical target, resolves multisampled targets before a pass samples them and records a barrier
+wherever a target changes usage. Execute acquires the physical targets from the pool, runs the steps and gives
+the targets back, so a steady frame allocates nothing. Imported targets are owned elsewhere and are the outputs
+of the graph, a pass that writes none of them and nothing read by another pass is culled unless it has side
+effects. Compile touches no graphics state, so graphs can be compiled and inspected headless. */
+struct RenderGraph {
+
+    struct Resource {
+        uint32_t Index{ UINT32_MAX };
+
+        bool IsValid() const noexcept { return Index != UINT32_MAX; }
+        bool operator==(const Resource&) const noexcept = default;
+    };
+
+    enum class Access {
+        RenderTarget,
+        Sampled,
+        CopySource,
+        CopyDestination
+    };
+
+    struct PassBuilder {
+        /* Declares a transient target, allocated in the bucket of size and rendered to in its sub-rectangle. */
+        Resource Create(std::string_view name, const GPURenderTargetPool::Description& description, Resolution size) noexcept;
+        Resource Read(Resource resource) noexcept;
+        Resource Write(Resource resource) noexcept;
+        void HasSideEffects() noexcept;
+
+    private:
+        RenderGraph& graph;
+        uint32_t pass;
+
+        PassBuilder(RenderGraph& graph, uint32_t pass) noexcept;
+
+        friend struct RenderGraph;
+    };
+
+    struct PassContext {
+        GPUFrameBuffer& FrameBuffer(Resource resource) noexcept;
+        /* The color of a sampled resource, resolved if the resource is multisampled. */
+        const GPUTexture& Texture(Resource resource) noexcept;
+        Resolution Size(Resource resource) const noexcept;
+
+    private:
+        RenderGraph& graph;
+
+        explicit PassContext(RenderGraph& graph) noexcept;
+
+        friend struct RenderGraph;
+    };
+
+    using SetupFunction = std::function<void(PassBuilder&)>;
+    using ExecuteFunction = std::function<void(PassContext&)>;
+
+    struct Statistics {
+        size_t Passes{ 0 };
+        size_t CulledPasses{ 0 };
+        size_t TransientResources{ 0 };
+        size_t PhysicalTargets{ 0 };
+        size_t Resolves{ 0 };
+        size_t Barriers{ 0 };
+    };
+
+    explicit RenderGraph(GPURenderTargetPool& pool) noexcept;
+    ~RenderGraph() noexcept = default;
+    RenderGraph(const RenderGraph&) = delete;
+    RenderGraph(RenderGraph&&) = delete;
+    RenderGraph& operator=(const RenderGraph&) = delete;
+    RenderGraph& operator=(RenderGraph&&) = delete;
+
+    Resource Import(std::string_view name, GPUFrameBuffer& frameBuffer, Resolution size) noexcept;
+    /* Runs setup immediately, so the resources it creates can be used by the passes added after it. */
+    void AddPass(std::string_view name, const SetupFunction& setup, ExecuteFunction execute);
+    /* Copies the color of source into destination, a multisampled source is resolved by the copy. */
+    void AddBlitPass(std::string_view name, Resource source, Resource destination);
+
+    void Compile();
+    void Execute();
+    /* Forgets every pass and resource, keeping the capacity for the next frame. */
+    void Reset() noexcept;
+
+    bool IsCulled(std::string_view passName) const noexcept;
+    const Statistics& GetStatistics() const noexcept;
+
+private:
+    static constexpr uint32_t NONE{ UINT32_MAX };
+
+    struct ResourceNode {
+        std::string Name{};
+        GPURenderTargetPool::Description Description{};
+        Resolution Size{};
+        Resolution Extent{};
+        GPUFrameBuffer* Imported{ nullptr };
+        uint32_t FirstUse{ NONE };
+        uint32_t LastUse{ NONE };
+        uint32_t Physical{ NONE };
+        uint32_t Resolved{ NONE }; /* the single sampled copy of a multisampled resource */
+    };
+    struct PassNode {
+        std::string Name{};
+        ExecuteFunction Run{};
+        std::vector<std::pair<uint32_t, Access>> Accesses{};
+        bool Blit{ false };
+        bool SideEffects{ false };
+        bool Culled{ false };
+    };
+    struct Step {
+        enum class Kind {
+            Pass,
+            Resolve,
+            Barrier
+        };
+        Kind Type{};
+        uint32_t Index{}; /* pass for Pass, the multisampled resource for Resolve, the resource for Barrier */
+        Access From{};
+        Access To{};
+    };
+    struct PhysicalTarget {
+        GPURenderTargetPool::Description Description{};
+        Resolution Extent{};
+        uint32_t LastUse{ NONE };
+        std::optional<GPUFrameBuffer> FrameBuffer{};
+    };
+
+    GPURenderTargetPool& pool;
+    std::vector<ResourceNode> resources{};
+    std::vector<PassNode> passes{};
+    std::vector<Step> steps{};
+    std::vector<PhysicalTarget> physicalTargets{};
+    Statistics statistics{};
+    bool compiled{ false };
+
+    uint32_t AddResource(ResourceNode&& resource) noexcept;
+    void Cull() noexcept;
+    void ScheduleSteps() noexcept;
+    void Alias() noexcept;
+    void Transition(std::vector<std::optional<Access>>& states, uint32_t resource, Access access) noexcept;
+    void Use(uint32_t resource, uint32_t position) noexcept;
+
+    GPUFrameBuffer& FrameBufferOf(uint32_t resource) noexcept;
+};
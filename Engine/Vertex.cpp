@@ -0,0 +1,140 @@
+#include <Engine/Vertex.hpp>
+
+#include <cmath>
+#include <numeric>
+#include <algorithm>
+
+#include <Engine/Log.hpp>
+
+GPUVertexAttribLayout PackedVertex::Layout() noexcept {
+    GPUVertexAttribLayout layout;
+    layout.Define<float_t>(3);
+    layout.Define<int16_t>(2, true);
+    layout.Define<Half>(2);
+    layout.Define<uint8_t>(4, true);
+    return layout;
+}
+
+GPUVertexAttribLayout SkinVertex::Layout() noexcept {
+    GPUVertexAttribLayout layout;
+    layout.Define<uint8_t>(Vertex::MAX_BONE_PER_VERTEX);
+    layout.Define<uint8_t>(Vertex::MAX_BONE_PER_VERTEX, true);
+    return layout;
+}
+
+bool PackedMesh::IsSkinned() const noexcept { return !Skin.empty(); }
+
+int16_t VertexQuantization::EncodeSnorm16(float value) noexcept {
+    return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+}
+float VertexQuantization::DecodeSnorm16(int16_t value) noexcept {
+    return std::max(static_cast<float>(value) / 32767.0f, -1.0f);
+}
+uint8_t VertexQuantization::EncodeUnorm8(float value) noexcept {
+    return static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+}
+float VertexQuantization::DecodeUnorm8(uint8_t value) noexcept {
+    return static_cast<float>(value) / 255.0f;
+}
+
+std::array<int16_t, 2> VertexQuantization::EncodeOctahedral(glm::vec3 normal) noexcept {
+    const float l1{ std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z) };
+    if (l1 == 0.0f) { return { 0, 0 }; }
+    normal /= l1;
+
+    glm::vec2 projected{ normal.x, normal.y };
+    if (normal.z < 0.0f) { // fold the lower hemisphere over the diagonals
+        projected.x = (1.0f - std::abs(normal.y)) * (normal.x >= 0.0f ? 1.0f : -1.0f);
+        projected.y = (1.0f - std::abs(normal.x)) * (normal.y >= 0.0f ? 1.0f : -1.0f);
+    }
+    return { EncodeSnorm16(projected.x), EncodeSnorm16(projected.y) };
+}
+glm::vec3 VertexQuantization::DecodeOctahedral(std::array<int16_t, 2> encoded) noexcept {
+    glm::vec3 normal{ DecodeSnorm16(encoded[0]), DecodeSnorm16(encoded[1]), 0.0f };
+    normal.z = 1.0f - std::abs(normal.x) - std::abs(normal.y);
+    const float fold{ std::max(-normal.z, 0.0f) };
+    normal.x += normal.x >= 0.0f ? -fold : fold;
+    normal.y += normal.y >= 0.0f ? -fold : fold;
+    return glm::normalize(normal);
+}
+
+std::array<uint8_t, 4> VertexQuantization::EncodeColor(glm::vec4 color) noexcept {
+    return { EncodeUnorm8(color.r), EncodeUnorm8(color.g), EncodeUnorm8(color.b), EncodeUnorm8(color.a) };
+}
+glm::vec4 VertexQuantization::DecodeColor(std::array<uint8_t, 4> encoded) noexcept {
+    return { DecodeUnorm8(encoded[0]), DecodeUnorm8(encoded[1]), DecodeUnorm8(encoded[2]), DecodeUnorm8(encoded[3]) };
+}
+
+std::array<uint8_t, Vertex::MAX_BONE_PER_VERTEX> VertexQuantization::EncodeBoneWeights(const std::array<float, Vertex::MAX_BONE_PER_VERTEX>& weights) noexcept {
+    std::array<uint8_t, Vertex::MAX_BONE_PER_VERTEX> rv{};
+    const float total{ std::accumulate(weights.begin(), weights.end(), 0.0f, [](float sum, float weight) { return sum + std::max(weight, 0.0f); }) };
+    if (total <= 0.0f) { return rv; }
+
+    int sum{ 0 };
+    size_t heaviest{ 0 };
+    for (size_t i = 0; i < weights.size(); i++) {
+        rv[i] = EncodeUnorm8(std::max(weights[i], 0.0f) / total);
+        sum += rv[i];
+        if (weights[i] > weights[heaviest]) { heaviest = i; }
+    }
+    rv[heaviest] = static_cast<uint8_t>(std::clamp(rv[heaviest] + (UINT8_MAX - sum), 0, static_cast<int>(UINT8_MAX)));
+    return rv;
+}
+std::array<float, Vertex::MAX_BONE_PER_VERTEX> VertexQuantization::DecodeBoneWeights(const std::array<uint8_t, Vertex::MAX_BONE_PER_VERTEX>& encoded) noexcept {
+    std::array<float, Vertex::MAX_BONE_PER_VERTEX> rv{};
+    std::ranges::transform(encoded, rv.begin(), DecodeUnorm8);
+    return rv;
+}
+
+PackedVertex VertexQuantization::Pack(const Vertex& vertex) noexcept {
+    return {
+        .Position = vertex.Position,
+        .Normal = EncodeOctahedral(vertex.Normal),
+        .TexCoords = { Half::FromFloat(vertex.TexCoords.x), Half::FromFloat(vertex.TexCoords.y) },
+        .Color = EncodeColor(vertex.Color)
+    };
+}
+SkinVertex VertexQuantization::PackSkin(const Vertex& vertex) noexcept {
+    SkinVertex rv{};
+    for (size_t i = 0; i < vertex.BoneIDs.size(); i++) {
+        rv.BoneIDs[i] = static_cast<uint8_t>(std::clamp(vertex.BoneIDs[i], 0, MAX_BONE_ID));
+    }
+    rv.BoneWeights = EncodeBoneWeights(vertex.BoneWeights);
+    return rv;
+}
+Vertex VertexQuantization::Unpack(const PackedVertex& vertex, const SkinVertex& skin) noexcept {
+    Vertex rv{
+        .Position = vertex.Position,
+        .Normal = DecodeOctahedral(vertex.Normal),
+        .Color = DecodeColor(vertex.Color),
+        .TexCoords = { vertex.TexCoords[0].ToFloat(), vertex.TexCoords[1].ToFloat() },
+        .BoneWeights = DecodeBoneWeights(skin.BoneWeights)
+    };
+    std::ranges::copy(skin.BoneIDs, rv.BoneIDs.begin());
+    return rv;
+}
+
+bool VertexQuantization::IsSkinned(const Vertex& vertex) noexcept {
+    return std::ranges::any_of(vertex.BoneWeights, [](float weight) { return weight > 0.0f; });
+}
+bool VertexQuantization::IsSkinRepresentable(const Vertex& vertex) noexcept {
+    return std::ranges::all_of(vertex.BoneIDs, [](int id) { return 0 <= id && id <= MAX_BONE_ID; });
+}
+
+PackedMesh VertexQuantization::Pack(std::span<const Vertex> vertices) {
+    PackedMesh rv{};
+    rv.Vertices.reserve(vertices.size());
+    for (const Vertex& vertex : vertices) {
+        rv.Vertices.push_back(Pack(vertex));
+    }
+    if (std::ranges::any_of(vertices, IsSkinned)) {
+        if (!std::ranges::all_of(vertices, IsSkinRepresentable)) {
+            DOA_LOG_WARNING("Mesh references bones beyond %d, bone ids are clamped!", MAX_BONE_ID);
+        }
+        rv.Skin.reserve(vertices.size());
+        for (const Vertex& vertex : vertices) {
+            rv.Skin.push_back(PackSkin(vertex));
+        }
+    }
+    return rv;
+}
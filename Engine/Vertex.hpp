@@ -1,10 +1,16 @@
 #pragma once
 
+#include <span>
 #include <array>
+#include <vector>
+#include <cstdint>
 #include <iostream>
 
 #include <glm/glm.hpp>
 
+#include <Engine/Half.hpp>
+#include <Engine/GPUVertexAttribLayout.hpp>
+
 struct Vertex {
 
     static constexpr int MAX_BONE_PER_VERTEX{ 4 };
@@ -18,4 +24,68 @@ struct Vertex {
     std::array<float, MAX_BONE_PER_VERTEX> BoneWeights{};
 
     friend std::ostream& operator<<(std::ostream& os, const Vertex& v);
-};
\ No newline at end of file
+};
+
+/* Quantized static stream, 24 bytes instead of Vertex's 88. Normals are octahedral encoded in 2x16 snorm, texture
+coordinates are half floats and color is unorm8, the shader reads them as vec3, vec2, vec2 and vec4. */
+struct PackedVertex {
+    glm::vec3 Position{};
+    std::array<int16_t, 2> Normal{};
+    std::array<Half, 2> TexCoords{};
+    std::array<uint8_t, 4> Color{};
+
+    static GPUVertexAttribLayout Layout() noexcept;
+};
+
+/* Skinning stream, 8 bytes, bound to its own binding and only for skinned meshes. Bone indices are uint8 and read
+as uvec4, weights are unorm8, read as vec4 and always sum to exactly 1. */
+struct SkinVertex {
+    std::array<uint8_t, Vertex::MAX_BONE_PER_VERTEX> BoneIDs{};
+    std::array<uint8_t, Vertex::MAX_BONE_PER_VERTEX> BoneWeights{};
+
+    static GPUVertexAttribLayout Layout() noexcept;
+};
+
+struct PackedMesh {
+    std::vector<PackedVertex> Vertices{};
+    std::vector<SkinVertex> Skin{}; /* empty for static meshes, otherwise one per vertex */
+
+    bool IsSkinned() const noexcept;
+};
+
+namespace VertexQuantization {
+
+    constexpr int MAX_BONE_ID{ UINT8_MAX };
+
+    int16_t EncodeSnorm16(float value) noexcept;
+    float DecodeSnorm16(int16_t value) noexcept;
+    uint8_t EncodeUnorm8(float value) noexcept;
+    float DecodeUnorm8(uint8_t value) noexcept;
+
+    /* Worst case angular error is below 0.004 degrees. A zero vector decodes as +Z. */
+    std::array<int16_t, 2> EncodeOctahedral(glm::vec3 normal) noexcept;
+    glm::vec3 DecodeOctahedral(std::array<int16_t, 2> encoded) noexcept;
+
+    std::array<uint8_t, 4> EncodeColor(glm::vec4 color) noexcept;
+    glm::vec4 DecodeColor(std::array<uint8_t, 4> encoded) noexcept;
+
+    /* Weights are normalized first, rounding error is put on the heaviest bone so the sum stays exact. */
+    std::array<uint8_t, Vertex::MAX_BONE_PER_VERTEX> EncodeBoneWeights(const std::array<float, Vertex::MAX_BONE_PER_VERTEX>& weights) noexcept;
+    std::array<float, Vertex::MAX_BONE_PER_VERTEX> DecodeBoneWeights(const std::array<uint8_t, Vertex::MAX_BONE_PER_VERTEX>& encoded) noexcept;
+
+    PackedVertex Pack(const Vertex& vertex) noexcept;
+    /* Bone ids outside [0, MAX_BONE_ID] are clamped, check with IsSkinRepresentable first. */
+    SkinVertex PackSkin(const Vertex& vertex) noexcept;
+    Vertex Unpack(const PackedVertex& vertex, const SkinVertex& skin = {}) noexcept;
+
+    bool IsSkinned(const Vertex& vertex) noexcept;
+    bool IsSkinRepresentable(const Vertex& vertex) noexcept;
+
+    /* Fills the skinning stream only when at least one vertex has a bone weight. */
+    PackedMesh Pack(std::span<const Vertex> vertices);
+}
+
+#ifdef DEBUG
+static_assert(sizeof(PackedVertex) == 24);
+static_assert(sizeof(SkinVertex) == 8);
+#endif
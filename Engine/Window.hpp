@@ -2,6 +2,7 @@
 
 #include <any>
 #include <span>
+#include <chrono>
 #include <cstddef>
 #include <utility>
 #include <string_view>
@@ -159,6 +160,7 @@ struct IWindow {
     virtual bool IsAlwaysOnTop() const noexcept = 0;
     virtual void SetAlwaysOnTop(bool isAlwaysOnTop) noexcept = 0;
 
+    virtual bool IsMinimized() const noexcept = 0;
     virtual void Minimize() const noexcept = 0;
     virtual void Restore() const noexcept = 0;
     virtual void Maximize() const noexcept = 0;
@@ -176,6 +178,10 @@ struct IWindow {
 
     virtual void Close() noexcept = 0;
     virtual void PollEvents() const noexcept = 0;
+    /* Blocks until an event arrives or timeout elapses, then processes events like PollEvents. */
+    virtual void WaitEvents(std::chrono::duration<double> timeout) const noexcept = 0;
+    /* Wakes up a thread blocked in WaitEvents. Safe to call from any thread. */
+    virtual void PostEmptyEvent() const noexcept = 0;
     virtual void SwapBuffers() const noexcept = 0;
     virtual bool ShouldClose() const noexcept = 0;
 
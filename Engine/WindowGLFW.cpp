@@ -325,6 +325,9 @@ void WindowGLFW::SetAlwaysOnTop(bool isAlwaysOnTop) noexcept {
     glfwSetWindowAttrib(glfwWindow, GLFW_FLOATING, isAlwaysOnTop ? GLFW_TRUE : GLFW_FALSE);
 }
 
+bool WindowGLFW::IsMinimized() const noexcept {
+    return glfwGetWindowAttrib(glfwWindow, GLFW_ICONIFIED) == GLFW_TRUE;
+}
 void WindowGLFW::Minimize() const noexcept { glfwIconifyWindow(glfwWindow); }
 void WindowGLFW::Restore() const noexcept { glfwRestoreWindow(glfwWindow); }
 void WindowGLFW::Maximize() const noexcept { glfwMaximizeWindow(glfwWindow); }
@@ -380,6 +383,12 @@ void WindowGLFW::Close() noexcept {
 void WindowGLFW::PollEvents() const noexcept {
     glfwPollEvents();
 }
+void WindowGLFW::WaitEvents(std::chrono::duration<double> timeout) const noexcept {
+    glfwWaitEventsTimeout(std::max(timeout.count(), 0.0));
+}
+void WindowGLFW::PostEmptyEvent() const noexcept {
+    glfwPostEmptyEvent();
+}
 void WindowGLFW::SwapBuffers() const noexcept {
     glfwSwapBuffers(glfwWindow);
 }
@@ -49,6 +49,7 @@ struct WindowGLFW final : public IWindow {
     bool IsAlwaysOnTop() const noexcept override;
     void SetAlwaysOnTop(bool isAlwaysOnTop) noexcept override;
 
+    bool IsMinimized() const noexcept override;
     void Minimize() const noexcept override;
     void Restore() const noexcept override;
     void Maximize() const noexcept override;
@@ -66,6 +67,8 @@ struct WindowGLFW final : public IWindow {
 
     void Close() noexcept override;
     void PollEvents() const noexcept override;
+    void WaitEvents(std::chrono::duration<double> timeout) const noexcept override;
+    void PostEmptyEvent() const noexcept override;
     void SwapBuffers() const noexcept override;
     bool ShouldClose() const noexcept override;
 
@@ -6,6 +6,8 @@
 
 #include <Launcher/FileDialog.hpp>
 
+#include <chrono>
+#include <cstdio>
 #include <fstream>
 #include <sys/stat.h>
 
@@ -31,6 +33,12 @@
 #define IFD_GUI_ELEMENT_SIZE std::max(GImGui->FontSize + 10.f, 24.f)
 #define IFD_DEFAULT_ICON_SIZE 32
 #define IFD_PI 3.141592f
+#define IFD_LISTING_BATCH_SIZE 64
+#define IFD_THUMBNAIL_SIZE 256
+#define IFD_THUMBNAIL_CAPACITY 512
+#define IFD_THUMBNAIL_UPLOADS_PER_FRAME 4
+#define IFD_THUMBNAIL_CACHE_PATH "Cache/Thumbnails"
+#define IFD_THUMBNAIL_MAGIC 0x48544E44 /* "NDTH" */
 
 static const char* GetDefaultFolderIcon();
 static const char* GetDefaultFileIcon();
@@ -333,25 +341,145 @@ bool FileIcon(const char* label, bool isSelected, ImTextureID icon, ImVec2 size,
 	return ret;
 }
 
+/* THUMBNAILS */
+static uint64_t HashThumbnailKey(const std::string& path, time_t dateWritten)
+{
+	uint64_t hash = 0xcbf29ce484222325ull;
+	auto mix = [&hash](const void* data, size_t size) {
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+		for (size_t i = 0; i < size; i++) {
+			hash ^= bytes[i];
+			hash *= 0x100000001b3ull;
+		}
+	};
+	int64_t written = static_cast<int64_t>(dateWritten);
+	int32_t size = IFD_THUMBNAIL_SIZE;
+	mix(path.data(), path.size());
+	mix(&written, sizeof(written));
+	mix(&size, sizeof(size));
+	return hash;
+}
+static std::filesystem::path GetThumbnailCacheFile(const std::string& key)
+{
+	return std::filesystem::path(IFD_THUMBNAIL_CACHE_PATH) / (key + ".bin");
+}
+static bool ReadThumbnail(const std::string& key, int& width, int& height, std::vector<uint8_t>& pixels)
+{
+	std::ifstream in(GetThumbnailCacheFile(key), std::ios::binary);
+	if (!in)
+		return false;
+
+	uint32_t header[3]{};
+	in.read(reinterpret_cast<char*>(header), sizeof(header));
+	if (!in || header[0] != IFD_THUMBNAIL_MAGIC || header[1] == 0 || header[2] == 0 || header[1] > IFD_THUMBNAIL_SIZE || header[2] > IFD_THUMBNAIL_SIZE)
+		return false;
+
+	width = static_cast<int>(header[1]);
+	height = static_cast<int>(header[2]);
+	pixels.resize(static_cast<size_t>(width) * height * 4);
+	in.read(reinterpret_cast<char*>(pixels.data()), pixels.size());
+	return static_cast<bool>(in);
+}
+static void WriteThumbnail(const std::string& key, int width, int height, const std::vector<uint8_t>& pixels)
+{
+	std::error_code ec;
+	std::filesystem::create_directories(IFD_THUMBNAIL_CACHE_PATH, ec);
+
+	// write to a temporary and rename, another launcher might be reading the same thumbnail
+	std::filesystem::path file = GetThumbnailCacheFile(key);
+	std::filesystem::path temp = file;
+	temp += ".tmp";
+	{
+		std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+		if (!out)
+			return;
+
+		uint32_t header[3]{ IFD_THUMBNAIL_MAGIC, static_cast<uint32_t>(width), static_cast<uint32_t>(height) };
+		out.write(reinterpret_cast<const char*>(header), sizeof(header));
+		out.write(reinterpret_cast<const char*>(pixels.data()), pixels.size());
+		if (!out)
+			return;
+	}
+	std::filesystem::rename(temp, file, ec);
+	if (ec)
+		std::filesystem::remove(temp, ec);
+}
+static void DownscaleImage(const uint8_t* image, int width, int height, int& outWidth, int& outHeight, std::vector<uint8_t>& pixels)
+{
+	float scale = std::min<float>(1.0f, static_cast<float>(IFD_THUMBNAIL_SIZE) / std::max(width, height));
+	outWidth = std::max(1, static_cast<int>(width * scale));
+	outHeight = std::max(1, static_cast<int>(height * scale));
+	pixels.resize(static_cast<size_t>(outWidth) * outHeight * 4);
+
+	// box filter, every thumbnail pixel averages the source pixels it covers
+	for (int y = 0; y < outHeight; y++) {
+		int y0 = y * height / outHeight;
+		int y1 = std::max(y0 + 1, (y + 1) * height / outHeight);
+		for (int x = 0; x < outWidth; x++) {
+			int x0 = x * width / outWidth;
+			int x1 = std::max(x0 + 1, (x + 1) * width / outWidth);
+
+			uint32_t sum[4]{};
+			for (int sy = y0; sy < y1; sy++)
+				for (int sx = x0; sx < x1; sx++)
+					for (int c = 0; c < 4; c++)
+						sum[c] += image[(static_cast<size_t>(sy) * width + sx) * 4 + c];
+
+			uint32_t count = static_cast<uint32_t>((y1 - y0) * (x1 - x0));
+			for (int c = 0; c < 4; c++)
+				pixels[(static_cast<size_t>(y) * outWidth + x) * 4 + c] = static_cast<uint8_t>(sum[c] / count);
+		}
+	}
+}
+
+/* stb_image pulls the file through these callbacks, so a canceled decode stops at the next read */
+struct PreviewSource {
+	FILE* File;
+	const std::atomic_bool* Canceled;
+};
+static int PreviewRead(void* user, char* data, int size)
+{
+	PreviewSource* source = static_cast<PreviewSource*>(user);
+	if (*source->Canceled)
+		return 0;
+	return static_cast<int>(fread(data, 1, size, source->File));
+}
+static void PreviewSkip(void* user, int n)
+{
+	PreviewSource* source = static_cast<PreviewSource*>(user);
+	fseek(source->File, n, SEEK_CUR);
+}
+static int PreviewEof(void* user)
+{
+	PreviewSource* source = static_cast<PreviewSource*>(user);
+	return *source->Canceled || feof(source->File);
+}
+
 FileDialog::FileData::FileData(const std::filesystem::path& path) {
 	std::error_code ec;
 	Path = path;
 	IsDirectory = std::filesystem::is_directory(path, ec);
 	Size = std::filesystem::file_size(path, ec);
 
-	struct stat attr;
+	struct stat attr{};
 #ifdef _WIN32
 	_wstat64i32(path.wstring().c_str(), (struct _stat64i32*)&attr);
 #else
 	stat(path.string().c_str(), &attr);
 #endif
 	DateModified = attr.st_ctime;
+	DateWritten = attr.st_mtime;
 
 	HasIconPreview = false;
-	IconPreview = nullptr;
-	IconPreviewData = nullptr;
-	IconPreviewHeight = 0;
-	IconPreviewWidth = 0;
+	if (!IsDirectory && path.has_extension()) {
+		std::string ext = path.extension().string();
+		HasIconPreview = ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".bmp" || ext == ".tga";
+	}
+	if (HasIconPreview) {
+		char key[17];
+		snprintf(key, sizeof(key), "%016llx", static_cast<unsigned long long>(HashThumbnailKey(path.string(), DateWritten)));
+		ThumbnailKey = key;
+	}
 }
 
 FileDialog::FileDialog() {
@@ -365,12 +493,8 @@ FileDialog::FileDialog() {
 	m_pathBuffer[0] = 0;
 	m_searchBuffer[0] = 0;
 	m_newEntryBuffer[0] = 0;
-	m_selectedFileItem = -1;
 	m_zoom = 1.0f;
 
-	m_previewLoader = nullptr;
-	m_previewLoaderRunning = false;
-
 	m_setDirectory(std::filesystem::current_path(), false);
 
 	// favorites are available on every OS
@@ -445,7 +569,9 @@ FileDialog::FileDialog() {
 #endif
 }
 FileDialog::~FileDialog() {
-	m_clearIconPreview();
+	m_cancelListings(true);
+	m_stopPreviewLoader();
+	m_clearThumbnails();
 	m_clearIcons();
 
 	for (auto fn : m_treeCache)
@@ -464,7 +590,7 @@ bool FileDialog::Save(const std::string& key, const std::string& title, const st
 	m_result.clear();
 	m_inputTextbox[0] = 0;
 	m_selections.clear();
-	m_selectedFileItem = -1;
+	m_selectedFileItem.clear();
 	m_isMultiselect = false;
 	m_type = IFD_DIALOG_SAVE;
 
@@ -488,7 +614,7 @@ bool FileDialog::Open(const std::string& key, const std::string& title, const st
 	m_result.clear();
 	m_inputTextbox[0] = 0;
 	m_selections.clear();
-	m_selectedFileItem = -1;
+	m_selectedFileItem.clear();
 	m_isMultiselect = isMultiselect;
 	m_type = filter.empty() ? IFD_DIALOG_DIRECTORY : IFD_DIALOG_FILE;
 
@@ -527,6 +653,9 @@ void FileDialog::Close()
 	m_backHistory = std::stack<std::filesystem::path>();
 	m_forwardHistory = std::stack<std::filesystem::path>();
 
+	// the tree nodes listings write into are about to be deleted
+	m_cancelListings(true);
+
 	// clear the tree
 	for (auto fn : m_treeCache) {
 		for (auto item : fn->Children) {
@@ -537,8 +666,8 @@ void FileDialog::Close()
 		}
 	}
 
-	// free icon textures
-	m_clearIconPreview();
+	// free icon textures, thumbnails stay cached for the next session
+	m_stopPreviewLoader();
 	m_clearIcons();
 }
 
@@ -847,67 +976,143 @@ void FileDialog::m_refreshIconPreview()
 {
 	if (m_zoom >= 5.0f) {
 		if (m_previewLoader == nullptr) {
-			m_previewLoaderRunning = true;
-			m_previewLoader = new std::thread(&FileDialog::m_loadPreview, this);
+			m_previewLoader = std::make_shared<PreviewJob>();
+			std::thread(&FileDialog::m_loadPreview, m_previewLoader).detach();
+
+			for (const auto& data : m_content)
+				m_requestPreview(data);
 		}
 	} else
-		m_clearIconPreview();
+		m_stopPreviewLoader();
 }
-void FileDialog::m_clearIconPreview()
+void FileDialog::m_stopPreviewLoader()
 {
-	m_stopPreviewLoader();
-
-	for (auto& data : m_content) {
-		if (!data.HasIconPreview)
-			continue;
+	if (m_previewLoader != nullptr) {
+		{
+			std::lock_guard<std::mutex> lock(m_previewLoader->Mutex);
+			m_previewLoader->Canceled = true;
+		}
+		m_previewLoader->Wakeup.notify_all();
 
-		data.HasIconPreview = false;
-		this->DeleteTexture(data.IconPreview);
+		// the worker owns the job now and exits on its own, decoding stops at its next read
+		m_previewLoader = nullptr;
+	}
+	m_previewRequests.clear();
+}
+void FileDialog::m_requestPreview(const FileData& data)
+{
+	if (m_previewLoader == nullptr || !data.HasIconPreview)
+		return;
+	if (m_thumbnails.count(data.ThumbnailKey) > 0 || !m_previewRequests.insert(data.ThumbnailKey).second)
+		return;
 
-		if (data.IconPreviewData != nullptr) {
-			stbi_image_free(data.IconPreviewData);
-			data.IconPreviewData = nullptr;
-		}
+	{
+		std::lock_guard<std::mutex> lock(m_previewLoader->Mutex);
+		m_previewLoader->Requests.emplace_back(data.Path, data.ThumbnailKey);
 	}
+	m_previewLoader->Wakeup.notify_one();
 }
-void FileDialog::m_stopPreviewLoader()
+void FileDialog::m_pollPreviews()
 {
-	if (m_previewLoader != nullptr) {
-		m_previewLoaderRunning = false;
+	if (m_previewLoader == nullptr)
+		return;
 
-		if (m_previewLoader && m_previewLoader->joinable())
-			m_previewLoader->join();
+	std::vector<Thumbnail> decoded;
+	{
+		std::lock_guard<std::mutex> lock(m_previewLoader->Mutex);
+		auto& ready = m_previewLoader->Decoded;
+		size_t count = std::min<size_t>(ready.size(), IFD_THUMBNAIL_UPLOADS_PER_FRAME);
+		std::move(ready.begin(), ready.begin() + count, std::back_inserter(decoded));
+		ready.erase(ready.begin(), ready.begin() + count);
+	}
 
-		delete m_previewLoader;
-		m_previewLoader = nullptr;
+	for (auto& thumbnail : decoded) {
+		if (m_thumbnails.count(thumbnail.Key) > 0)
+			continue;
+
+		m_thumbnailUse.push_front(thumbnail.Key);
+		m_thumbnails[thumbnail.Key] = { this->CreateTexture(thumbnail.Pixels.data(), thumbnail.Width, thumbnail.Height, 1), thumbnail.Width, thumbnail.Height, m_thumbnailUse.begin() };
+	}
+
+	// visible thumbnails are touched every frame, so the least recently used ones are off screen
+	while (m_thumbnails.size() > IFD_THUMBNAIL_CAPACITY) {
+		auto it = m_thumbnails.find(m_thumbnailUse.back());
+		this->DeleteTexture(it->second.Texture);
+		m_previewRequests.erase(it->first);
+		m_thumbnails.erase(it);
+		m_thumbnailUse.pop_back();
 	}
 }
-void FileDialog::m_loadPreview()
+const FileDialog::ThumbnailTexture* FileDialog::m_getPreview(const FileData& data)
 {
-	for (size_t i = 0; m_previewLoaderRunning && i < m_content.size(); i++) {
-		auto& data = m_content[i];
+	if (!data.HasIconPreview)
+		return nullptr;
 
-		if (data.HasIconPreview)
-			continue;
+	auto it = m_thumbnails.find(data.ThumbnailKey);
+	if (it == m_thumbnails.end()) {
+		m_requestPreview(data); // evicted while off screen
+		return nullptr;
+	}
 
-		if (data.Path.has_extension()) {
-			std::string ext = data.Path.extension().string();
-			if (ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".bmp" || ext == ".tga") {
-				int width, height, nrChannels;
-				unsigned char* image = stbi_load(data.Path.string().c_str(), &width, &height, &nrChannels, STBI_rgb_alpha);
+	m_thumbnailUse.splice(m_thumbnailUse.begin(), m_thumbnailUse, it->second.Use);
+	return &it->second;
+}
+void FileDialog::m_clearThumbnails()
+{
+	for (auto& [key, thumbnail] : m_thumbnails)
+		this->DeleteTexture(thumbnail.Texture);
+	m_thumbnails.clear();
+	m_thumbnailUse.clear();
+	m_previewRequests.clear();
+}
+void FileDialog::m_loadPreview(std::shared_ptr<PreviewJob> job)
+{
+	while (true) {
+		std::pair<std::filesystem::path, std::string> request;
+		{
+			std::unique_lock<std::mutex> lock(job->Mutex);
+			job->Wakeup.wait(lock, [&job]() { return job->Canceled || !job->Requests.empty(); });
+			if (job->Canceled)
+				return;
+
+			request = std::move(job->Requests.front());
+			job->Requests.pop_front();
+		}
 
-				if (image == nullptr || width == 0 || height == 0)
-					continue;
+		Thumbnail thumbnail;
+		thumbnail.Key = request.second;
+		if (!ReadThumbnail(thumbnail.Key, thumbnail.Width, thumbnail.Height, thumbnail.Pixels)) {
+#ifdef _WIN32
+			FILE* file = _wfopen(request.first.wstring().c_str(), L"rb");
+#else
+			FILE* file = fopen(request.first.string().c_str(), "rb");
+#endif
+			if (file == nullptr)
+				continue;
 
-				data.HasIconPreview = true;
-				data.IconPreviewData = image;
-				data.IconPreviewWidth = width;
-				data.IconPreviewHeight = height;
+			PreviewSource source{ file, &job->Canceled };
+			stbi_io_callbacks callbacks{ PreviewRead, PreviewSkip, PreviewEof };
+			int width, height, nrChannels;
+			unsigned char* image = stbi_load_from_callbacks(&callbacks, &source, &width, &height, &nrChannels, STBI_rgb_alpha);
+			fclose(file);
+
+			if (job->Canceled) {
+				stbi_image_free(image);
+				return;
 			}
+			if (image == nullptr || width == 0 || height == 0) {
+				stbi_image_free(image);
+				continue;
+			}
+
+			DownscaleImage(image, width, height, thumbnail.Width, thumbnail.Height, thumbnail.Pixels);
+			stbi_image_free(image);
+			WriteThumbnail(thumbnail.Key, thumbnail.Width, thumbnail.Height, thumbnail.Pixels);
 		}
-	}
 
-	m_previewLoaderRunning = false;
+		std::lock_guard<std::mutex> lock(job->Mutex);
+		job->Decoded.push_back(std::move(thumbnail));
+	}
 }
 void FileDialog::m_clearTree(FileTreeNode* node)
 {
@@ -934,9 +1139,10 @@ void FileDialog::m_setDirectory(const std::filesystem::path& p, bool addHistory)
 		m_currentDirectory = std::filesystem::path(p.string() + "\\");
 #endif
 
-	m_clearIconPreview();
+	m_stopPreviewLoader();
+	m_cancelListings(false);
 	m_content.clear(); // p == "" after this line, due to reference
-	m_selectedFileItem = -1;
+	m_selectedFileItem.clear();
 
 	if (m_type == IFD_DIALOG_DIRECTORY || m_type == IFD_DIALOG_FILE)
 		m_inputTextbox[0] = 0;
@@ -947,128 +1153,204 @@ void FileDialog::m_setDirectory(const std::filesystem::path& p, bool addHistory)
 		m_clearIcons();
 	}
 
-	if (p.string() == "Quick Access") {
+	if (m_currentDirectory.string() == "Quick Access") {
 		for (auto& node : m_treeCache) {
-			if (node->Path == p)
+			if (node->Path == m_currentDirectory)
 				for (auto& c : node->Children)
 					m_content.push_back(FileData(c->Path));
 		}
 	}
-	else if (p.string() == "This PC") {
+	else if (m_currentDirectory.string() == "This PC") {
 		for (auto& node : m_treeCache) {
-			if (node->Path == p)
+			if (node->Path == m_currentDirectory)
 				for (auto& c : node->Children)
 					m_content.push_back(FileData(c->Path));
 		}
 	}
 	else {
-		std::error_code ec;
-		if (std::filesystem::exists(m_currentDirectory, ec))
-			for (const auto& entry : std::filesystem::directory_iterator(m_currentDirectory, ec)) {
-				FileData info(entry.path());
+		m_listing = std::make_shared<ListingJob>();
+		m_listing->Directory = m_currentDirectory;
+		m_listing->DirectoriesOnly = m_type == IFD_DIALOG_DIRECTORY;
+		m_listing->Query = m_searchBuffer;
+		std::transform(m_listing->Query.begin(), m_listing->Query.end(), m_listing->Query.begin(), ::tolower);
+		if (m_type != IFD_DIALOG_DIRECTORY && m_filterSelection < m_filterExtensions.size())
+			m_listing->Extensions = m_filterExtensions[m_filterSelection];
+		std::thread(&FileDialog::m_runListing, m_listing).detach();
+	}
 
-				// skip files when IFD_DIALOG_DIRECTORY
-				if (!info.IsDirectory && m_type == IFD_DIALOG_DIRECTORY)
-					continue;
+	m_sortContent(m_sortColumn, m_sortDirection);
+	m_refreshIconPreview();
+}
+void FileDialog::m_pollListings()
+{
+	if (m_listing != nullptr) {
+		bool done = m_listing->Done; // read before taking the entries, so the last batch isn't left behind
+
+		std::vector<FileData> entries;
+		{
+			std::lock_guard<std::mutex> lock(m_listing->Mutex);
+			entries.swap(m_listing->Entries);
+		}
 
-				// check if filename matches search query
-				if (m_searchBuffer[0]) {
-					std::string filename = info.Path.string();
+		if (!entries.empty()) {
+			size_t firstNew = m_content.size();
+			for (auto& entry : entries) {
+				m_requestPreview(entry);
+				m_content.push_back(std::move(entry));
+			}
+			m_mergeContent(firstNew);
+		}
 
-					std::string filenameSearch = filename;
-					std::string query(m_searchBuffer);
-					std::transform(filenameSearch.begin(), filenameSearch.end(), filenameSearch.begin(), ::tolower);
-					std::transform(query.begin(), query.end(), query.begin(), ::tolower);
+		if (done)
+			m_listing = nullptr;
+	}
 
-					if (filenameSearch.find(query, 0) == std::string::npos)
-						continue;
-				}
+	for (size_t i = 0; i < m_treeListings.size();) {
+		if (!m_treeListings[i].second->Done) {
+			i++;
+			continue;
+		}
 
-				// check if extension matches
-				if (!info.IsDirectory && m_type != IFD_DIALOG_DIRECTORY) {
-					if (m_filterSelection < m_filterExtensions.size()) {
-						const auto& exts = m_filterExtensions[m_filterSelection];
-						if (exts.size() > 0) {
-							std::string extension = info.Path.extension().string();
-
-							// extension not found? skip
-							if (std::count(exts.begin(), exts.end(), extension) == 0)
-								continue;
-						}
-					}
-				}
+		auto [node, job] = std::move(m_treeListings[i]);
+		m_treeListings.erase(m_treeListings.begin() + i);
 
-				m_content.push_back(info);
-			}
+		std::lock_guard<std::mutex> lock(job->Mutex);
+		for (const auto& entry : job->Entries)
+			node->Children.push_back(new FileTreeNode(entry.Path.string()));
+	}
+}
+void FileDialog::m_cancelListings(bool includeTree)
+{
+	if (m_listing != nullptr) {
+		m_listing->Canceled = true;
+		m_listing = nullptr;
 	}
 
-	m_sortContent(m_sortColumn, m_sortDirection);
-	m_refreshIconPreview();
+	if (includeTree) {
+		for (auto& [node, job] : m_treeListings)
+			job->Canceled = true;
+		m_treeListings.clear();
+	}
 }
-void FileDialog::m_sortContent(unsigned int column, unsigned int sortDirection)
+void FileDialog::m_runListing(std::shared_ptr<ListingJob> job)
 {
-	// 0 -> name, 1 -> date, 2 -> size
-	m_sortColumn = column;
-	m_sortDirection = sortDirection;
+	std::vector<FileData> batch;
+	auto flush = [&job, &batch]() {
+		if (batch.empty())
+			return;
 
-	// split into directories and files
-	std::partition(m_content.begin(), m_content.end(), [](const FileData& data) {
-		return data.IsDirectory;
-	});
+		std::lock_guard<std::mutex> lock(job->Mutex);
+		std::move(batch.begin(), batch.end(), std::back_inserter(job->Entries));
+		batch.clear();
+	};
 
-	if (m_content.size() > 0) {
-		// find where the file list starts
-		size_t fileIndex = 0;
-		for (; fileIndex < m_content.size(); fileIndex++)
-			if (!m_content[fileIndex].IsDirectory)
-				break;
+	try {
+		std::error_code ec;
+		auto lastFlush = std::chrono::steady_clock::now();
+		for (auto it = std::filesystem::directory_iterator(job->Directory, ec); !ec && it != std::filesystem::directory_iterator(); it.increment(ec)) {
+			if (job->Canceled)
+				return;
 
-		// compare function
-		auto compareFn = [column, sortDirection](const FileData& left, const FileData& right) -> bool {
-			// name
-			if (column == 0) {
-				std::string lName = left.Path.string();
-				std::string rName = right.Path.string();
+			FileData info(it->path());
 
-				std::transform(lName.begin(), lName.end(), lName.begin(), ::tolower);
-				std::transform(rName.begin(), rName.end(), rName.begin(), ::tolower);
+			// skip files when IFD_DIALOG_DIRECTORY
+			if (!info.IsDirectory && job->DirectoriesOnly)
+				continue;
 
-				int comp = lName.compare(rName);
+			// check if filename matches search query
+			if (!job->Query.empty()) {
+				std::string filenameSearch = info.Path.string();
+				std::transform(filenameSearch.begin(), filenameSearch.end(), filenameSearch.begin(), ::tolower);
 
-				if (sortDirection == ImGuiSortDirection_Ascending)
-					return comp < 0;
-				return comp > 0;
+				if (filenameSearch.find(job->Query, 0) == std::string::npos)
+					continue;
 			}
-			// date
-			else if (column == 1) {
-				if (sortDirection == ImGuiSortDirection_Ascending)
-					return left.DateModified < right.DateModified;
-				else
-					return left.DateModified > right.DateModified;
+
+			// check if extension matches
+			if (!info.IsDirectory && job->Extensions.size() > 0) {
+				std::string extension = info.Path.extension().string();
+
+				// extension not found? skip
+				if (std::count(job->Extensions.begin(), job->Extensions.end(), extension) == 0)
+					continue;
 			}
-			// size
-			else if (column == 2) {
-				if (sortDirection == ImGuiSortDirection_Ascending)
-					return left.Size < right.Size;
-				else
-					return left.Size > right.Size;
+
+			batch.push_back(std::move(info));
+
+			// stream entries in batches, or every few frames when each entry is slow to stat
+			auto now = std::chrono::steady_clock::now();
+			if (batch.size() >= IFD_LISTING_BATCH_SIZE || now - lastFlush > std::chrono::milliseconds(50)) {
+				flush();
+				lastFlush = now;
 			}
+		}
+	} catch (const std::exception&) {
+		// paths that can't be converted end the listing early, what was read so far is still shown
+	}
 
-			return false;
-		};
+	flush();
+	job->Done = true;
+}
+static bool CompareFileData(const FileDialog::FileData& left, const FileDialog::FileData& right, unsigned int column, unsigned int sortDirection)
+{
+	// directories come before files
+	if (left.IsDirectory != right.IsDirectory)
+		return left.IsDirectory;
+
+	// name
+	if (column == 0) {
+		std::string lName = left.Path.string();
+		std::string rName = right.Path.string();
 
-		// sort the directories
-		std::sort(m_content.begin(), m_content.begin() + fileIndex, compareFn);
+		std::transform(lName.begin(), lName.end(), lName.begin(), ::tolower);
+		std::transform(rName.begin(), rName.end(), rName.begin(), ::tolower);
 
-		// sort the files
-		std::sort(m_content.begin() + fileIndex, m_content.end(), compareFn);
+		int comp = lName.compare(rName);
+
+		if (sortDirection == ImGuiSortDirection_Ascending)
+			return comp < 0;
+		return comp > 0;
+	}
+	// date
+	else if (column == 1) {
+		if (sortDirection == ImGuiSortDirection_Ascending)
+			return left.DateModified < right.DateModified;
+		else
+			return left.DateModified > right.DateModified;
+	}
+	// size
+	else if (column == 2) {
+		if (sortDirection == ImGuiSortDirection_Ascending)
+			return left.Size < right.Size;
+		else
+			return left.Size > right.Size;
 	}
+
+	return false;
+}
+void FileDialog::m_sortContent(unsigned int column, unsigned int sortDirection)
+{
+	// 0 -> name, 1 -> date, 2 -> size
+	m_sortColumn = column;
+	m_sortDirection = sortDirection;
+
+	std::sort(m_content.begin(), m_content.end(), [column, sortDirection](const FileData& left, const FileData& right) {
+		return CompareFileData(left, right, column, sortDirection);
+	});
+}
+void FileDialog::m_mergeContent(size_t firstNew)
+{
+	// streamed entries are sorted on their own and merged in, instead of resorting everything each batch
+	auto compareFn = [this](const FileData& left, const FileData& right) {
+		return CompareFileData(left, right, m_sortColumn, m_sortDirection);
+	};
+	std::sort(m_content.begin() + firstNew, m_content.end(), compareFn);
+	std::inplace_merge(m_content.begin(), m_content.begin() + firstNew, m_content.end(), compareFn);
 }
 
 void FileDialog::m_renderTree(FileTreeNode* node)
 {
 	// directory
-	std::error_code ec;
 	ImGui::PushID(node);
 	bool isClicked = false;
 	std::string displayName = node->Path.stem().string();
@@ -1076,12 +1358,12 @@ void FileDialog::m_renderTree(FileTreeNode* node)
 		displayName = node->Path.string();
 	if (FolderNode(displayName.c_str(), (ImTextureID)m_getIcon(node->Path), isClicked)) {
 		if (!node->Read) {
-			// cache children if it's not already cached
-			if (std::filesystem::exists(node->Path, ec))
-				for (const auto& entry : std::filesystem::directory_iterator(node->Path, ec)) {
-					if (std::filesystem::is_directory(entry, ec))
-						node->Children.push_back(new FileTreeNode(entry.path().string()));
-				}
+			// cache children if it's not already cached, they show up once the listing is done
+			auto job = std::make_shared<ListingJob>();
+			job->Directory = node->Path;
+			job->DirectoriesOnly = true;
+			std::thread(&FileDialog::m_runListing, job).detach();
+			m_treeListings.emplace_back(node, job);
 			node->Read = true;
 		}
 
@@ -1098,7 +1380,7 @@ void FileDialog::m_renderTree(FileTreeNode* node)
 void FileDialog::m_renderContent()
 {
 	if (ImGui::IsMouseClicked(ImGuiMouseButton_Right))
-		m_selectedFileItem = -1;
+		m_selectedFileItem.clear();
 
 	// table view
 	if (m_zoom == 1.0f) {
@@ -1119,7 +1401,6 @@ void FileDialog::m_renderContent()
 			}
 
 			// content
-			int fileId = 0;
 			for (auto& entry : m_content) {
 				std::string filename = entry.Path.filename().string();
 				if (filename.size() == 0)
@@ -1149,8 +1430,7 @@ void FileDialog::m_renderContent()
 					}
 				}
 				if (ImGui::IsItemClicked(ImGuiMouseButton_Right))
-					m_selectedFileItem = fileId;
-				fileId++;
+					m_selectedFileItem = entry.Path;
 
 				// date
 				ImGui::TableSetColumnIndex(1);
@@ -1170,13 +1450,8 @@ void FileDialog::m_renderContent()
 	// "icon" view
 	else {
 		// content
-		int fileId = 0;
 		for (auto& entry : m_content) {
-			if (entry.HasIconPreview && entry.IconPreviewData != nullptr) {
-				entry.IconPreview = this->CreateTexture(entry.IconPreviewData, entry.IconPreviewWidth, entry.IconPreviewHeight, 1);
-				stbi_image_free(entry.IconPreviewData);
-				entry.IconPreviewData = nullptr;
-			}
+			const ThumbnailTexture* preview = m_zoom >= 5.0f ? m_getPreview(entry) : nullptr;
 
 			std::string filename = entry.Path.filename().string();
 			if (filename.size() == 0)
@@ -1184,7 +1459,10 @@ void FileDialog::m_renderContent()
 
 			bool isSelected = std::count(m_selections.begin(), m_selections.end(), entry.Path);
 
-			if (FileIcon(filename.c_str(), isSelected, entry.HasIconPreview ? entry.IconPreview : (ImTextureID)m_getIcon(entry.Path), ImVec2(32 + 16 * m_zoom, 32 + 16 * m_zoom), entry.HasIconPreview, entry.IconPreviewWidth, entry.IconPreviewHeight)) {
+			ImTextureID icon = preview != nullptr ? preview->Texture : (ImTextureID)m_getIcon(entry.Path);
+			int previewWidth = preview != nullptr ? preview->Width : 0;
+			int previewHeight = preview != nullptr ? preview->Height : 0;
+			if (FileIcon(filename.c_str(), isSelected, icon, ImVec2(32 + 16 * m_zoom, 32 + 16 * m_zoom), preview != nullptr, previewWidth, previewHeight)) {
 				std::error_code ec;
 				bool isDir = std::filesystem::is_directory(entry.Path, ec);
 
@@ -1202,8 +1480,7 @@ void FileDialog::m_renderContent()
 				}
 			}
 			if (ImGui::IsItemClicked(ImGuiMouseButton_Right))
-				m_selectedFileItem = fileId;
-			fileId++;
+				m_selectedFileItem = entry.Path;
 		}
 	}
 }
@@ -1224,7 +1501,7 @@ void FileDialog::m_renderPopups()
 			}
 			ImGui::EndMenu();
 		}
-		if (m_selectedFileItem != -1) {
+		if (!m_selectedFileItem.empty()) {
 			ImGui::Separator();
 			if (ImGui::Selectable("Delete")) {
 				openAreYouSureDlg = true;
@@ -1239,11 +1516,10 @@ void FileDialog::m_renderPopups()
 	if (openNewDirectoryDlg)
 		ImGui::OpenPopup("Enter folder name##newdir");
 	if (ImGui::BeginPopupModal("Are you sure?##delete", nullptr, ImGuiWindowFlags_AlwaysAutoResize)) {
-		if (m_selectedFileItem >= static_cast<int>(m_content.size()) || m_content.size() == 0)
+		if (m_selectedFileItem.empty())
 			ImGui::CloseCurrentPopup();
 		else {
-			const FileData& data = m_content[m_selectedFileItem];
-			ImGuiFormattedText("Are you sure you want to delete {}?", data.Path.filename().string().c_str());
+			ImGuiFormattedText("Are you sure you want to delete {}?", m_selectedFileItem.filename().string().c_str());
 
 			ImGui::Separator();
 
@@ -1258,7 +1534,7 @@ void FileDialog::m_renderPopups()
 
 			if (ImGui::Button("Yes", buttonSize)) {
 				std::error_code ec;
-				std::filesystem::remove_all(data.Path, ec);
+				std::filesystem::remove_all(m_selectedFileItem, ec);
 				m_setDirectory(m_currentDirectory, false); // refresh
 				ImGui::CloseCurrentPopup();
 			}
@@ -1336,6 +1612,9 @@ void FileDialog::m_renderPopups()
 }
 void FileDialog::m_renderFileDialog()
 {
+	m_pollListings();
+	m_pollPreviews();
+
 	/***** TOP BAR *****/
 	bool noBackHistory = m_backHistory.empty(), noForwardHistory = m_forwardHistory.empty();
 
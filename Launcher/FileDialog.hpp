@@ -1,13 +1,20 @@
 #pragma once
 
+#include <list>
 #include <ctime>
+#include <deque>
+#include <mutex>
 #include <stack>
+#include <atomic>
+#include <memory>
 #include <string>
 #include <thread>
 #include <vector>
 #include <functional>
 #include <filesystem>
 #include <unordered_map>
+#include <unordered_set>
+#include <condition_variable>
 #include <algorithm>
 
 #include <Engine/Log.hpp>
@@ -97,14 +104,44 @@ public:
 		bool IsDirectory;
 		size_t Size;
 		time_t DateModified;
+		time_t DateWritten;
 
 		bool HasIconPreview;
-		void* IconPreview;
-		uint8_t* IconPreviewData;
-		int IconPreviewWidth, IconPreviewHeight;
+		std::string ThumbnailKey; // hash of path and write time, names the thumbnail in memory and on disk
 	};
 
 private:
+	/* Directory listings run on a detached worker and are streamed into the view. Canceling one only
+	raises a flag, so navigating away from a slow (network mounted, huge) folder never blocks the UI. */
+	struct ListingJob {
+		std::filesystem::path Directory;
+		bool DirectoriesOnly{ false };
+		std::string Query;
+		std::vector<std::string> Extensions;
+
+		std::atomic_bool Canceled{ false };
+		std::atomic_bool Done{ false };
+		std::mutex Mutex;
+		std::vector<FileData> Entries; // guarded by Mutex
+	};
+	struct Thumbnail {
+		std::string Key;
+		int Width{ 0 }, Height{ 0 };
+		std::vector<uint8_t> Pixels;
+	};
+	struct PreviewJob {
+		std::atomic_bool Canceled{ false };
+		std::mutex Mutex;
+		std::condition_variable Wakeup;
+		std::deque<std::pair<std::filesystem::path, std::string>> Requests; // guarded by Mutex
+		std::vector<Thumbnail> Decoded;                                   // guarded by Mutex
+	};
+	struct ThumbnailTexture {
+		void* Texture;
+		int Width, Height;
+		std::list<std::string>::iterator Use;
+	};
+
 	std::string m_currentKey;
 	std::string m_currentTitle;
 	std::filesystem::path m_currentDirectory;
@@ -121,7 +158,7 @@ private:
 	float m_zoom;
 
 	std::vector<std::filesystem::path> m_selections;
-	int m_selectedFileItem;
+	std::filesystem::path m_selectedFileItem;
 	void m_select(const std::filesystem::path& path, bool isCtrlDown = false);
 
 	std::vector<std::filesystem::path> m_result;
@@ -138,22 +175,33 @@ private:
 	void* m_getIcon(const std::filesystem::path& path);
 	void m_clearIcons();
 	void m_refreshIconPreview();
-	void m_clearIconPreview();
 
-	std::thread* m_previewLoader;
-	bool m_previewLoaderRunning;
+	std::shared_ptr<PreviewJob> m_previewLoader;
+	std::unordered_set<std::string> m_previewRequests;
+	std::unordered_map<std::string, ThumbnailTexture> m_thumbnails; // kept across dialog sessions
+	std::list<std::string> m_thumbnailUse;                          // most recently drawn first
 	void m_stopPreviewLoader();
-	void m_loadPreview();
+	void m_requestPreview(const FileData& data);
+	void m_pollPreviews();
+	const ThumbnailTexture* m_getPreview(const FileData& data);
+	void m_clearThumbnails();
+	static void m_loadPreview(std::shared_ptr<PreviewJob> job);
 
 	std::vector<FileTreeNode*> m_treeCache;
+	std::vector<std::pair<FileTreeNode*, std::shared_ptr<ListingJob>>> m_treeListings;
 	void m_clearTree(FileTreeNode* node);
 	void m_renderTree(FileTreeNode* node);
 
 	unsigned int m_sortColumn;
 	unsigned int m_sortDirection;
 	std::vector<FileData> m_content;
+	std::shared_ptr<ListingJob> m_listing;
 	void m_setDirectory(const std::filesystem::path& p, bool addHistory = true);
 	void m_sortContent(unsigned int column, unsigned int sortDirection);
+	void m_mergeContent(size_t firstNew);
+	void m_pollListings();
+	void m_cancelListings(bool includeTree);
+	static void m_runListing(std::shared_ptr<ListingJob> job);
 	void m_renderContent();
 
 	void m_renderPopups();
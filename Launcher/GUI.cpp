@@ -29,6 +29,9 @@ GUI::GUI(const CorePtr& core) noexcept :
 
     Window->SetTitle("NeoDoa Launcher");
 
+    presence.Subscribe(ProjectPresence::TopicPrefix);
+    presencePoller.Register(&presence);
+
     stbi_set_flip_vertically_on_load(true);
     { // Load launcher logo
         int w, h, nrChannels;
@@ -154,6 +157,7 @@ void GUI::Prepare() {
 
 void GUI::operator() (float delta) {
     this->delta = delta;
+    PollOpenProjects();
     Prepare();
 
     ImGui::PushClipRect({}, {}, false);
@@ -533,28 +537,34 @@ void GUI::SortCollectionBySpec(const ImGuiTableColumnSortSpecs& spec) noexcept {
     }
 }
 
-bool GUI::IsProjectAlreadyOpen(const ProjectData& project) noexcept {
+void GUI::PollOpenProjects() noexcept {
     using namespace std::chrono_literals;
-    auto maxRequestReplies{ projectDataCollection.size() };
-
-    for (size_t i = 0; i < maxRequestReplies; i++) {
-        request.Send("request_project_path", SendFlag::DontWait);
+    auto now = std::chrono::steady_clock::now();
+
+    while (presencePoller.Poll(0ms) > 0) {
+        std::string_view message = presence.Receive(ReceiveFlag::DontWait);
+        if (message == "") { break; }
+
+        if (message.starts_with(ProjectPresence::OpenedTopic)) {
+            message.remove_prefix(ProjectPresence::OpenedTopic.size());
+            openProjects.insert_or_assign(trim_copy(std::string(message)), now);
+        } else if (message.starts_with(ProjectPresence::HeartbeatTopic)) {
+            message.remove_prefix(ProjectPresence::HeartbeatTopic.size());
+            openProjects.insert_or_assign(trim_copy(std::string(message)), now);
+        } else if (message.starts_with(ProjectPresence::ClosedTopic)) {
+            message.remove_prefix(ProjectPresence::ClosedTopic.size());
+            openProjects.erase(trim_copy(std::string(message)));
+        }
     }
 
-    std::this_thread::sleep_for(150ms); // wait for replies to be sent.
-
-    std::vector<std::string> openProjects{};
-    for (size_t i = 0; i < maxRequestReplies; i++) {
-        auto path = reply.Receive(ReceiveFlag::DontWait);
-        if (path == "") { continue; }
+    std::erase_if(openProjects, [now](const auto& entry) {
+        return now - entry.second > ProjectPresence::Timeout;
+    });
+}
 
-        std::string s = std::string(path);
-        openProjects.push_back(trim(s));
-    }
+bool GUI::IsProjectAlreadyOpen(const ProjectData& project) noexcept {
+    PollOpenProjects();
 
     std::string absolutePath = std::string(project.AbsolutePath).append(project.Name).append(Assets::ProjectExtension);
-    auto search = std::ranges::find_if(openProjects, [&absolutePath](auto& elem) {
-        return elem == absolutePath;
-    });
-    return search != openProjects.end();
+    return openProjects.contains(absolutePath);
 }
\ No newline at end of file
@@ -1,11 +1,14 @@
 #pragma once
 
+#include <chrono>
 #include <string>
 #include <vector>
+#include <unordered_map>
 
 #include <tinyxml2.h>
 
 #include <Utility/SimpleSocket.hpp>
+#include <Utility/ProjectPresence.hpp>
 
 #include <Engine/Core.hpp>
 #include <Engine/FileNode.hpp>
@@ -69,8 +72,10 @@ private:
     void SortCollectionBySpec(const ImGuiTableColumnSortSpecs& spec) noexcept;
 
     //- Sockets -//
-    ServerSocket request{ "tcp://*:5555", SocketType::Push };
-    ServerSocket reply{ "tcp://*:5556", SocketType::Pull };
+    ServerSocket presence{ ProjectPresence::SubscriberAddress, SocketType::Subscriber };
+    Poller presencePoller{};
+    std::unordered_map<std::string, std::chrono::steady_clock::time_point> openProjects{};
+    void PollOpenProjects() noexcept;
     bool IsProjectAlreadyOpen(const ProjectData& project) noexcept;
     //- Sockets -//
 
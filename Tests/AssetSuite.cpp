@@ -0,0 +1,124 @@
+#include <Tests/Suites.hpp>
+
+#include <array>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+#include <Engine/Assets.hpp>
+#include <Engine/Project.hpp>
+#include <Engine/Texture.hpp>
+#include <Engine/AssetBridge.hpp>
+
+#include <Tests/Test.hpp>
+
+static constexpr size_t TEXTURE_COUNT{ 3 };
+
+/* A throwaway workspace with TEXTURE_COUNT copies of the missing texture, imported into a bridge of its own. */
+struct TextureWorkspace {
+    std::filesystem::path PreviousWorkingDirectory{ std::filesystem::current_path() };
+    std::filesystem::path Workspace{ std::filesystem::temp_directory_path() / "NeoDoaAssetSuite" };
+    std::vector<UUID> IDs{};
+
+    TextureWorkspace() {
+        std::filesystem::remove_all(Workspace);
+        std::filesystem::create_directories(Workspace);
+        const EncodedTextureData encoded{ Texture::Copy(Texture::Missing()).Serialize(TextureEncoding::PNG) };
+        for (size_t i = 0; i < TEXTURE_COUNT; i++) {
+            std::ofstream file{ Workspace / ("Texture" + std::to_string(i) + Assets::TextureExtensionPNG), std::ios::binary };
+            file.write(reinterpret_cast<const char*>(encoded.EncodedData.data()), static_cast<std::streamsize>(encoded.EncodedData.size()));
+        }
+    }
+    ~TextureWorkspace() {
+        std::filesystem::current_path(PreviousWorkingDirectory); // Assets moves into the workspace
+        std::filesystem::remove_all(Workspace);
+    }
+};
+
+static void RunGPUMemoryBudgetTests(TestRunner& runner) {
+    runner.Run("gpu_textures.evicts_least_recently_fetched", [&] {
+        TextureWorkspace workspace;
+        Project project{ workspace.Workspace, "AssetSuite" };
+        AssetGPUBridge bridge;
+        Assets assets{ project, bridge };
+        assets.EnsureDeserialization();
+
+        GPUTextures& textures{ bridge.GetTextures() };
+        const std::vector<UUID>& ids{ assets.TextureAssetIDs() };
+        DOA_CHECK(runner, ids.size() == TEXTURE_COUNT);
+        if (ids.size() != TEXTURE_COUNT) { return; }
+
+        std::array<const GPUTexture*, TEXTURE_COUNT> objects{};
+        for (size_t i = 0; i < TEXTURE_COUNT; i++) {
+            objects[i] = textures.Query(ids[i]);
+            DOA_CHECK(runner, objects[i] != nullptr);
+        }
+        const size_t bytes{ objects[0]->MemorySize() };
+        DOA_CHECK(runner, bytes > 0);
+        DOA_CHECK(runner, bridge.GetMemoryBudget().Usage == TEXTURE_COUNT * bytes);
+        DOA_CHECK(runner, textures.ResidentCount() == TEXTURE_COUNT);
+
+        // Fetched in order, the first is the least recently used.
+        bridge.SetMemoryBudget((TEXTURE_COUNT - 1) * bytes);
+        bridge.EvictToBudget();
+        DOA_CHECK(runner, textures.Exists(ids[0]) && !textures.IsResident(ids[0]));
+        DOA_CHECK(runner, textures.IsResident(ids[1]) && textures.IsResident(ids[2]));
+        DOA_CHECK(runner, textures.ResidentCount() == TEXTURE_COUNT - 1);
+        DOA_CHECK(runner, bridge.GetMemoryBudget().Usage == (TEXTURE_COUNT - 1) * bytes);
+        DOA_CHECK(runner, bridge.GetMemoryBudget().Evictions == 1);
+
+        // Evicting one object moves none of the others.
+        DOA_CHECK(runner, textures.Query(ids[1]) == objects[1]);
+        DOA_CHECK(runner, textures.Query(ids[2]) == objects[2]);
+
+        // Fetching an evicted object re-allocates it, over budget until the next eviction.
+        const GPUTexture& reallocated{ textures.Fetch(ids[0]) };
+        DOA_CHECK(runner, reallocated.MemorySize() == bytes);
+        DOA_CHECK(runner, textures.IsResident(ids[0]));
+        DOA_CHECK(runner, bridge.GetMemoryBudget().Reallocations == 1);
+        DOA_CHECK(runner, bridge.GetMemoryBudget().IsOverBudget());
+        DOA_CHECK(runner, bridge.GetMemoryBudget().Peak == TEXTURE_COUNT * bytes);
+        DOA_CHECK(runner, textures.Query(ids[1]) == objects[1]);
+        DOA_CHECK(runner, textures.Query(ids[2]) == objects[2]);
+
+        // Queried 0, 1, 2 since, now the first is the most recently used.
+        textures.Query(ids[0]);
+        bridge.EvictToBudget();
+        DOA_CHECK(runner, !textures.IsResident(ids[1]));
+        DOA_CHECK(runner, textures.IsResident(ids[0]) && textures.IsResident(ids[2]));
+        DOA_CHECK(runner, textures.Query(ids[2]) == objects[2]);
+        DOA_CHECK(runner, bridge.GetMemoryBudget().Evictions == 2);
+    });
+    runner.Run("gpu_textures.deallocate_releases_memory", [&] {
+        TextureWorkspace workspace;
+        Project project{ workspace.Workspace, "AssetSuite" };
+        AssetGPUBridge bridge;
+        Assets assets{ project, bridge };
+        assets.EnsureDeserialization();
+
+        GPUTextures& textures{ bridge.GetTextures() };
+        const std::vector<UUID> ids{ assets.TextureAssetIDs() };
+        DOA_CHECK(runner, ids.size() == TEXTURE_COUNT);
+        if (ids.size() != TEXTURE_COUNT) { return; }
+
+        const size_t bytes{ textures.Fetch(ids[0]).MemorySize() };
+        bridge.SetMemoryBudget(0);
+        bridge.EvictToBudget();
+        DOA_CHECK(runner, textures.ResidentCount() == 0);
+        DOA_CHECK(runner, bridge.GetMemoryBudget().Usage == 0);
+
+        textures.Fetch(ids[1]);
+        textures.Deallocate(ids[1]);
+        textures.Deallocate(ids[2]); // evicted, only its residency is left
+        DOA_CHECK(runner, !textures.Exists(ids[1]) && !textures.Exists(ids[2]));
+        DOA_CHECK(runner, textures.Query(ids[1]) == nullptr);
+        DOA_CHECK(runner, textures.Exists(ids[0]));
+        DOA_CHECK(runner, bridge.GetMemoryBudget().Usage == 0);
+        DOA_CHECK(runner, bridge.GetMemoryBudget().Peak >= TEXTURE_COUNT * bytes);
+    });
+}
+
+void RunAssetSuite(TestRunner& runner) {
+    RunGPUMemoryBudgetTests(runner);
+}
@@ -0,0 +1,364 @@
+#include <Tests/Suites.hpp>
+
+#include <set>
+#include <array>
+#include <chrono>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+
+#include <Engine/Graphics.hpp>
+#include <Engine/GPUBuffer.hpp>
+#include <Engine/GPUPipeline.hpp>
+#include <Engine/GPUFrameBuffer.hpp>
+#include <Engine/GPUObjectCache.hpp>
+#include <Engine/GraphicsNone.hpp>
+#include <Engine/GPURingBuffer.hpp>
+#include <Engine/GPUReadbackQueue.hpp>
+#include <Engine/GPURenderTargetPool.hpp>
+
+#include <Tests/Test.hpp>
+
+static void RunRingBufferTests(TestRunner& runner) {
+    runner.Run("ring_buffer.aligned_allocations_per_region", [&] {
+        const size_t alignment{ Graphics::UniformBufferOffsetAlignment() };
+        GPURingBuffer ring{ 4 * alignment, "Test Ring" };
+        DOA_CHECK(runner, ring.RegionSize() == 4 * alignment);
+        DOA_CHECK(runner, ring.Buffer().SizeBytes == GPURingBuffer::FRAMES_IN_FLIGHT * ring.RegionSize());
+
+        std::set<size_t> regionStarts;
+        for (size_t frame = 0; frame < 2 * GPURingBuffer::FRAMES_IN_FLIGHT; frame++) {
+            ring.BeginFrame();
+            const GPURingBuffer::Allocation first{ ring.Allocate(1) };
+            const GPURingBuffer::Allocation second{ ring.Allocate(alignment + 1) };
+            DOA_CHECK(runner, first.OffsetBytes % alignment == 0);
+            DOA_CHECK(runner, second.OffsetBytes % alignment == 0);
+            DOA_CHECK(runner, second.OffsetBytes == first.OffsetBytes + alignment);
+            DOA_CHECK(runner, second.SizeBytes == alignment + 1);
+            DOA_CHECK(runner, ring.RegionUsage() == 3 * alignment);
+            DOA_CHECK(runner, first.OffsetBytes % ring.RegionSize() == 0); // a frame starts at its region's start
+
+            // Data points into the mapping at the offset the buffer is bound with.
+            const uint32_t value{ static_cast<uint32_t>(frame) };
+            std::memcpy(second.Data, &value, sizeof(value));
+            DOA_CHECK(runner, std::memcmp(static_cast<const std::byte*>(ring.Buffer().MappedData) + second.OffsetBytes, &value, sizeof(value)) == 0);
+
+            regionStarts.insert(first.OffsetBytes);
+            ring.EndFrame();
+        }
+        DOA_CHECK(runner, regionStarts.size() == GPURingBuffer::FRAMES_IN_FLIGHT);
+        DOA_CHECK(runner, ring.GrowCount() == 0);
+        DOA_CHECK(runner, ring.StallCount() == 0); // the no-op backend's fences are always signaled
+    });
+    runner.Run("ring_buffer.grows_mid_frame", [&] {
+        const size_t alignment{ Graphics::UniformBufferOffsetAlignment() };
+        GPURingBuffer ring{ 2 * alignment, "Test Ring" };
+        ring.BeginFrame();
+        ring.Allocate(alignment);
+        ring.Allocate(alignment);
+        const GPURingBuffer::Allocation grown{ ring.Allocate(3 * alignment) };
+        DOA_CHECK(runner, ring.GrowCount() == 1);
+        DOA_CHECK(runner, ring.RegionSize() >= 5 * alignment);
+        DOA_CHECK(runner, ring.RegionUsage() == 5 * alignment); // what was used before growing still counts
+        DOA_CHECK(runner, grown.OffsetBytes + grown.SizeBytes <= ring.Buffer().SizeBytes);
+        DOA_CHECK(runner, ring.Buffer().SizeBytes == GPURingBuffer::FRAMES_IN_FLIGHT * ring.RegionSize());
+        ring.EndFrame();
+
+        ring.BeginFrame();
+        ring.Allocate(5 * alignment);
+        DOA_CHECK(runner, ring.GrowCount() == 1); // fits the grown region
+        ring.EndFrame();
+    });
+}
+
+/* Only mapped buffers hold a handle on the no-op backend, everything else is destroyed without retiring. */
+static GPUBuffer BuildMappedBuffer() {
+    GPUBufferBuilder builder;
+    auto&& [buffer, messages] = builder
+        .SetName("Test Buffer")
+        .SetProperties(BufferProperties::WriteableFromCPU | BufferProperties::Persistent | BufferProperties::Coherent)
+        .SetStorage(64, nullptr)
+        .Build();
+    return std::move(buffer.value());
+}
+
+static void RunRetirementTests(TestRunner& runner) {
+    runner.Run("retirement.delayed_and_budgeted", [&] {
+        Graphics::FlushRetired();
+        Graphics::SetDestructionBudget(2);
+        {
+            std::vector<GPUBuffer> buffers;
+            for (int i = 0; i < 5; i++) {
+                buffers.push_back(BuildMappedBuffer());
+            }
+        }
+        DOA_CHECK(runner, Graphics::GetRetirementStats().Pending == 5);
+
+        for (uint64_t frame = 0; frame < Graphics::RETIREMENT_DELAY; frame++) {
+            Graphics::RetireFrame();
+            DOA_CHECK(runner, Graphics::GetRetirementStats().DestroyedLastFrame == 0);
+        }
+        for (size_t destroyed : { 2, 2, 1, 0 }) {
+            Graphics::RetireFrame();
+            DOA_CHECK(runner, Graphics::GetRetirementStats().DestroyedLastFrame == destroyed);
+        }
+        DOA_CHECK(runner, Graphics::GetRetirementStats().Pending == 0);
+        Graphics::SetDestructionBudget(Graphics::DEFAULT_DESTRUCTION_BUDGET);
+    });
+    runner.Run("retirement.flush_and_empty_resources", [&] {
+        { GPUBuffer empty; } // holds no handle, nothing to wait for
+        DOA_CHECK(runner, Graphics::GetRetirementStats().Pending == 0);
+
+        { GPUBuffer buffer{ BuildMappedBuffer() }; }
+        DOA_CHECK(runner, Graphics::GetRetirementStats().Pending == 1);
+        Graphics::FlushRetired();
+        DOA_CHECK(runner, Graphics::GetRetirementStats().Pending == 0);
+    });
+}
+
+static void RunRenderTargetPoolTests(TestRunner& runner) {
+    using namespace std::chrono_literals;
+    using Description = GPURenderTargetPool::Description;
+    static constexpr Description MULTISAMPLED{ .ColorFormat = DataFormat::RGBA16F, .DepthStencilFormat = DataFormat::DEPTH32F_STENCIL8, .Samples = Multisample::x8 };
+
+    runner.Run("render_target_pool.buckets", [&] {
+        DOA_CHECK(runner, (GPURenderTargetPool::BucketOf({ 0, 129 }) == Resolution{ 128, 256 }));
+        DOA_CHECK(runner, (GPURenderTargetPool::BucketOf({ 128, 128 }) == Resolution{ 128, 128 }));
+        DOA_CHECK(runner, (GPURenderTargetPool::BucketOf({ 500, 300 }) == Resolution{ 512, 384 }));
+    });
+    runner.Run("render_target_pool.resize_hysteresis", [&] {
+        const GPURenderTargetPool::Clock::time_point start{};
+        GPURenderTargetPool pool;
+        {
+            GPUPooledRenderTarget target{ pool, MULTISAMPLED, "Test Target" };
+            DOA_CHECK(runner, target.Resize({ 500, 300 }, start));
+            DOA_CHECK(runner, (target.Extent() == Resolution{ 512, 384 }));
+            DOA_CHECK(runner, (target.Size() == Resolution{ 500, 300 }));
+            DOA_CHECK(runner, target.FrameBuffer().ColorAttachments[0].has_value());
+
+            // Dragging within the bucket keeps the target.
+            for (unsigned width = 500; width > 400; width--) {
+                DOA_CHECK(runner, !target.Resize({ width, 300 }, start + 1ms * (500 - width)));
+            }
+            // Growing past it swaps at once, the old target waits in the pool.
+            DOA_CHECK(runner, target.Resize({ 600, 300 }, start + 200ms));
+            DOA_CHECK(runner, (target.Extent() == Resolution{ 640, 384 }));
+            DOA_CHECK(runner, pool.FreeCount() == 1);
+
+            // Shrinking waits SHRINK_DELAY in the same smaller bucket, a different one restarts the wait.
+            DOA_CHECK(runner, !target.Resize({ 300, 300 }, start + 300ms));
+            DOA_CHECK(runner, !target.Resize({ 300, 300 }, start + 900ms));
+            DOA_CHECK(runner, !target.Resize({ 200, 300 }, start + 1000ms));
+            DOA_CHECK(runner, !target.Resize({ 200, 300 }, start + 1000ms + GPUPooledRenderTarget::SHRINK_DELAY - 100ms));
+            DOA_CHECK(runner, target.Resize({ 200, 300 }, start + 1000ms + GPUPooledRenderTarget::SHRINK_DELAY));
+            DOA_CHECK(runner, (target.Extent() == Resolution{ 256, 384 }));
+            DOA_CHECK(runner, pool.AllocationCount() == 3);
+
+            // Back to the first bucket reuses its released target.
+            DOA_CHECK(runner, target.Resize({ 500, 300 }, start + 2100ms));
+            DOA_CHECK(runner, pool.ReuseCount() == 1);
+            DOA_CHECK(runner, pool.AllocationCount() == 3);
+
+            pool.Trim(start + 2100ms + GPURenderTargetPool::IDLE_TIMEOUT);
+            DOA_CHECK(runner, pool.FreeCount() == 0);
+        }
+        DOA_CHECK(runner, pool.FreeCount() == 1); // released on destruction
+    });
+    runner.Run("render_target_pool.descriptions_do_not_mix", [&] {
+        GPURenderTargetPool pool;
+        pool.Release(MULTISAMPLED, { 128, 128 }, pool.Acquire(MULTISAMPLED, { 128, 128 }));
+        GPUFrameBuffer other{ pool.Acquire(Description{}, { 128, 128 }) };
+        DOA_CHECK(runner, pool.ReuseCount() == 0);
+        DOA_CHECK(runner, pool.FreeCount() == 1);
+        GPUFrameBuffer same{ pool.Acquire(MULTISAMPLED, { 128, 128 }) };
+        DOA_CHECK(runner, pool.ReuseCount() == 1);
+        DOA_CHECK(runner, pool.AllocationCount() == 2);
+    });
+}
+
+static GPUBuffer BuildArgumentBuffer(size_t sizeBytes) {
+    GPUBufferBuilder builder;
+    auto&& [buffer, messages] = builder
+        .SetName("Test Arguments")
+        .SetStorage(sizeBytes, nullptr)
+        .Build();
+    return std::move(buffer.value());
+}
+
+static void RunIndirectTests(TestRunner& runner) {
+    using Kind = Graphics::None::RecordedCommand::Kind;
+
+    runner.Run("indirect.argument_size_follows_bound_pipeline", [&] {
+        GPUBuffer indices{ BuildArgumentBuffer(64) };
+        GPUPipelineBuilder indexedBuilder;
+        GPUPipeline indexed{ std::move(indexedBuilder.SetIndexBuffer(indices).Build().first.value()) };
+        GPUPipelineBuilder plainBuilder;
+        GPUPipeline plain{ std::move(plainBuilder.Build().first.value()) };
+
+        Graphics::BindPipeline(indexed);
+        DOA_CHECK(runner, Graphics::IndirectRenderArgumentsSize() == sizeof(IndirectIndexedRenderArguments));
+        Graphics::BindPipeline(plain);
+        DOA_CHECK(runner, Graphics::IndirectRenderArgumentsSize() == sizeof(IndirectRenderArguments));
+    });
+    runner.Run("indirect.argument_ranges", [&] {
+        static constexpr size_t INDEXED{ sizeof(IndirectIndexedRenderArguments) };
+        GPUBuffer arguments{ BuildArgumentBuffer(3 * INDEXED) };
+        DOA_CHECK(runner, Graphics::AreIndirectArgumentsInRange(arguments, INDEXED, 2 * INDEXED));
+        DOA_CHECK(runner, !Graphics::AreIndirectArgumentsInRange(arguments, INDEXED, 2 * INDEXED + 4));
+        DOA_CHECK(runner, !Graphics::AreIndirectArgumentsInRange(arguments, INDEXED, 2));                  // misaligned
+        DOA_CHECK(runner, Graphics::AreIndirectArgumentsInRange(arguments, INDEXED, 0, 3));
+        DOA_CHECK(runner, !Graphics::AreIndirectArgumentsInRange(arguments, INDEXED, 0, 4));
+        DOA_CHECK(runner, !Graphics::AreIndirectArgumentsInRange(arguments, INDEXED, 0, -1));
+        DOA_CHECK(runner, Graphics::AreIndirectArgumentsInRange(arguments, INDEXED, 4 * INDEXED, 0));        // nothing is read
+        DOA_CHECK(runner, Graphics::AreIndirectArgumentsInRange(arguments, INDEXED, 0, 2, 2 * INDEXED));
+        DOA_CHECK(runner, !Graphics::AreIndirectArgumentsInRange(arguments, INDEXED, 0, 3, 2 * INDEXED));
+        DOA_CHECK(runner, !Graphics::AreIndirectArgumentsInRange(arguments, INDEXED, 0, 2, 6));              // misaligned stride
+        DOA_CHECK(runner, Graphics::AreIndirectArgumentsInRange(arguments, INDEXED, 0, 3, 4));               // stride below the size is packed
+
+        // The 16 byte layout of non-indexed draws fits where the 20 byte one does not.
+        GPUBuffer small{ BuildArgumentBuffer(2 * sizeof(IndirectRenderArguments)) };
+        DOA_CHECK(runner, Graphics::AreIndirectArgumentsInRange(small, sizeof(IndirectRenderArguments), 0, 2));
+        DOA_CHECK(runner, !Graphics::AreIndirectArgumentsInRange(small, INDEXED, 0, 2));
+    });
+    runner.Run("indirect.no_op_backend_records_commands", [&] {
+        GPUBuffer arguments{ BuildArgumentBuffer(4 * sizeof(IndirectIndexedRenderArguments)) };
+        GPUPipelineBuilder builder;
+        GPUPipeline pipeline{ std::move(builder.SetIndexBuffer(arguments).Build().first.value()) };
+
+        Graphics::None::SetCommandRecording(true);
+        Graphics::None::ClearRecordedCommands();
+        Graphics::Dispatch(8, 4);
+        Graphics::Barrier(BarrierBits::Command);
+        Graphics::DispatchIndirect(arguments, sizeof(IndirectDispatchArguments));
+        Graphics::BindPipeline(pipeline);
+        Graphics::RenderIndirect(arguments, sizeof(IndirectIndexedRenderArguments));
+        Graphics::RenderMultiIndirect(arguments, 2, 0, 2 * sizeof(IndirectIndexedRenderArguments));
+
+        const std::vector<Graphics::None::RecordedCommand> commands{ Graphics::None::RecordedCommands() };
+        Graphics::None::SetCommandRecording(false);
+        DOA_CHECK(runner, commands.size() == 5);
+        if (commands.size() != 5) { return; }
+        DOA_CHECK(runner, commands[0].Type == Kind::Dispatch);
+        DOA_CHECK(runner, commands[0].GroupsX == 8 && commands[0].GroupsY == 4 && commands[0].GroupsZ == 1);
+        DOA_CHECK(runner, commands[1].Type == Kind::Barrier && commands[1].Barriers == BarrierBits::Command);
+        DOA_CHECK(runner, commands[2].Type == Kind::DispatchIndirect && commands[2].Arguments == &arguments);
+        DOA_CHECK(runner, commands[2].OffsetBytes == sizeof(IndirectDispatchArguments));
+        DOA_CHECK(runner, commands[3].Type == Kind::RenderIndirect && commands[3].OffsetBytes == sizeof(IndirectIndexedRenderArguments));
+        DOA_CHECK(runner, commands[4].Type == Kind::RenderMultiIndirect && commands[4].DrawCount == 2);
+        DOA_CHECK(runner, commands[4].StrideBytes == 2 * sizeof(IndirectIndexedRenderArguments));
+
+        Graphics::None::ClearRecordedCommands();
+        Graphics::None::SetCommandRecording(false);
+        Graphics::Dispatch(1);
+        DOA_CHECK(runner, Graphics::None::RecordedCommands().empty());
+    });
+}
+
+static void RunPipelineCacheTests(TestRunner& runner) {
+    runner.Run("pipeline_cache.viewport_is_not_pipeline_state", [&] {
+        using Kind = Graphics::None::RecordedCommand::Kind;
+        static constexpr std::array<Region, 3> VIEWPORTS{ { { 0, 0, 640, 480 }, { 0, 0, 1280, 720 }, { 0, 0, 640, 480 } } };
+
+        GPUPipelineCache cache;
+        GPUPipelineCache::Handle first;
+        Graphics::None::SetCommandRecording(true);
+        Graphics::None::ClearRecordedCommands();
+        for (const Region& viewport : VIEWPORTS) {
+            GPUPipelineBuilder builder;
+            builder.SetDepthTestEnabled(true).SetDepthWriteEnabled(true).SetMultisampleEnabled(true);
+            GPUPipelineCache::Handle pipeline{ cache.Get(builder).first };
+            DOA_CHECK(runner, pipeline != nullptr);
+            if (pipeline == nullptr) { break; }
+            if (first == nullptr) { first = pipeline; }
+            DOA_CHECK(runner, pipeline == first); // resizing builds nothing
+            Graphics::BindPipeline(*pipeline);
+            Graphics::SetViewport(viewport);
+        }
+        const std::vector<Graphics::None::RecordedCommand> commands{ Graphics::None::RecordedCommands() };
+        Graphics::None::ClearRecordedCommands();
+        Graphics::None::SetCommandRecording(false);
+
+        const GPUPipelineCache::Statistics statistics{ cache.GetStatistics() };
+        DOA_CHECK(runner, statistics.Misses == 1 && statistics.Hits == VIEWPORTS.size() - 1);
+        DOA_CHECK(runner, statistics.Entries == 1);
+        DOA_CHECK(runner, commands.size() == VIEWPORTS.size());
+        for (size_t i = 0; i < std::min(commands.size(), VIEWPORTS.size()); i++) {
+            DOA_CHECK(runner, commands[i].Type == Kind::Viewport && commands[i].Viewport == VIEWPORTS[i]);
+        }
+
+        GPUPipelineBuilder blended;
+        blended.SetDepthTestEnabled(true).SetDepthWriteEnabled(true).SetMultisampleEnabled(true).SetBlendEnabled(true);
+        DOA_CHECK(runner, cache.Get(blended).first != first);
+        DOA_CHECK(runner, cache.GetStatistics().Entries == 2);
+    });
+}
+
+static void RunReadbackTests(TestRunner& runner) {
+    runner.Run("readback.completes_in_order", [&] {
+        GPUReadbackQueue readbacks;
+        GPUFrameBuffer source;
+        int calls{ 0 };
+        GPUReadbackQueue::Ticket nested;
+        const GPUReadbackQueue::Ticket first{ readbacks.Enqueue(source, 0, { .Width = 4, .Height = 4 }, [&](RawDataView pixels, const PixelRegion& region) {
+            calls++;
+            DOA_CHECK(runner, pixels.size() == 4 * 4 * 4);
+            DOA_CHECK(runner, region.Width == 4 && region.Height == 4);
+            // Enqueued from a callback, completes on the next Update.
+            nested = readbacks.Enqueue(source, 0, { .Width = 1, .Height = 1 }, [&](RawDataView pixel, const PixelRegion&) {
+                calls++;
+                DOA_CHECK(runner, pixel.size() == 4);
+            });
+        }) };
+        const GPUReadbackQueue::Ticket kept{ readbacks.Enqueue(source, 0, { .Width = 512, .Height = 512, .Format = DataFormat::RGBA32F }) };
+        DOA_CHECK(runner, readbacks.IsPending(first) && readbacks.IsPending(kept));
+        DOA_CHECK(runner, readbacks.PendingCount() == 2);
+
+        readbacks.Update(); // the no-op backend's fences are always signaled
+        DOA_CHECK(runner, calls == 1);
+        DOA_CHECK(runner, !readbacks.IsPending(first) && !readbacks.IsComplete(first)); // handed to its callback and recycled
+        DOA_CHECK(runner, readbacks.IsPending(nested));
+        DOA_CHECK(runner, readbacks.IsComplete(kept));
+        DOA_CHECK(runner, readbacks.Data(kept).size() == 512 * 512 * 16);
+        DOA_CHECK(runner, readbacks.CompletedCount() == 1);
+
+        readbacks.Update();
+        DOA_CHECK(runner, calls == 2);
+        DOA_CHECK(runner, readbacks.PendingCount() == 0);
+        readbacks.Release(kept);
+        DOA_CHECK(runner, !readbacks.IsComplete(kept));
+        DOA_CHECK(runner, readbacks.CompletedCount() == 0);
+    });
+    runner.Run("readback.pools_buffers", [&] {
+        GPUReadbackQueue readbacks;
+        GPUFrameBuffer source;
+        const GPUReadbackQueue::Ticket large{ readbacks.Enqueue(source, 0, { .Width = 512, .Height = 512, .Format = DataFormat::RGBA32F }) };
+        readbacks.Flush();
+        readbacks.Release(large);
+        const size_t allocations{ readbacks.AllocationCount() };
+        DOA_CHECK(runner, readbacks.FreeBufferCount() >= 1);
+
+        // A smaller readback reuses the released buffer, dropping it while pending keeps nothing.
+        const GPUReadbackQueue::Ticket smaller{ readbacks.Enqueue(source, 0, { .Width = 300, .Height = 300, .Format = DataFormat::RGBA32F }) };
+        DOA_CHECK(runner, readbacks.AllocationCount() == allocations);
+        readbacks.Release(smaller);
+        DOA_CHECK(runner, readbacks.PendingCount() == 0);
+        DOA_CHECK(runner, !readbacks.IsPending(smaller));
+
+        for (size_t i = 0; i < 2 * GPUReadbackQueue::MAX_FREE_BUFFERS; i++) {
+            readbacks.Enqueue(source, 0, { .Width = 8, .Height = 8 }, [](RawDataView, const PixelRegion&) {});
+        }
+        readbacks.Flush();
+        DOA_CHECK(runner, readbacks.PendingCount() == 0);
+        DOA_CHECK(runner, readbacks.FreeBufferCount() <= GPUReadbackQueue::MAX_FREE_BUFFERS);
+    });
+}
+
+void RunGraphicsSuite(TestRunner& runner) {
+    RunRingBufferTests(runner);
+    RunRetirementTests(runner);
+    RunRenderTargetPoolTests(runner);
+    RunIndirectTests(runner);
+    RunPipelineCacheTests(runner);
+    RunReadbackTests(runner);
+}
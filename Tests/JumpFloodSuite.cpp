@@ -0,0 +1,164 @@
+#include <Tests/Suites.hpp>
+
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include <glm/glm.hpp>
+
+#include <Engine/Region.hpp>
+#include <Engine/Graphics.hpp>
+#include <Engine/JumpFlood.hpp>
+#include <Engine/GraphicsNone.hpp>
+#include <Engine/RenderGraph.hpp>
+#include <Engine/GPURenderTargetPool.hpp>
+
+#include <Tests/Test.hpp>
+
+/* A few random rectangles and scattered pixels, the shapes a selection rasterizes to. */
+static std::vector<uint8_t> RandomMask(std::mt19937& random, Resolution size) {
+    std::vector<uint8_t> mask(size_t{ size.Width } * size.Height, 0);
+    std::uniform_int_distribution<unsigned> x{ 0, size.Width - 1 }, y{ 0, size.Height - 1 };
+    std::uniform_int_distribution<unsigned> extent{ 1, 6 }, count{ 0, 3 };
+    for (unsigned rectangles = count(random); rectangles > 0; rectangles--) {
+        const unsigned left{ x(random) }, top{ y(random) };
+        const unsigned right{ std::min(left + extent(random), size.Width) }, bottom{ std::min(top + extent(random), size.Height) };
+        for (unsigned py = top; py < bottom; py++) {
+            std::fill_n(mask.begin() + py * size.Width + left, right - left, uint8_t{ 1 });
+        }
+    }
+    for (unsigned pixels = count(random); pixels > 0; pixels--) {
+        mask[size_t{ y(random) } * size.Width + x(random)] = 1;
+    }
+    return mask;
+}
+
+/* The seeds left after every flood pass, what the composite pass samples. */
+static std::vector<glm::vec2> RunFlood(std::span<const uint8_t> mask, Resolution size, float width) {
+    std::vector<glm::vec2> seeds{ JumpFlood::Seed(mask, size) };
+    std::vector<glm::vec2> flooded(seeds.size());
+    for (unsigned step : JumpFlood::FloodSteps(width, size)) {
+        JumpFlood::Flood(seeds, flooded, size, step);
+        seeds.swap(flooded);
+    }
+    return seeds;
+}
+
+static void RunJumpFloodTests(TestRunner& runner) {
+    runner.Run("jump_flood.steps_reach_width", [&] {
+        for (Resolution size : { Resolution{ 1920, 1080 }, Resolution{ 64, 16 }, Resolution{ 3, 200 } }) {
+            for (float width : { 0.0f, 0.5f, 1.0f, 3.0f, 7.5f, 16.0f, 63.0f, JumpFlood::MAX_WIDTH, 1000.0f }) {
+                const std::vector<unsigned> steps{ JumpFlood::FloodSteps(width, size) };
+                DOA_CHECK(runner, !steps.empty() && steps.back() == 1);
+                if (steps.empty()) { continue; }
+
+                // Halving down to 1, then 2 and 1 again unless the halving was a single step 1 pass.
+                const size_t halving{ steps.size() > 1 ? steps.size() - 2 : 1 };
+                DOA_CHECK(runner, steps[halving - 1] == 1);
+                for (size_t i = 1; i < halving; i++) {
+                    DOA_CHECK(runner, steps[i] * 2 == steps[i - 1]);
+                }
+                if (halving < steps.size()) {
+                    DOA_CHECK(runner, steps[halving] == 2);
+                }
+
+                // Steps k, k/2, ..., 1 carry a seed up to 2k - 1 pixels, the composite needs ceil(width + 0.5).
+                const unsigned longest{ std::max(size.Width, size.Height) };
+                const unsigned needed{ static_cast<unsigned>(std::ceil(std::clamp(width, 0.0f, JumpFlood::MAX_WIDTH) + 0.5f)) };
+                DOA_CHECK(runner, 2 * steps.front() - 1 >= std::min(needed, longest - 1));
+                DOA_CHECK(runner, steps.size() <= static_cast<size_t>(std::bit_width(longest)) + 2);
+            }
+        }
+        DOA_CHECK(runner, JumpFlood::FloodSteps(3.0f, { 1920, 1080 }).size() == 5); // 4, 2, 1 for 4 pixels, then 2, 1
+        DOA_CHECK(runner, JumpFlood::FloodSteps(JumpFlood::MAX_WIDTH, { 1920, 1080 }).size() == 9);
+        DOA_CHECK(runner, JumpFlood::FloodSteps(0.0f, { 1920, 1080 }).size() == 1); // a single pixel needs no correction
+        DOA_CHECK(runner, JumpFlood::FloodSteps(3.0f, { 1, 1 }).empty()); // nothing to reach
+    });
+    runner.Run("jump_flood.matches_brute_force", [&] {
+        std::mt19937 random{ 0x0D0A };
+        std::uniform_int_distribution<unsigned> side{ 1, 48 };
+        std::uniform_real_distribution<float> widths{ 0.0f, 12.0f };
+        size_t compared{ 0 }, mismatched{ 0 };
+        for (int trial = 0; trial < 64; trial++) {
+            const Resolution size{ side(random), side(random) };
+            const float width{ widths(random) };
+            const std::vector<uint8_t> mask{ RandomMask(random, size) };
+            const std::vector<glm::vec2> flooded{ RunFlood(mask, size, width) };
+
+            for (unsigned y = 0; y < size.Height; y++) {
+                for (unsigned x = 0; x < size.Width; x++) {
+                    const glm::ivec2 pixel{ x, y };
+                    float nearest{ std::numeric_limits<float>::max() };
+                    for (unsigned sy = 0; sy < size.Height; sy++) {
+                        for (unsigned sx = 0; sx < size.Width; sx++) {
+                            if (mask[size_t{ sy } * size.Width + sx] == 0) { continue; }
+                            nearest = std::min(nearest, glm::length(glm::vec2(sx, sy) - glm::vec2(pixel)));
+                        }
+                    }
+                    const glm::vec2 seed{ flooded[size_t{ y } * size.Width + x] };
+                    const float expected{ nearest == std::numeric_limits<float>::max() ? 0.0f : JumpFlood::Coverage(glm::vec2(pixel) + glm::vec2(nearest, 0.0f), pixel, width) };
+                    compared++;
+                    if (std::abs(JumpFlood::Coverage(seed, pixel, width) - expected) > 1e-4f) { mismatched++; }
+                }
+            }
+        }
+        DOA_CHECK(runner, compared > 10000);
+        DOA_CHECK(runner, mismatched == 0);
+    });
+    runner.Run("jump_flood.passes_independent_of_object_count", [&] {
+        using Kind = Graphics::None::RecordedCommand::Kind;
+        static constexpr Resolution EXTENT{ 512, 384 };
+        static constexpr Resolution SIZE{ 500, 300 };
+        static constexpr float WIDTH{ 3.0f };
+        const size_t floodPasses{ JumpFlood::FloodSteps(WIDTH, SIZE).size() };
+
+        GPURenderTargetPool pool;
+        GPUFrameBuffer output{ pool.Acquire({ .ColorFormat = DataFormat::RGBA16F, .SampledColor = true }, EXTENT) };
+        RenderGraph graph{ pool };
+        const Region viewport{ 0, 0, SIZE.Width, SIZE.Height };
+        for (size_t objects : { 1, 8, 256 }) {
+            size_t masks{ 0 }, floods{ 0 }, composites{ 0 }, draws{ 0 };
+            graph.Reset();
+            RenderGraph::Resource target{ graph.Import("Viewport", output, EXTENT) };
+            JumpFlood::AddPasses(graph, target, SIZE, WIDTH, {
+                .Mask = [&]() {
+                    masks++;
+                    for (size_t i = 0; i < objects; i++) {
+                        Graphics::Render(36);
+                        draws++;
+                    }
+                },
+                .Flood = [&](const GPUTexture&, Resolution size, unsigned) { floods++; DOA_CHECK(runner, size == SIZE); },
+                .Composite = [&](const GPUTexture&, Resolution) { composites++; }
+            });
+            graph.Compile();
+            DOA_CHECK(runner, graph.GetStatistics().Passes == 2 + floodPasses);
+            DOA_CHECK(runner, graph.GetStatistics().CulledPasses == 0);
+
+            Graphics::None::SetCommandRecording(true);
+            Graphics::None::ClearRecordedCommands();
+            graph.Execute();
+            const std::vector<Graphics::None::RecordedCommand> commands{ Graphics::None::RecordedCommands() };
+            Graphics::None::ClearRecordedCommands();
+            Graphics::None::SetCommandRecording(false);
+
+            // Every pass sets the viewport once, the objects only add draws to the mask pass.
+            const size_t viewports = std::ranges::count_if(commands, [](const auto& command) { return command.Type == Kind::Viewport; });
+            DOA_CHECK(runner, viewports == 2 + floodPasses);
+            for (const auto& command : commands) {
+                if (command.Type != Kind::Viewport) { continue; }
+                DOA_CHECK(runner, command.Viewport == viewport);
+            }
+            DOA_CHECK(runner, masks == 1 && floods == floodPasses && composites == 1);
+            DOA_CHECK(runner, draws == objects);
+        }
+    });
+}
+
+void RunJumpFloodSuite(TestRunner& runner) {
+    RunJumpFloodTests(runner);
+}
@@ -0,0 +1,141 @@
+#include <Tests/Suites.hpp>
+
+#include <string>
+
+#include <Engine/Graphics.hpp>
+#include <Engine/RenderGraph.hpp>
+#include <Engine/GPURenderTargetPool.hpp>
+
+#include <Tests/Test.hpp>
+
+using Description = GPURenderTargetPool::Description;
+
+static constexpr Resolution VIEWPORT_EXTENT{ 512, 384 };
+static constexpr Resolution SIZE{ 500, 300 };
+static constexpr Description MULTISAMPLED{ .ColorFormat = DataFormat::RGBA16F, .DepthStencilFormat = DataFormat::DEPTH32F_STENCIL8, .Samples = Multisample::x8 };
+static constexpr Description HDR{ .ColorFormat = DataFormat::RGBA16F, .SampledColor = true };
+
+/* Scene -> BlurH -> BlurV -> Composite into the viewport, Composite samples Scene too. Debug only feeds Probe,
+whose output nobody reads, Stats writes nothing but has side effects. Executed passes append their initial. */
+struct Frame {
+    RenderGraph::Resource Viewport, Scene, Horizontal, Vertical, Debug, Probe;
+    std::string Log{};
+};
+
+static void AddFrame(RenderGraph& graph, GPUFrameBuffer& viewport, Frame& frame, TestRunner& runner) {
+    frame.Viewport = graph.Import("Viewport", viewport, VIEWPORT_EXTENT);
+    graph.AddPass("Scene", [&](RenderGraph::PassBuilder& builder) {
+        frame.Scene = builder.Write(builder.Create("Scene", MULTISAMPLED, SIZE));
+    }, [&](RenderGraph::PassContext& context) {
+        frame.Log += 'S';
+        DOA_CHECK(runner, context.FrameBuffer(frame.Scene).DepthStencilAttachment.has_value());
+        DOA_CHECK(runner, context.Size(frame.Scene) == SIZE);
+    });
+    graph.AddPass("BlurH", [&](RenderGraph::PassBuilder& builder) {
+        builder.Read(frame.Scene);
+        frame.Horizontal = builder.Write(builder.Create("Horizontal", HDR, SIZE));
+    }, [&](RenderGraph::PassContext& context) {
+        frame.Log += 'H';
+        DOA_CHECK(runner, !context.Texture(frame.Scene).IsMultisampled()); // resolved before sampling
+    });
+    graph.AddPass("BlurV", [&](RenderGraph::PassBuilder& builder) {
+        builder.Read(frame.Horizontal);
+        frame.Vertical = builder.Write(builder.Create("Vertical", HDR, SIZE));
+    }, [&](RenderGraph::PassContext&) { frame.Log += 'V'; });
+    graph.AddPass("Debug", [&](RenderGraph::PassBuilder& builder) {
+        builder.Read(frame.Vertical);
+        frame.Debug = builder.Write(builder.Create("Debug", HDR, SIZE));
+    }, [&](RenderGraph::PassContext&) { frame.Log += 'D'; });
+    graph.AddPass("Probe", [&](RenderGraph::PassBuilder& builder) {
+        builder.Read(frame.Debug);
+        frame.Probe = builder.Write(builder.Create("Probe", HDR, SIZE));
+    }, [&](RenderGraph::PassContext&) { frame.Log += 'P'; });
+    graph.AddPass("Composite", [&](RenderGraph::PassBuilder& builder) {
+        builder.Read(frame.Vertical);
+        builder.Read(frame.Scene);
+        builder.Write(frame.Viewport);
+    }, [&](RenderGraph::PassContext&) { frame.Log += 'C'; });
+    graph.AddPass("Stats", [&](RenderGraph::PassBuilder& builder) {
+        builder.HasSideEffects();
+    }, [&](RenderGraph::PassContext&) { frame.Log += 'X'; });
+}
+
+static void RunRenderGraphTests(TestRunner& runner) {
+    runner.Run("render_graph.culls_passes_nobody_reads", [&] {
+        GPURenderTargetPool pool;
+        GPUFrameBuffer viewport{ pool.Acquire(HDR, VIEWPORT_EXTENT) };
+        RenderGraph graph{ pool };
+        Frame frame;
+        AddFrame(graph, viewport, frame, runner);
+        graph.Compile();
+
+        DOA_CHECK(runner, graph.IsCulled("Probe"));
+        DOA_CHECK(runner, graph.IsCulled("Debug")); // only Probe read its output
+        DOA_CHECK(runner, !graph.IsCulled("Scene") && !graph.IsCulled("Composite"));
+        DOA_CHECK(runner, !graph.IsCulled("Stats"));
+        DOA_CHECK(runner, graph.GetStatistics().Passes == 7);
+        DOA_CHECK(runner, graph.GetStatistics().CulledPasses == 2);
+
+        graph.Execute();
+        DOA_CHECK(runner, frame.Log == "SHVCX"); // in the order added, culled passes never run
+    });
+    runner.Run("render_graph.resolves_once_and_reuses_targets", [&] {
+        GPURenderTargetPool pool;
+        GPUFrameBuffer viewport{ pool.Acquire(HDR, VIEWPORT_EXTENT) };
+        RenderGraph graph{ pool };
+        size_t physicalTargets{ 0 };
+        for (int i = 0; i < 3; i++) {
+            Frame frame;
+            graph.Reset();
+            AddFrame(graph, viewport, frame, runner);
+            graph.Compile();
+
+            const RenderGraph::Statistics& statistics{ graph.GetStatistics() };
+            DOA_CHECK(runner, statistics.Resolves == 1); // BlurH and Composite share the resolved scene
+            DOA_CHECK(runner, statistics.TransientResources == 4); // Scene, its resolve, Horizontal, Vertical
+            DOA_CHECK(runner, statistics.PhysicalTargets <= statistics.TransientResources);
+            physicalTargets = statistics.PhysicalTargets;
+
+            graph.Execute();
+            DOA_CHECK(runner, frame.Log == "SHVCX");
+            DOA_CHECK(runner, pool.FreeCount() == statistics.PhysicalTargets); // all given back
+        }
+        DOA_CHECK(runner, pool.AllocationCount() == 1 + physicalTargets); // later frames allocate nothing
+        DOA_CHECK(runner, pool.ReuseCount() == 2 * physicalTargets);
+    });
+    runner.Run("render_graph.aliases_disjoint_lifetimes", [&] {
+        GPURenderTargetPool pool;
+        GPUFrameBuffer output{ pool.Acquire(HDR, VIEWPORT_EXTENT) };
+        RenderGraph graph{ pool };
+        RenderGraph::Resource viewport{ graph.Import("Viewport", output, VIEWPORT_EXTENT) };
+
+        // Every pass reads the previous one's target, so only neighbours are alive at once.
+        static constexpr int CHAIN{ 6 };
+        RenderGraph::Resource previous;
+        std::string log;
+        for (int i = 0; i < CHAIN; i++) {
+            graph.AddPass("Pass" + std::to_string(i), [&](RenderGraph::PassBuilder& builder) {
+                if (previous.IsValid()) {
+                    builder.Read(previous);
+                }
+                previous = builder.Write(builder.Create("Target" + std::to_string(i), HDR, SIZE));
+            }, [&log, i](RenderGraph::PassContext&) { log += static_cast<char>('0' + i); });
+        }
+        graph.AddBlitPass("Output", previous, viewport);
+        graph.Compile();
+
+        const RenderGraph::Statistics& statistics{ graph.GetStatistics() };
+        DOA_CHECK(runner, statistics.TransientResources == CHAIN);
+        DOA_CHECK(runner, statistics.PhysicalTargets == 2);
+        DOA_CHECK(runner, statistics.CulledPasses == 0);
+        DOA_CHECK(runner, statistics.Barriers == CHAIN); // each target, written then read once
+
+        graph.Execute();
+        DOA_CHECK(runner, log == "012345");
+        DOA_CHECK(runner, pool.AllocationCount() == 1 + 2);
+    });
+}
+
+void RunRenderGraphSuite(TestRunner& runner) {
+    RunRenderGraphTests(runner);
+}
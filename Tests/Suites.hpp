@@ -0,0 +1,10 @@
+#pragma once
+
+struct TestRunner;
+
+void RunAssetSuite(TestRunner& runner);
+void RunGraphicsSuite(TestRunner& runner);
+void RunJumpFloodSuite(TestRunner& runner);
+void RunRenderGraphSuite(TestRunner& runner);
+void RunUtilitySuite(TestRunner& runner);
+void RunVertexSuite(TestRunner& runner);
@@ -0,0 +1,39 @@
+#include <Tests/Test.hpp>
+
+#include <cstdio>
+
+// Printed rather than logged, release builds don't log to stdout and failures must show up there.
+
+TestRunner::TestRunner(TestSettings settings) noexcept :
+    settings(std::move(settings)) {}
+
+bool TestRunner::IsEnabled(std::string_view name) const noexcept {
+    return settings.Filter.empty() || name.find(settings.Filter) != std::string_view::npos;
+}
+
+void TestRunner::Run(std::string_view name, const std::function<void()>& body) {
+    if (!IsEnabled(name)) { return; }
+
+    current = name;
+    currentFailures = 0;
+    body();
+    runCount++;
+
+    if (currentFailures == 0) {
+        std::printf("%-48s passed\n", current.c_str());
+    } else {
+        std::printf("%-48s FAILED (%zu checks)\n", current.c_str(), currentFailures);
+        failed.push_back(std::move(current));
+    }
+    current.clear();
+}
+
+bool TestRunner::Check(bool condition, std::string_view expression, std::source_location location) {
+    if (condition) { return true; }
+    currentFailures++;
+    std::printf("%s:%u: check failed: %.*s\n", location.file_name(), static_cast<unsigned>(location.line()), static_cast<int>(expression.size()), expression.data());
+    return false;
+}
+
+size_t TestRunner::RunCount() const noexcept { return runCount; }
+size_t TestRunner::FailedCount() const noexcept { return failed.size(); }
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <string_view>
+#include <source_location>
+
+struct TestSettings {
+    /* Only tests whose name contains Filter run, empty runs everything. */
+    std::string Filter{};
+};
+
+struct TestRunner {
+
+    explicit TestRunner(TestSettings settings) noexcept;
+
+    bool IsEnabled(std::string_view name) const noexcept;
+
+    /* Runs body unless the test is filtered out. A test fails if any check made while it runs fails, it keeps
+    running after a failed check so one run reports every failure. */
+    void Run(std::string_view name, const std::function<void()>& body);
+
+    /* Records a failure of the running test unless condition holds, returns condition. Use DOA_CHECK. */
+    bool Check(bool condition, std::string_view expression, std::source_location location = std::source_location::current());
+
+    size_t RunCount() const noexcept;
+    size_t FailedCount() const noexcept;
+
+private:
+    TestSettings settings;
+    std::string current{};
+    size_t currentFailures{ 0 };
+    size_t runCount{ 0 };
+    std::vector<std::string> failed{};
+};
+
+#define DOA_CHECK(runner, condition) (runner).Check(static_cast<bool>(condition), #condition)
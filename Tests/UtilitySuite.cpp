@@ -0,0 +1,173 @@
+#include <Tests/Suites.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Utility/SlotArray.hpp>
+#include <Utility/UndoRedoStack.hpp>
+
+#include <Tests/Test.hpp>
+
+/* Small pages, so a handful of values already spans several. */
+using Slots = SlotArray<std::string, 4>;
+
+static void RunSlotArrayTests(TestRunner& runner) {
+    runner.Run("slot_array.emplace_find_erase", [&] {
+        Slots slots;
+        const Slots::Key a{ slots.Emplace("a") };
+        const Slots::Key b{ slots.Emplace(3, 'b') };
+        DOA_CHECK(runner, slots.Size() == 2);
+        DOA_CHECK(runner, slots.Find(a) != nullptr && *slots.Find(a) == "a");
+        DOA_CHECK(runner, slots.Find(b) != nullptr && *slots.Find(b) == "bbb");
+
+        DOA_CHECK(runner, slots.Erase(a));
+        DOA_CHECK(runner, !slots.Erase(a));
+        DOA_CHECK(runner, !slots.Contains(a));
+        DOA_CHECK(runner, slots.Find(a) == nullptr);
+        DOA_CHECK(runner, slots.Size() == 1);
+        DOA_CHECK(runner, !slots.Contains(Slots::Key{}));
+    });
+    runner.Run("slot_array.reused_slot_keeps_old_keys_stale", [&] {
+        Slots slots;
+        const Slots::Key first{ slots.Emplace("first") };
+        slots.Erase(first);
+        const Slots::Key second{ slots.Emplace("second") };
+        DOA_CHECK(runner, second.Index == first.Index);
+        DOA_CHECK(runner, second.Generation != first.Generation);
+        DOA_CHECK(runner, slots.Find(first) == nullptr);
+        DOA_CHECK(runner, *slots.Find(second) == "second");
+        DOA_CHECK(runner, slots.SlotOf(first).Generation != first.Generation); // what a cached (Slot*, generation) pair compares
+    });
+    runner.Run("slot_array.values_never_move", [&] {
+        Slots slots;
+        std::vector<Slots::Key> keys;
+        std::vector<const std::string*> addresses;
+        for (int i = 0; i < 64; i++) {
+            keys.push_back(slots.Emplace(std::to_string(i)));
+            addresses.push_back(slots.Find(keys.back()));
+            if (i % 3 == 0) {
+                slots.Erase(keys[i / 2]);
+            }
+        }
+        DOA_CHECK(runner, slots.Capacity() >= slots.Size());
+        for (size_t i = 0; i < keys.size(); i++) {
+            if (const std::string* value = slots.Find(keys[i])) {
+                DOA_CHECK(runner, value == addresses[i]);
+                DOA_CHECK(runner, *value == std::to_string(i));
+            }
+        }
+    });
+    runner.Run("slot_array.clear_and_for_each", [&] {
+        Slots slots;
+        std::vector<Slots::Key> keys;
+        for (int i = 0; i < 10; i++) {
+            keys.push_back(slots.Emplace(std::to_string(i)));
+        }
+        slots.Erase(keys[4]);
+
+        std::string visited;
+        slots.ForEach([&](Slots::Key key, std::string& value) {
+            DOA_CHECK(runner, slots.Find(key) == &value);
+            visited += value;
+        });
+        DOA_CHECK(runner, visited == "012356789");
+
+        const size_t capacity{ slots.Capacity() };
+        slots.Clear();
+        DOA_CHECK(runner, slots.Size() == 0);
+        DOA_CHECK(runner, slots.Capacity() == capacity);
+        for (Slots::Key key : keys) {
+            DOA_CHECK(runner, !slots.Contains(key));
+        }
+        DOA_CHECK(runner, slots.Emplace("again").Index == 0); // refilled from the lowest slot
+    });
+}
+
+/* Appends its id to log when executed, retains bytes. */
+struct RecordingCommand : ICommand {
+    std::string& Log;
+    char ID;
+    size_t Bytes;
+
+    RecordingCommand(std::string& log, char id, size_t bytes) noexcept : Log(log), ID(id), Bytes(bytes) {}
+
+    void Execute() noexcept override { Log += ID; }
+    void UnExecute() noexcept override { Log += '-'; Log += ID; }
+    size_t RetainedBytes() const noexcept override { return Bytes; }
+};
+
+static std::string UndoIDs(const UndoRedoStack& history) {
+    std::string rv;
+    for (UndoRedoStack::UndoStackIterator it{ history }; it.HasNext();) {
+        rv += static_cast<RecordingCommand&>(it.Next().first).ID;
+    }
+    return rv;
+}
+static std::string RedoIDs(const UndoRedoStack& history) {
+    std::string rv;
+    for (UndoRedoStack::RedoStackIterator it{ history }; it.HasNext();) {
+        rv += static_cast<RecordingCommand&>(it.Next().first).ID;
+    }
+    return rv;
+}
+
+static void RunUndoRedoStackTests(TestRunner& runner) {
+    runner.Run("undo_redo.budget_drops_oldest_undo", [&] {
+        std::string log;
+        UndoRedoStack history;
+        history.SetMemoryBudget(300);
+        for (char id : std::string{ "abcde" }) {
+            history.Do(std::make_unique<RecordingCommand>(log, id, 100));
+        }
+        DOA_CHECK(runner, log == "abcde");
+        DOA_CHECK(runner, UndoIDs(history) == "cde");
+        DOA_CHECK(runner, history.MemoryUsage() == 300);
+        DOA_CHECK(runner, history.EvictedCount() == 2);
+
+        history.Do(std::make_unique<RecordingCommand>(log, 'f', 1000)); // over budget alone, still undoable
+        DOA_CHECK(runner, UndoIDs(history) == "f");
+        history.Undo();
+        DOA_CHECK(runner, log == "abcdef-f");
+    });
+    runner.Run("undo_redo.budget_drops_furthest_redo", [&] {
+        std::string log;
+        UndoRedoStack history;
+        history.SetMemoryBudget(1000);
+        for (char id : std::string{ "abcde" }) {
+            history.Do(std::make_unique<RecordingCommand>(log, id, 100));
+        }
+        for (int i = 0; i < 4; i++) {
+            history.Undo();
+        }
+        DOA_CHECK(runner, UndoIDs(history) == "a");
+        DOA_CHECK(runner, RedoIDs(history) == "edcb"); // b is redone next
+
+        history.SetMemoryBudget(250);
+        DOA_CHECK(runner, UndoIDs(history) == "a");
+        DOA_CHECK(runner, RedoIDs(history) == "b");
+        DOA_CHECK(runner, history.MemoryUsage() == 200);
+        DOA_CHECK(runner, history.EvictedCount() == 3);
+
+        history.Redo();
+        DOA_CHECK(runner, !history.CanRedo());
+        DOA_CHECK(runner, UndoIDs(history) == "ab");
+        DOA_CHECK(runner, log == "abcde-e-d-c-bb");
+    });
+    runner.Run("undo_redo.clear_resets_usage", [&] {
+        std::string log;
+        UndoRedoStack history;
+        history.SetMemoryBudget(100);
+        history.Do(std::make_unique<RecordingCommand>(log, 'a', 100));
+        history.Do(std::make_unique<RecordingCommand>(log, 'b', 100));
+        history.Clear();
+        DOA_CHECK(runner, !history.CanUndo() && !history.CanRedo());
+        DOA_CHECK(runner, history.MemoryUsage() == 0);
+        DOA_CHECK(runner, history.EvictedCount() == 0);
+    });
+}
+
+void RunUtilitySuite(TestRunner& runner) {
+    RunSlotArrayTests(runner);
+    RunUndoRedoStackTests(runner);
+}
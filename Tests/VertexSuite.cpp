@@ -0,0 +1,189 @@
+#include <Tests/Suites.hpp>
+
+#include <cmath>
+#include <array>
+#include <limits>
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <numeric>
+
+#include <glm/glm.hpp>
+
+#include <Engine/Half.hpp>
+#include <Engine/Vertex.hpp>
+
+#include <Tests/Test.hpp>
+
+/* The bound Vertex.hpp documents for octahedral normals. */
+static constexpr float MAX_NORMAL_ERROR_DEGREES{ 0.004f };
+static constexpr int RANDOM_SAMPLES{ 200'000 };
+
+static float AngleDegrees(glm::vec3 a, glm::vec3 b) {
+    return glm::degrees(std::atan2(glm::length(glm::cross(a, b)), glm::dot(a, b)));
+}
+
+static glm::vec3 RandomUnitVector(std::mt19937& random) {
+    std::normal_distribution<float> distribution;
+    glm::vec3 rv{};
+    do {
+        rv = { distribution(random), distribution(random), distribution(random) };
+    } while (glm::length(rv) < 1e-6f);
+    return glm::normalize(rv);
+}
+
+static void RunHalfTests(TestRunner& runner) {
+    runner.Run("half.every_half_round_trips", [&] {
+        for (uint32_t bits = 0; bits <= UINT16_MAX; bits++) {
+            const Half half{ static_cast<uint16_t>(bits) };
+            const float value{ half.ToFloat() };
+            if (std::isnan(value)) {
+                DOA_CHECK(runner, std::isnan(Half::FromFloat(value).ToFloat()));
+            } else {
+                DOA_CHECK(runner, Half::FromFloat(value) == half);
+            }
+        }
+    });
+    runner.Run("half.float_round_trip_error", [&] {
+        std::mt19937 random{ 36 };
+        std::uniform_real_distribution<float> exponent{ -24.0f, 15.9f };
+        for (int i = 0; i < RANDOM_SAMPLES; i++) {
+            const float value{ std::exp2(exponent(random)) * (i % 2 == 0 ? 1.0f : -1.0f) };
+            const float decoded{ Half::FromFloat(value).ToFloat() };
+            if (std::abs(value) >= std::exp2(-14.0f)) {
+                DOA_CHECK(runner, std::abs(decoded - value) <= std::abs(value) * std::exp2(-11.0f)); // normal, half an ulp
+            } else {
+                DOA_CHECK(runner, std::abs(decoded - value) <= std::exp2(-25.0f)); // subnormal, half the smallest step
+            }
+        }
+    });
+    runner.Run("half.rounding_and_specials", [&] {
+        DOA_CHECK(runner, Half::FromFloat(1.0f + std::exp2(-11.0f)).ToFloat() == 1.0f);                                 // tie, to even
+        DOA_CHECK(runner, Half::FromFloat(1.0f + 3.0f * std::exp2(-11.0f)).ToFloat() == 1.0f + std::exp2(-9.0f));        // tie, to even
+        DOA_CHECK(runner, Half::FromFloat(65504.0f).ToFloat() == 65504.0f);
+        DOA_CHECK(runner, Half::FromFloat(65519.0f).ToFloat() == 65504.0f);
+        DOA_CHECK(runner, std::isinf(Half::FromFloat(65520.0f).ToFloat()));
+        DOA_CHECK(runner, std::isinf(Half::FromFloat(-1e10f).ToFloat()) && Half::FromFloat(-1e10f).ToFloat() < 0.0f);
+        DOA_CHECK(runner, std::isinf(Half::FromFloat(std::numeric_limits<float>::infinity()).ToFloat()));
+        DOA_CHECK(runner, std::isnan(Half::FromFloat(std::numeric_limits<float>::quiet_NaN()).ToFloat()));
+        DOA_CHECK(runner, Half::FromFloat(std::exp2(-24.0f)).Bits == 0x0001u);
+        DOA_CHECK(runner, Half::FromFloat(std::exp2(-26.0f)).Bits == 0x0000u);
+        DOA_CHECK(runner, Half::FromFloat(-0.0f).Bits == 0x8000u);
+    });
+}
+
+static void RunQuantizationTests(TestRunner& runner) {
+    using namespace VertexQuantization;
+
+    runner.Run("vertex.snorm16_unorm8_round_trip", [&] {
+        for (int value = -INT16_MAX; value <= INT16_MAX; value++) {
+            DOA_CHECK(runner, EncodeSnorm16(DecodeSnorm16(static_cast<int16_t>(value))) == value);
+        }
+        DOA_CHECK(runner, DecodeSnorm16(INT16_MIN) == -1.0f);
+        for (int value = 0; value <= UINT8_MAX; value++) {
+            DOA_CHECK(runner, EncodeUnorm8(DecodeUnorm8(static_cast<uint8_t>(value))) == value);
+        }
+        for (int i = 0; i <= 1000; i++) {
+            const float value{ static_cast<float>(i) / 1000.0f };
+            DOA_CHECK(runner, std::abs(DecodeSnorm16(EncodeSnorm16(value * 2.0f - 1.0f)) - (value * 2.0f - 1.0f)) <= 0.5f / INT16_MAX + 1e-7f);
+            DOA_CHECK(runner, std::abs(DecodeUnorm8(EncodeUnorm8(value)) - value) <= 0.5f / UINT8_MAX + 1e-7f);
+        }
+        DOA_CHECK(runner, EncodeSnorm16(2.0f) == INT16_MAX && EncodeSnorm16(-2.0f) == -INT16_MAX);
+        DOA_CHECK(runner, EncodeUnorm8(2.0f) == UINT8_MAX && EncodeUnorm8(-1.0f) == 0);
+    });
+    runner.Run("vertex.octahedral_normal_error", [&] {
+        std::vector<glm::vec3> normals{
+            { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 },
+            glm::normalize(glm::vec3{ 1, 1, 1 }), glm::normalize(glm::vec3{ -1, -1, -1 }),
+            glm::normalize(glm::vec3{ 1, -1, -1e-4f }), glm::normalize(glm::vec3{ -1, 1, 1e-4f }),
+        };
+        std::mt19937 random{ 36 };
+        for (int i = 0; i < RANDOM_SAMPLES; i++) {
+            normals.push_back(RandomUnitVector(random));
+        }
+        float worst{ 0.0f };
+        for (glm::vec3 normal : normals) {
+            const glm::vec3 decoded{ DecodeOctahedral(EncodeOctahedral(normal)) };
+            DOA_CHECK(runner, std::abs(glm::length(decoded) - 1.0f) <= 1e-5f);
+            worst = std::max(worst, AngleDegrees(normal, decoded));
+        }
+        DOA_CHECK(runner, worst <= MAX_NORMAL_ERROR_DEGREES);
+        DOA_CHECK(runner, DecodeOctahedral(EncodeOctahedral(glm::vec3{ 0.0f })) == glm::vec3(0, 0, 1));
+        DOA_CHECK(runner, AngleDegrees(DecodeOctahedral(EncodeOctahedral(glm::vec3{ 0, 0, -3 })), { 0, 0, -1 }) <= MAX_NORMAL_ERROR_DEGREES); // not unit length
+    });
+    runner.Run("vertex.bone_weights_sum_to_one", [&] {
+        std::mt19937 random{ 36 };
+        std::uniform_real_distribution<float> weight{ 0.0f, 1.0f };
+        for (int i = 0; i < RANDOM_SAMPLES; i++) {
+            std::array<float, Vertex::MAX_BONE_PER_VERTEX> weights{};
+            const int used{ 1 + i % Vertex::MAX_BONE_PER_VERTEX };
+            for (int b = 0; b < used; b++) {
+                weights[b] = weight(random);
+            }
+            const float total{ std::accumulate(weights.begin(), weights.end(), 0.0f) };
+            if (total <= 0.0f) { continue; }
+
+            const auto encoded = EncodeBoneWeights(weights);
+            DOA_CHECK(runner, std::accumulate(encoded.begin(), encoded.end(), 0) == UINT8_MAX);
+            const auto decoded = DecodeBoneWeights(encoded);
+            for (int b = 0; b < Vertex::MAX_BONE_PER_VERTEX; b++) {
+                // every weight rounds by half a step, the heaviest also takes the others' rounding
+                DOA_CHECK(runner, std::abs(decoded[b] - weights[b] / total) <= Vertex::MAX_BONE_PER_VERTEX * 0.5f / UINT8_MAX + 1e-6f);
+            }
+        }
+        DOA_CHECK(runner, (EncodeBoneWeights({ 0, 0, 0, 0 }) == std::array<uint8_t, Vertex::MAX_BONE_PER_VERTEX>{ 0, 0, 0, 0 }));
+        DOA_CHECK(runner, (EncodeBoneWeights({ 2, 0, 0, -1 }) == std::array<uint8_t, Vertex::MAX_BONE_PER_VERTEX>{ 255, 0, 0, 0 }));
+    });
+    runner.Run("vertex.pack_unpack_round_trip", [&] {
+        std::mt19937 random{ 36 };
+        std::uniform_real_distribution<float> unit{ 0.0f, 1.0f };
+        std::uniform_real_distribution<float> coordinate{ -4.0f, 4.0f };
+        std::uniform_int_distribution<int> bone{ 0, MAX_BONE_ID };
+        for (int i = 0; i < RANDOM_SAMPLES / 10; i++) {
+            Vertex vertex{
+                .Position = { coordinate(random), coordinate(random), coordinate(random) },
+                .Normal = RandomUnitVector(random),
+                .Color = { unit(random), unit(random), unit(random), unit(random) },
+                .TexCoords = { coordinate(random), coordinate(random) },
+                .BoneIDs = { bone(random), bone(random), bone(random), bone(random) },
+                .BoneWeights = { unit(random), unit(random), 0.0f, 0.0f },
+            };
+            const Vertex unpacked{ Unpack(Pack(vertex), PackSkin(vertex)) };
+            DOA_CHECK(runner, unpacked.Position == vertex.Position);
+            DOA_CHECK(runner, AngleDegrees(unpacked.Normal, vertex.Normal) <= MAX_NORMAL_ERROR_DEGREES);
+            for (int c = 0; c < 4; c++) {
+                DOA_CHECK(runner, std::abs(unpacked.Color[c] - vertex.Color[c]) <= 0.5f / UINT8_MAX + 1e-6f);
+            }
+            for (int c = 0; c < 2; c++) {
+                DOA_CHECK(runner, std::abs(unpacked.TexCoords[c] - vertex.TexCoords[c]) <= std::max(std::abs(vertex.TexCoords[c]) * std::exp2(-11.0f), std::exp2(-25.0f)));
+            }
+            DOA_CHECK(runner, unpacked.BoneIDs == vertex.BoneIDs);
+            DOA_CHECK(runner, std::abs(std::accumulate(unpacked.BoneWeights.begin(), unpacked.BoneWeights.end(), 0.0f) - 1.0f) <= 1e-5f);
+        }
+    });
+    runner.Run("vertex.mesh_streams", [&] {
+        std::vector<Vertex> vertices(3);
+        vertices[1].Normal = { 0, 1, 0 };
+
+        PackedMesh still{ Pack(vertices) };
+        DOA_CHECK(runner, still.Vertices.size() == vertices.size());
+        DOA_CHECK(runner, !still.IsSkinned());
+
+        vertices[2].BoneIDs = { 3, 300, -1, 0 };
+        vertices[2].BoneWeights = { 1, 0, 0, 0 };
+        DOA_CHECK(runner, !IsSkinRepresentable(vertices[2]));
+        PackedMesh skinned{ Pack(vertices) };
+        DOA_CHECK(runner, skinned.IsSkinned());
+        DOA_CHECK(runner, skinned.Skin.size() == vertices.size());
+        DOA_CHECK(runner, (skinned.Skin[2].BoneIDs == std::array<uint8_t, Vertex::MAX_BONE_PER_VERTEX>{ 3, MAX_BONE_ID, 0, 0 }));
+        DOA_CHECK(runner, (skinned.Skin[0].BoneWeights == std::array<uint8_t, Vertex::MAX_BONE_PER_VERTEX>{ 0, 0, 0, 0 }));
+
+        DOA_CHECK(runner, PackedVertex::Layout().Stride == sizeof(PackedVertex));
+        DOA_CHECK(runner, SkinVertex::Layout().Stride == sizeof(SkinVertex));
+    });
+}
+
+void RunVertexSuite(TestRunner& runner) {
+    RunHalfTests(runner);
+    RunQuantizationTests(runner);
+}
@@ -0,0 +1,43 @@
+#include <cstdio>
+#include <iostream>
+
+#include <argparse/argparse.hpp>
+
+#include <Engine/Log.hpp>
+#include <Engine/Core.hpp>
+
+#include <Tests/Test.hpp>
+#include <Tests/Suites.hpp>
+
+int main(int argc, char* argv[]) {
+    //- Parse Command Line Arguments -//
+    argparse::ArgumentParser program(argv[0]);
+    program.add_description("Checks the engine headlessly, on the no-op graphics backend. Exits with 1 if any test fails.");
+    program.add_argument("--filter").help("Only run tests whose name contains this").default_value(std::string{});
+
+    TestSettings settings;
+    try {
+        program.parse_args(argc, argv);
+        settings.Filter = program.get("--filter");
+    } catch (const std::exception& err) {
+        DOA_LOG_FATAL("FATAL ERROR: %s\n", err.what());
+        std::cerr << program << std::endl;
+        std::exit(1);
+    }
+    //- Parse Command Line Arguments -//
+
+    Core::CreateHeadlessCore();
+
+    TestRunner runner{ settings };
+    RunUtilitySuite(runner);
+    RunVertexSuite(runner);
+    RunGraphicsSuite(runner);
+    RunRenderGraphSuite(runner);
+    RunJumpFloodSuite(runner);
+    RunAssetSuite(runner);
+
+    Core::DestroyCore();
+
+    std::printf("%zu of %zu tests failed\n", runner.FailedCount(), runner.RunCount());
+    return runner.FailedCount() == 0 ? 0 : 1;
+}
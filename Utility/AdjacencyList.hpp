@@ -115,6 +115,15 @@ struct AdjacencyList {
     /// </summary>
     OutgoingEdgeIterator GetOutgoingEdgesOf(const Vertex& vertex) const noexcept;
 
+    /// <summary>
+    /// Returns every vertex that reaches vertex through one or more edges, each exactly once,
+    /// ordered so that a vertex comes after the destinations of all its outgoing edges in the result.
+    /// Vertices on a cycle can't be ordered and are appended last, in discovery order.
+    /// Precondition: vertex is present.
+    /// Postcondition: None.
+    /// </summary>
+    std::vector<Vertex> GetTransitiveOriginsOf(const Vertex& vertex) const noexcept;
+
 private:
     DataStructure data{};
 };
@@ -268,3 +277,65 @@ template<typename Vertex, size_t InitialVertexCount, size_t InitialEdgeCountPerV
 inline AdjacencyList<Vertex, InitialVertexCount, InitialEdgeCountPerVertex>::OutgoingEdgeIterator AdjacencyList<Vertex, InitialVertexCount, InitialEdgeCountPerVertex>::GetOutgoingEdgesOf(const Vertex& vertex) const noexcept {
     return { data.cbegin(), data.cend(), vertex };
 }
+
+template<typename Vertex, size_t InitialVertexCount, size_t InitialEdgeCountPerVertex>
+    requires std::equality_comparable<Vertex>
+inline std::vector<Vertex> AdjacencyList<Vertex, InitialVertexCount, InitialEdgeCountPerVertex>::GetTransitiveOriginsOf(const Vertex& vertex) const noexcept {
+    // Step 1. Reverse the edges once, so each vertex knows its origins without a scan of the graph per lookup
+    // Step 2. Collect the closure - breadth first over the reversed edges, every vertex is visited once
+    // Step 3. Order the closure - Kahn's algorithm, a vertex is ready once all its destinations in the closure are emitted
+
+    const auto vertexIndex = static_cast<EdgeList::value_type>(std::distance(data.begin(), std::ranges::find_if(data, [&vertex](const auto& pair) { return pair.first == vertex; })));
+    const size_t vertexCount = data.size();
+
+    // S1
+    std::vector<EdgeList> origins(vertexCount);
+    for (size_t i = 0; i < vertexCount; i++) {
+        for (const auto destination : data[i].second) {
+            origins[destination].push_back(i);
+        }
+    }
+
+    // S2
+    std::vector<bool> inClosure(vertexCount, false);
+    EdgeList closure{ vertexIndex };
+    inClosure[vertexIndex] = true;
+    for (size_t i = 0; i < closure.size(); i++) {
+        for (const auto origin : origins[closure[i]]) {
+            if (!inClosure[origin]) {
+                inClosure[origin] = true;
+                closure.push_back(origin);
+            }
+        }
+    }
+
+    // S3, vertex itself is the starting point and is never waited on nor emitted
+    std::vector<size_t> pendingDestinations(vertexCount, 0);
+    EdgeList ready{};
+    for (size_t i = 1; i < closure.size(); i++) {
+        for (const auto destination : data[closure[i]].second) {
+            pendingDestinations[closure[i]] += static_cast<size_t>(inClosure[destination] && destination != vertexIndex);
+        }
+        if (pendingDestinations[closure[i]] == 0) {
+            ready.push_back(closure[i]);
+        }
+    }
+    std::vector<Vertex> rv{};
+    rv.reserve(closure.size() - 1);
+    for (size_t i = 0; i < ready.size(); i++) {
+        rv.push_back(data[ready[i]].first);
+        for (const auto origin : origins[ready[i]]) {
+            if (origin != vertexIndex && --pendingDestinations[origin] == 0) {
+                ready.push_back(origin);
+            }
+        }
+    }
+    if (rv.size() < closure.size() - 1) {
+        for (size_t i = 1; i < closure.size(); i++) {
+            if (pendingDestinations[closure[i]] > 0) {
+                rv.push_back(data[closure[i]].first);
+            }
+        }
+    }
+    return rv;
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <chrono>
+#include <string_view>
+
+// Editors publish which project they have open, the launcher subscribes and keeps a live set.
+// A message is a topic immediately followed by the absolute path of the project file.
+namespace ProjectPresence {
+
+	inline constexpr std::string_view PublisherAddress{ "tcp://localhost:5556" };
+	inline constexpr std::string_view SubscriberAddress{ "tcp://*:5556" };
+
+	inline constexpr std::string_view TopicPrefix{ "project_" };
+	inline constexpr std::string_view OpenedTopic{ "project_opened " };
+	inline constexpr std::string_view HeartbeatTopic{ "project_heartbeat " };
+	inline constexpr std::string_view ClosedTopic{ "project_closed " };
+
+	// Editors that crash never publish ClosedTopic, their entries expire when heartbeats stop.
+	inline constexpr std::chrono::milliseconds HeartbeatInterval{ 1000 };
+	inline constexpr std::chrono::milliseconds Timeout{ 3 * HeartbeatInterval };
+}
@@ -73,6 +73,9 @@ std::string_view SimpleSocket::Receive(ReceiveFlag flag) noexcept {
 		return "";
 	}
 }
+void SimpleSocket::Subscribe(std::string_view topic) noexcept {
+	socket.set(zmq::sockopt::subscribe, topic);
+}
 
 ServerSocket::ServerSocket(std::string_view address, SocketType type) noexcept :
 	SimpleSocket(type) {
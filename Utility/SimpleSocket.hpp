@@ -51,6 +51,9 @@ struct SimpleSocket {
 	void Send(std::string_view message, SendFlag flag = SendFlag::None) noexcept;
 	std::string_view Receive(ReceiveFlag flag = ReceiveFlag::None) noexcept;
 
+	// Only meaningful for SocketType::Subscriber, messages starting with topic are received.
+	void Subscribe(std::string_view topic) noexcept;
+
 protected:
 	zmq::context_t context{ 1 };
 	zmq::socket_t socket;
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <optional>
+
+/// <summary>
+/// Stores values in slots that never move, in pages of PageSize slots.
+/// Every slot has a generation which is bumped whenever its value is erased, a Key (index + generation)
+/// therefore goes stale the moment its value is erased and stays stale even if the slot is reused.
+/// Pages are never released before the array itself, so a Slot* remains dereferenceable and
+/// validating a cached (Slot*, generation) pair is a single comparison.
+/// </summary>
+template<typename T, size_t PageSize = 256>
+struct SlotArray {
+
+    struct Slot {
+        uint32_t Generation{ 0 };
+        std::optional<T> Value{};
+    };
+
+    struct Key {
+        uint32_t Index{ UINT32_MAX };
+        uint32_t Generation{ 0 };
+
+        bool operator==(const Key&) const noexcept = default;
+    };
+
+    SlotArray() noexcept = default;
+    ~SlotArray() noexcept = default;
+    SlotArray(const SlotArray&) = delete;
+    SlotArray(SlotArray&&) noexcept = default;
+    SlotArray& operator=(const SlotArray&) = delete;
+    SlotArray& operator=(SlotArray&&) noexcept = default;
+
+    /// <summary>
+    /// Constructs a value in place, in a previously freed slot if there is one.
+    /// Postcondition: the returned key is valid until the value is erased.
+    /// </summary>
+    template<typename... Args>
+    Key Emplace(Args&&... args);
+
+    /// <summary>
+    /// Destroys the value of key, if key is valid. Keys to this slot are stale before the destructor runs.
+    /// </summary>
+    bool Erase(Key key) noexcept;
+
+    /// <summary>
+    /// Destroys every value. Capacity and pages are retained, every key goes stale.
+    /// </summary>
+    void Clear() noexcept;
+
+    bool Contains(Key key) const noexcept;
+    T* Find(Key key) noexcept;
+    const T* Find(Key key) const noexcept;
+
+    /// <summary>
+    /// Precondition: key is valid. The slot outlives its value, see the type's description.
+    /// </summary>
+    Slot& SlotOf(Key key) noexcept;
+
+    size_t Size() const noexcept;
+    size_t Capacity() const noexcept;
+
+    /// <summary>
+    /// Calls func(Key, T&) for every live value, in slot order.
+    /// </summary>
+    template<typename Func>
+    void ForEach(Func&& func);
+    template<typename Func>
+    void ForEach(Func&& func) const;
+
+private:
+    using Page = std::array<Slot, PageSize>;
+
+    std::vector<std::unique_ptr<Page>> pages{};
+    std::vector<uint32_t> freeList{};
+    uint32_t slotCount{ 0 };
+    size_t size{ 0 };
+
+    Slot& At(uint32_t index) noexcept;
+    const Slot& At(uint32_t index) const noexcept;
+};
+
+template<typename T, size_t PageSize>
+template<typename... Args>
+SlotArray<T, PageSize>::Key SlotArray<T, PageSize>::Emplace(Args&&... args) {
+    uint32_t index;
+    if (!freeList.empty()) {
+        index = freeList.back();
+        freeList.pop_back();
+    } else {
+        if (slotCount == pages.size() * PageSize) {
+            pages.push_back(std::make_unique<Page>());
+        }
+        index = slotCount++;
+    }
+    Slot& slot = At(index);
+    slot.Value.emplace(std::forward<Args>(args)...);
+    size++;
+    return { index, slot.Generation };
+}
+
+template<typename T, size_t PageSize>
+bool SlotArray<T, PageSize>::Erase(Key key) noexcept {
+    if (!Contains(key)) { return false; }
+    Slot& slot = At(key.Index);
+    slot.Generation++;
+    slot.Value.reset();
+    freeList.push_back(key.Index);
+    size--;
+    return true;
+}
+
+template<typename T, size_t PageSize>
+void SlotArray<T, PageSize>::Clear() noexcept {
+    for (uint32_t i = 0; i < slotCount; i++) {
+        Slot& slot = At(i);
+        if (slot.Value.has_value()) {
+            slot.Generation++;
+            slot.Value.reset();
+        }
+    }
+    freeList.clear();
+    // Reuse lower slots first, so a cleared and refilled array stays as dense as it was.
+    for (uint32_t i = slotCount; i > 0; i--) {
+        freeList.push_back(i - 1);
+    }
+    size = 0;
+}
+
+template<typename T, size_t PageSize>
+bool SlotArray<T, PageSize>::Contains(Key key) const noexcept {
+    return key.Index < slotCount && At(key.Index).Generation == key.Generation && At(key.Index).Value.has_value();
+}
+
+template<typename T, size_t PageSize>
+T* SlotArray<T, PageSize>::Find(Key key) noexcept {
+    return Contains(key) ? &*At(key.Index).Value : nullptr;
+}
+template<typename T, size_t PageSize>
+const T* SlotArray<T, PageSize>::Find(Key key) const noexcept {
+    return Contains(key) ? &*At(key.Index).Value : nullptr;
+}
+
+template<typename T, size_t PageSize>
+SlotArray<T, PageSize>::Slot& SlotArray<T, PageSize>::SlotOf(Key key) noexcept {
+    assert(key.Index < slotCount);
+    return At(key.Index);
+}
+
+template<typename T, size_t PageSize>
+size_t SlotArray<T, PageSize>::Size() const noexcept { return size; }
+template<typename T, size_t PageSize>
+size_t SlotArray<T, PageSize>::Capacity() const noexcept { return pages.size() * PageSize; }
+
+template<typename T, size_t PageSize>
+template<typename Func>
+void SlotArray<T, PageSize>::ForEach(Func&& func) {
+    for (uint32_t i = 0; i < slotCount; i++) {
+        Slot& slot = At(i);
+        if (slot.Value.has_value()) {
+            func(Key{ i, slot.Generation }, *slot.Value);
+        }
+    }
+}
+template<typename T, size_t PageSize>
+template<typename Func>
+void SlotArray<T, PageSize>::ForEach(Func&& func) const {
+    for (uint32_t i = 0; i < slotCount; i++) {
+        const Slot& slot = At(i);
+        if (slot.Value.has_value()) {
+            func(Key{ i, slot.Generation }, *slot.Value);
+        }
+    }
+}
+
+template<typename T, size_t PageSize>
+SlotArray<T, PageSize>::Slot& SlotArray<T, PageSize>::At(uint32_t index) noexcept {
+    return (*pages[index / PageSize])[index % PageSize];
+}
+template<typename T, size_t PageSize>
+const SlotArray<T, PageSize>::Slot& SlotArray<T, PageSize>::At(uint32_t index) const noexcept {
+    return (*pages[index / PageSize])[index % PageSize];
+}
@@ -5,6 +5,7 @@
 ICommand::~ICommand() noexcept {};
 
 bool ICommand::TryMergeWith([[maybe_unused]] UndoRedoStack& history, [[maybe_unused]] const ICommand* command) noexcept { return false; }
+size_t ICommand::RetainedBytes() const noexcept { return sizeof(ICommand); }
 
 void UndoRedoStack::Do(Command&& command) noexcept {
     if (!undoStack.empty() && undoStack.back()->TryMergeWith(*this, command.get())) {
@@ -17,6 +18,7 @@ void UndoRedoStack::Do(Command&& command) noexcept {
     }
 
     redoStack.clear();
+    EnforceMemoryBudget();
 }
 void UndoRedoStack::Undo() noexcept {
     assert(CanUndo());
@@ -25,6 +27,7 @@ void UndoRedoStack::Undo() noexcept {
 
     command->UnExecute();
     redoStack.push_back(std::move(command));
+    EnforceMemoryBudget();
 }
 void UndoRedoStack::Redo() noexcept {
     assert(CanRedo());
@@ -33,10 +36,13 @@ void UndoRedoStack::Redo() noexcept {
 
     command->Execute();
     undoStack.push_back(std::move(command));
+    EnforceMemoryBudget();
 }
 void UndoRedoStack::Clear() noexcept {
     undoStack.clear();
     redoStack.clear();
+    memoryUsage = 0;
+    evictedCount = 0;
 }
 
 bool UndoRedoStack::CanUndo() const noexcept { return !undoStack.empty(); }
@@ -50,8 +56,41 @@ const ICommand& UndoRedoStack::PeekRedoStack() const noexcept {
     assert(CanRedo());
     return *redoStack.back().get();
 }
-void UndoRedoStack::PopUndoStack() noexcept { undoStack.pop_back(); }
-void UndoRedoStack::PopRedoStack() noexcept { redoStack.pop_back(); }
+void UndoRedoStack::PopUndoStack() noexcept {
+    undoStack.pop_back();
+    EnforceMemoryBudget();
+}
+void UndoRedoStack::PopRedoStack() noexcept {
+    redoStack.pop_back();
+    EnforceMemoryBudget();
+}
+
+void UndoRedoStack::SetMemoryBudget(size_t bytes) noexcept {
+    memoryBudget = bytes;
+    EnforceMemoryBudget();
+}
+size_t UndoRedoStack::MemoryBudget() const noexcept { return memoryBudget; }
+size_t UndoRedoStack::MemoryUsage() const noexcept { return memoryUsage; }
+size_t UndoRedoStack::EvictedCount() const noexcept { return evictedCount; }
+
+void UndoRedoStack::EnforceMemoryBudget() noexcept {
+    // Commands may retain more or less after executing, merging or un-executing, so re-measure every time.
+    memoryUsage = 0;
+    for (const auto& command : undoStack) { memoryUsage += command->RetainedBytes(); }
+    for (const auto& command : redoStack) { memoryUsage += command->RetainedBytes(); }
+
+    while (memoryUsage > memoryBudget && undoStack.size() > 1) {
+        memoryUsage -= undoStack.front()->RetainedBytes();
+        undoStack.pop_front();
+        evictedCount++;
+    }
+    // Redo's front was undone first, it is the last to be redone.
+    while (memoryUsage > memoryBudget && redoStack.size() > 1) {
+        memoryUsage -= redoStack.front()->RetainedBytes();
+        redoStack.pop_front();
+        evictedCount++;
+    }
+}
 
 // Iterators API:
 UndoRedoStack::Iterator::~Iterator() noexcept {};
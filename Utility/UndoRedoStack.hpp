@@ -1,7 +1,7 @@
 #pragma once
 
 #include <array>
-#include <vector>
+#include <deque>
 #include <memory>
 #include <utility>
 
@@ -14,11 +14,19 @@ struct ICommand {
     virtual void UnExecute() noexcept = 0;
 
     virtual bool TryMergeWith([[maybe_unused]] UndoRedoStack& history, [[maybe_unused]] const ICommand* command) noexcept;
+
+    /* Approximate memory kept alive by the command, including the command itself. Counts against the history's budget. */
+    virtual size_t RetainedBytes() const noexcept;
 };
 
+/* Once the commands in both stacks retain more than the memory budget, the oldest undoable commands are
+dropped until the history fits again, then the redoable commands furthest from the present. The command on top of
+either stack is always kept, so one undo and one redo are always possible. */
 struct UndoRedoStack {
     using Command = std::unique_ptr<ICommand>;
 
+    static constexpr size_t DEFAULT_MEMORY_BUDGET{ 64 * 1024 * 1024 };
+
     void Do(Command&& command) noexcept;
     void Undo() noexcept;
     void Redo() noexcept;
@@ -32,11 +40,23 @@ struct UndoRedoStack {
     void PopUndoStack() noexcept;
     void PopRedoStack() noexcept;
 
+    void SetMemoryBudget(size_t bytes) noexcept;
+    size_t MemoryBudget() const noexcept;
+    size_t MemoryUsage() const noexcept;
+    /* Number of commands dropped to stay within the budget since the last Clear. */
+    size_t EvictedCount() const noexcept;
+
 private:
-    using DataStructure = std::vector<Command>;
+    using DataStructure = std::deque<Command>;
     DataStructure undoStack{};
     DataStructure redoStack{};
 
+    size_t memoryBudget{ DEFAULT_MEMORY_BUDGET };
+    size_t memoryUsage{ 0 };
+    size_t evictedCount{ 0 };
+
+    void EnforceMemoryBudget() noexcept;
+
     // Iterators API:
     // Provides support for forward-reverse iteration
     // of either undo-redo or both stacks.